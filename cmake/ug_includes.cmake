@@ -176,6 +176,7 @@ option(BUILTIN_BLAS "BLAS is built into compiler" OFF)
 option(BUILTIN_LAPACK "LAPACK is built into compiler" OFF)
 option(BUILTIN_MPI "MPI is built into compiler" OFF)
 option(OPENMP "Enables use of OpenMP. Valid options are ON, OFF" OFF)
+option(ZLIB "Enables zlib compression (e.g. of appended vtk data). Valid options are ON, OFF" OFF)
 option(CXX11 "Enables compilation with C++11 standard. Valid options are ON, OFF" OFF)
 option(EMBEDDED_PLUGINS "Plugin sources are directly included in libug4. No dynamic loading required. Valid options are ON, OFF " OFF)
 option(COMPILE_INFO "Embeds information on compile revision and date. Requires relinking of all involved libraries. Valid options are ON, OFF " ${buildCompileInfo})
@@ -269,6 +270,7 @@ message(STATUS "Info: INTERNAL_BOOST:    ${INTERNAL_BOOST} (options are: ON, OFF
 message(STATUS "Info: EMBEDDED_PLUGINS   ${EMBEDDED_PLUGINS} (options are: ON, OFF)")
 message(STATUS "Info: COMPILE_INFO       ${COMPILE_INFO} (options are: ON, OFF)")
 message(STATUS "Info: USE_LUA2C          ${USE_LUA2C} (options are: ON, OFF)")
+message(STATUS "Info: ZLIB               ${ZLIB} (options are: ON, OFF)")
 message(STATUS "")
 message(STATUS "Info: External libraries (path which contains the library or ON if you used uginstall):")
 message(STATUS "Info: TETGEN:   ${TETGEN}")
@@ -434,6 +436,8 @@ include(${UG_ROOT_CMAKE_PATH}/ug/tetgen.cmake)
 include(${UG_ROOT_CMAKE_PATH}/ug/hlibpro.cmake)
 # OpenCL
 include(${UG_ROOT_CMAKE_PATH}/ug/opencl.cmake)
+# ZLIB
+include(${UG_ROOT_CMAKE_PATH}/ug/zlib.cmake)
 
 
 ################################################################################
@@ -489,6 +493,9 @@ endif(buildCompileInfo)
 ########################################
 if(POSIX)
 	add_definitions(-DUG_POSIX)
+#	background threads (e.g. AsyncFileWriter)
+	find_package(Threads)
+	set(linkLibraries ${linkLibraries} ${CMAKE_THREAD_LIBS_INIT})
 endif(POSIX)
 
 ########################################
@@ -62,6 +62,7 @@
 #include "matrix_diagonal.h"
 
 #include "lib_algebra/operator/energy_convergence_check.h"
+#include "lib_algebra/common/multi_vector.h"
 
 using namespace std;
 
@@ -164,6 +165,20 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_function("VecNorm", &VecScaleAddNorm<TAlgebra>);
 	}
 
+//	MultiVector
+	{
+		typedef MultiVector<vector_type> T;
+		string name = string("MultiVector").append(suffix);
+		reg.add_class_<T>(name, grp, "Block of vectors, e.g. several right-hand sides")
+		.add_constructor()
+		.add_method("push_back", &T::push_back, "", "vector", "appends a vector (not copied)")
+		.add_method("size", &T::size, "Number of vectors", "")
+		.add_method("vector", (SmartPtr<vector_type> (T::*)(size_t)) &T::vector, "vector", "index")
+		.add_method("set", &T::set, "", "Number", "sets all entries of all vectors")
+		.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MultiVector", tag);
+	}
+
 //	VecScaleAddClass
 	{
 		string name = string("VecScaleAddClass").append(suffix);
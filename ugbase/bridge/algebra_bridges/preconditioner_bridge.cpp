@@ -169,6 +169,25 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "Jacobi", tag);
 	}
 
+//	Chebyshev
+	{
+		typedef Chebyshev<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("Chebyshev").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Chebyshev polynomial smoother")
+			.add_constructor()
+			.template add_constructor<void (*)(int)>("degree")
+			.add_method("set_degree", &T::set_degree, "", "degree", "number of matrix-vector products per application (default 3)")
+			.add_method("set_eigenvalue_ratio", &T::set_eigenvalue_ratio, "", "ratio", "lower bound of the smoothed spectrum relative to the upper one (default 0.3)")
+			.add_method("set_safety_factor", &T::set_safety_factor, "", "safety", "factor applied to the estimated largest eigenvalue (default 1.1)")
+			.add_method("set_power_iterations", &T::set_power_iterations, "", "numIter", "power iterations used to estimate the largest eigenvalue (default 10)")
+			.add_method("set_max_eigenvalue", &T::set_max_eigenvalue, "", "lambdaMax", "largest eigenvalue of D^{-1}A. If > 0, no estimation is performed")
+			.add_method("set_l1", &T::set_l1, "", "bL1", "if true, l1-Jacobi scaling is used")
+			.add_method("max_eigenvalue", &T::max_eigenvalue, "lambdaMax")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "Chebyshev", tag);
+	}
+
 //	GaussSeidelBase
 	{
 		typedef GaussSeidelBase<TAlgebra> T;
@@ -213,6 +232,49 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "BackwardGaussSeidel", tag);
 	}
 
+//	MulticolorGaussSeidelBase
+	{
+		typedef MulticolorGaussSeidelBase<TAlgebra> T;
+		typedef GaussSeidelBase<TAlgebra> TBase;
+		string name = string("MulticolorGaussSeidelBase").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Multicolor Gauss-Seidel Base")
+			.add_method("num_colors", &T::num_colors, "number of colors");
+		reg.add_class_to_group(name, "MulticolorGaussSeidelBase", tag);
+	}
+
+//	MulticolorGaussSeidel
+	{
+		typedef MulticolorGaussSeidel<TAlgebra> T;
+		typedef MulticolorGaussSeidelBase<TAlgebra> TBase;
+		string name = string("MulticolorGaussSeidel").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Multicolor Gauss-Seidel Preconditioner, threaded within colors")
+			.add_constructor()
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MulticolorGaussSeidel", tag);
+	}
+
+//	MulticolorBackwardGaussSeidel
+	{
+		typedef MulticolorBackwardGaussSeidel<TAlgebra> T;
+		typedef MulticolorGaussSeidelBase<TAlgebra> TBase;
+		string name = string("MulticolorBackwardGaussSeidel").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Multicolor Backward Gauss-Seidel Preconditioner, threaded within colors")
+			.add_constructor()
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MulticolorBackwardGaussSeidel", tag);
+	}
+
+//	MulticolorSymmetricGaussSeidel
+	{
+		typedef MulticolorSymmetricGaussSeidel<TAlgebra> T;
+		typedef MulticolorGaussSeidelBase<TAlgebra> TBase;
+		string name = string("MulticolorSymmetricGaussSeidel").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Multicolor Symmetric Gauss-Seidel Preconditioner, threaded within colors")
+			.add_constructor()
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MulticolorSymmetricGaussSeidel", tag);
+	}
+
 	//	BlockGaussSeidel
 	{
 		RegisterBlockGaussSeidel<TAlgebra, BlockGaussSeidel<TAlgebra, true, false> >(reg, grp, "BlockGaussSeidel");
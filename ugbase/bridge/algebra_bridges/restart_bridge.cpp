@@ -43,6 +43,8 @@
 
 // preconditioner
 #include "lib_algebra/lib_algebra.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/common/matrixio/matrix_io_binary.h"
 #include "common/serialization.h"
 #include "../util_overloaded.h"
 #include "common/util/binary_buffer.h"
@@ -142,6 +144,11 @@ end
 
 
 See also checkpoint_util.lua and time_step_util.lua on how to generate checkpointing/debugging mechanisms with this.
+
+ Note that SaveToFile/ReadFromFile store the raw vector of each process. A restart
+ thus requires the same number of processes and the same distribution. Use
+ SaveGridFunctionCheckpoint/LoadGridFunctionCheckpoint for grid functions, if the
+ restart shall be performed with a different number of processes.
  */
 
 template<typename T>
@@ -160,6 +167,35 @@ void ReadFromFile(T &v, std::string filename)
 	Deserialize(b, v);
 }
 
+/*
+ SaveMatrixBinary/SaveVectorBinary write the global matrix or vector into one
+ binary file (see BinaryAlgebraFileHeader), e.g. for offline analysis. In contrast
+ to SaveToFile, LoadMatrixBinary/LoadVectorBinary may be executed with any number
+ of processes. The rows are then distributed evenly among the processes.
+ */
+
+template<typename TAlgebra>
+void SaveMatrixBinary(MatrixOperator<typename TAlgebra::matrix_type,
+						typename TAlgebra::vector_type>& A, const char* filename)
+{
+	SaveMatrixBinary(A.get_matrix(), filename);
+}
+
+template<typename TAlgebra>
+void LoadMatrixBinary(MatrixOperator<typename TAlgebra::matrix_type,
+						typename TAlgebra::vector_type>& A, const char* filename)
+{
+	LoadMatrixBinary(A.get_matrix(), filename);
+}
+
+template<typename TAlgebra>
+void LoadVectorBinary(typename TAlgebra::vector_type& v, const char* filename,
+					  MatrixOperator<typename TAlgebra::matrix_type,
+					  	  typename TAlgebra::vector_type>& A)
+{
+	LoadVectorBinary(v, filename, A.get_matrix());
+}
+
 
 
 namespace bridge{
@@ -196,9 +232,22 @@ static void Algebra(Registry& reg, string grp)
 
 //	typedefs for this algebra
 	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef MatrixOperator<matrix_type, vector_type> matrix_operator_type;
 
 	reg.add_function("SaveToFile", OVERLOADED_FUNCTION_PTR(void, SaveToFile<vector_type>, (const vector_type &, std::string)), grp);
 	reg.add_function("ReadFromFile", OVERLOADED_FUNCTION_PTR(void, ReadFromFile<vector_type>, (vector_type &, std::string)), grp);
+
+	reg.add_function("SaveMatrixBinary", OVERLOADED_FUNCTION_PTR(void, SaveMatrixBinary<TAlgebra>, (matrix_operator_type&, const char*)), grp,
+			"", "matrix#filename", "Writes the matrix of all processes to one binary file");
+	reg.add_function("LoadMatrixBinary", OVERLOADED_FUNCTION_PTR(void, LoadMatrixBinary<TAlgebra>, (matrix_operator_type&, const char*)), grp,
+			"", "matrix#filename", "Reads a matrix written by SaveMatrixBinary and distributes its rows evenly");
+	reg.add_function("SaveVectorBinary", OVERLOADED_FUNCTION_PTR(void, SaveVectorBinary<vector_type>, (const vector_type&, const char*)), grp,
+			"", "vector#filename", "Writes the vector of all processes to one binary file");
+	reg.add_function("LoadVectorBinary", OVERLOADED_FUNCTION_PTR(void, LoadVectorBinary<vector_type>, (vector_type&, const char*)), grp,
+			"", "vector#filename", "Reads a vector written by SaveVectorBinary and distributes its rows evenly");
+	reg.add_function("LoadVectorBinary", OVERLOADED_FUNCTION_PTR(void, LoadVectorBinary<TAlgebra>, (vector_type&, const char*, matrix_operator_type&)), grp,
+			"", "vector#filename#matrix", "Reads a vector written by SaveVectorBinary, distributed like a matrix read by LoadMatrixBinary");
 }
 
 }; // end Functionality
@@ -199,6 +199,8 @@ static void Algebra(Registry& reg, string grp)
 			.add_constructor()
 			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
 			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("multi_apply", &T::multi_apply, "Success", "solutions#right-hand sides",
+					"solves for several right-hand sides at once (block operator and preconditioner applications)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "CG", tag);
 	}
@@ -239,6 +241,7 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_minimum_for_sparse", &T::set_minimum_for_sparse, "", "N")
 			.add_method("set_sort_sparse", &T::set_sort_sparse, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in in sparse LU. default true")
 			.add_method("set_info", &T::set_info, "", "bInfo", "if true, sparse LU prints some fill-in info")
+			.add_method("set_supernodal", &T::set_supernodal, "", "bSupernodal", "if true, sparse LU uses a supernodal factorization with nested dissection ordering, otherwise ILUT(0). default false")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "LU", tag);
 	}
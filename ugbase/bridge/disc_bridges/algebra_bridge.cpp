@@ -51,6 +51,7 @@
 #include "lib_disc/spatial_disc/constraints/constraint_interface.h"
 #include "lib_disc/time_disc/time_disc_interface.h"
 #include "lib_disc/time_disc/theta_time_step.h"
+#include "lib_disc/time_disc/adaptive_time_integrator.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/line_search.h"
@@ -227,6 +228,34 @@ static void Algebra(Registry& reg, string parentGroup)
 		reg.add_class_to_group(name, "SDIRK", tag);
 	}
 
+//	AdaptiveTimeIntegrator
+	{
+		std::string grp = parentGroup; grp.append("/Discretization/TimeDisc");
+		typedef AdaptiveTimeIntegrator<TAlgebra> T;
+		string name = string("AdaptiveTimeIntegrator").append(suffix);
+		reg.add_class_<T>(name, grp)
+				.template add_constructor<void (*)(SmartPtr<ITimeDiscretization<TAlgebra> >, SmartPtr<IOperatorInverse<vector_type> >)>("TimeDiscretization#NonlinearSolver")
+				.add_method("set_level", &T::set_level, "", "GridLevel")
+				.add_method("set_order", &T::set_order, "", "Order", "order of the time discretization")
+				.add_method("set_tolerance", &T::set_tolerance, "", "absTol#relTol", "tolerance for the local error")
+				.add_method("set_time_step", &T::set_time_step, "", "dt", "initial time step size")
+				.add_method("time_step", &T::time_step, "dt", "", "proposed size of the next time step")
+				.add_method("set_time_step_bounds", &T::set_time_step_bounds, "", "minDt#maxDt")
+				.add_method("set_safety_factor", &T::set_safety_factor, "", "safety")
+				.add_method("set_factor_bounds", &T::set_factor_bounds, "", "minFactor#maxFactor")
+				.add_method("set_pi_gains", &T::set_pi_gains, "", "kI#kP")
+				.add_method("set_reduction_factor", &T::set_reduction_factor, "", "factor", "step size reduction if the nonlinear solver fails")
+				.add_method("set_extrapolation", &T::set_extrapolation, "", "bExtrapolate")
+				.add_method("set_finish_time_step", &T::set_finish_time_step, "", "bFinish")
+				.add_method("apply", &T::apply, "success", "solTimeSeries#u#endTime")
+				.add_method("num_accepted_steps", &T::num_accepted_steps)
+				.add_method("num_rejected_steps", &T::num_rejected_steps)
+				.add_method("last_error_estimate", &T::last_error_estimate)
+				.add_method("config_string", &T::config_string)
+				.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "AdaptiveTimeIntegrator", tag);
+	}
+
 
 //	AssembledLinearOperator
 	{
@@ -262,6 +291,17 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("set_convergence_check", &T::set_convergence_check, "", "convCheck")
 			.add_method("set_line_search", &T::set_line_search, "", "lineSeach")
 			.add_method("disable_line_search", &T::disable_line_search)
+			.add_method("set_jacobian_free", &T::set_jacobian_free, "", "bJacobianFree", "enables the Jacobian-free Newton-Krylov mode")
+			.add_method("jacobian_free", &T::jacobian_free, "bJacobianFree")
+			.add_method("set_jacobian_free_epsilon", &T::set_jacobian_free_epsilon, "", "epsilon", "relative size of the finite difference increment")
+			.add_method("set_jacobian_free_precond_update", &T::set_jacobian_free_precond_update, "", "numSteps", "reassemble preconditioner matrix every numSteps Newton steps (0: first step only)")
+			.add_method("set_jacobian_free_precond_discretization", &T::set_jacobian_free_precond_discretization, "", "domainDisc", "discretization used to assemble the preconditioner matrix")
+			.add_method("set_reuse_jacobian", &T::set_reuse_jacobian, "", "bReuse", "keeps Jacobian and linear solver setup until convergence deteriorates")
+			.add_method("set_reuse_lin_steps_factor", &T::set_reuse_lin_steps_factor, "", "factor", "reassemble if linear steps exceed factor times the steps after the last assembling")
+			.add_method("set_reuse_max_contraction", &T::set_reuse_max_contraction, "", "rate", "reassemble if the nonlinear contraction rate exceeds rate")
+			.add_method("force_jacobian_update", &T::force_jacobian_update)
+			.add_method("num_jacobian_assemblies", &T::num_jacobian_assemblies, "number of Jacobian assemblies")
+			.add_method("num_jacobian_reuses", &T::num_jacobian_reuses, "number of Newton steps with reused Jacobian")
 			.add_method("init", &T::init, "success", "op")
 			.add_method("prepare", &T::prepare, "success", "u")
 			.add_method("apply", &T::apply, "success", "u")
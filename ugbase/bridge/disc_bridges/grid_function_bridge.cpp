@@ -49,6 +49,7 @@
 #include "lib_disc/function_spaces/grid_function_global_user_data.h"
 #include "lib_disc/function_spaces/grid_function_user_data_explicit.h"
 #include "lib_disc/function_spaces/grid_function_coordinate_util.h"
+#include "lib_disc/function_spaces/grid_function_checkpoint.h"
 
 using namespace std;
 
@@ -252,6 +253,17 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_function ("CheckGFValuesAtVolumes", static_cast<bool (*) (const GF*, const char *)> (&CheckGFforNaN<GF,Volume>), grp);
 	}
 
+//	Checkpoints independent of the number of processes
+	{
+		typedef ug::GridFunction<TDomain, TAlgebra> GF;
+		reg.add_function("SaveGridFunctionCheckpoint", static_cast<void (*)(const GF&, const char*)>
+				(&SaveGridFunctionCheckpoint<GF>), grp, "", "gridFunction#filename",
+				"Writes the grid function to a checkpoint, which can be read with a different number of processes.");
+		reg.add_function("LoadGridFunctionCheckpoint", static_cast<void (*)(GF&, const char*)>
+				(&LoadGridFunctionCheckpoint<GF>), grp, "", "gridFunction#filename",
+				"Reads the grid function from a checkpoint written by SaveGridFunctionCheckpoint.");
+	}
+
 //	Move Domain by GridFunction
 	{
 		typedef ug::GridFunction<TDomain, TAlgebra> GF;
@@ -122,6 +122,8 @@ static void DomainAlgebra(Registry& reg, string grp)
 			.add_method("set_use_transposed", &T::set_use_transposed)
 			.add_method("enable_p1_lagrange_optimization", &T::enable_p1_lagrange_optimization)
 			.add_method("p1_lagrange_optimization_enabled", &T::p1_lagrange_optimization_enabled)
+			.add_method("enable_matrix_free", &T::enable_matrix_free)
+			.add_method("matrix_free_enabled", &T::matrix_free_enabled)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "StdTransfer", tag);
 	}
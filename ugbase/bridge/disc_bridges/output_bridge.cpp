@@ -268,6 +268,13 @@ static void Dimension(Registry& reg, string grp)
 			.add_method("select_element", static_cast<void (T::*)(SmartPtr<UserData<number, dim> >, const char*)>(&T::select_element))
 			.add_method("select_element", static_cast<void (T::*)(SmartPtr<UserData<MathVector<dim>, dim> >, const char*)>(&T::select_element))
 			.add_method("set_binary", &T::set_binary, "", "bBinary", "should values be printed in binary (base64 encoded way ) or plain ascii")
+			.add_method("set_appended", &T::set_appended, "", "bAppended", "should binary values be written raw to an appended data section instead of base64 encoded")
+			.add_method("set_compression_level", &T::set_compression_level, "", "level", "zlib compression level (0-9) of appended data. Requires -DZLIB=ON")
+			.add_method("set_async", &T::set_async, "", "bAsync", "should *.vtu files be written on a background thread")
+			.add_method("set_async_max_queued_bytes", &T::set_async_max_queued_bytes, "", "maxBytes", "maximal number of bytes queued for async output")
+			.add_method("flush", &T::flush, "", "", "waits until all queued *.vtu files have been written")
+			.add_method("set_single_file", &T::set_single_file, "", "bSingleFile", "should all processes write into one common *.vtu file (parallel only)")
+			.add_method("set_num_aggregators", &T::set_num_aggregators, "", "numAggregators", "number of processes writing to the file in single file mode (0: all)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "VTKOutput", tag);
 	}
@@ -47,6 +47,8 @@
 	#include "lib_grid/parallelization/load_balancer.h"
 	#include "lib_grid/parallelization/load_balancer_util.h"
 	#include "lib_grid/parallelization/partitioner_dynamic_bisection.h"
+	#include "lib_grid/parallelization/partitioner_space_filling_curve.h"
+	#include "lib_grid/parallelization/partition_quality_metrics.h"
 	#include "lib_grid/parallelization/balance_weights_ref_marks.h"
 	#include "lib_grid/parallelization/partition_post_processors/smooth_partition_bounds.h"
 	#include "lib_grid/parallelization/partition_post_processors/cluster_element_stacks.h"
@@ -110,6 +112,54 @@ namespace ug{
 			number						m_time;
 			LuaFunction<number, number>	m_callback;
 	};
+
+	template <class TDomain>
+	class ConnectionWeightsLuaCallback : public IConnectionWeights
+	{
+		public:
+			ConnectionWeightsLuaCallback(SmartPtr<TDomain> spDom, const char* luaCallbackName) :
+				m_spDom(spDom),
+				m_time(0)
+			{
+				m_pmg = spDom->grid().get();
+				m_aaPos = spDom->position_accessor();
+			//	we'll pass the following arguments: x, y, z, lvl, t
+			//	where (x, y, z) is the center of the connecting side.
+				m_callback.set_lua_callback(luaCallbackName, 5);
+			}
+
+			virtual ~ConnectionWeightsLuaCallback()	{}
+
+
+			void set_time(number time)	{m_time = time;}
+			number time() const			{return m_time;}
+
+			virtual number get_weight(Vertex* e)	{return	get_weight_impl(e);}
+			virtual number get_weight(Edge* e)		{return	get_weight_impl(e);}
+			virtual number get_weight(Face* e)		{return	get_weight_impl(e);}
+
+		private:
+			typedef typename TDomain::grid_type grid_t;
+			typedef typename TDomain::position_type pos_t;
+			typedef typename TDomain::position_accessor_type aapos_t;
+
+			template <class TElem>
+			number get_weight_impl(TElem* e)
+			{
+				pos_t c = CalculateCenter(e, m_aaPos);
+				vector3 p;
+				VecCopy(p, c, 0);
+				number weight;
+				m_callback(weight, 5, p.x(), p.y(), p.z(), (number)m_pmg->get_level(e), m_time);
+				return weight;
+			}
+
+			SmartPtr<TDomain>			m_spDom;
+			MultiGrid*					m_pmg;
+			aapos_t						m_aaPos;
+			number						m_time;
+			LuaFunction<number, number>	m_callback;
+	};
 #endif
 
 // end group loadbalance_bridge
@@ -153,6 +203,32 @@ static void RegisterDynamicBisectionPartitioner(
 	reg.add_class_to_group(name, clsGrpName, GetDomainTag<TDomain>());
 }
 
+template <class TDomain, class TPartitioner>
+static void RegisterSpaceFillingCurvePartitioner(
+	Registry& reg,
+	string name,
+	string grpName,
+	string clsGrpName)
+{
+	reg.add_class_<TPartitioner, IPartitioner>(name, grpName)
+		.template add_constructor<void (*)(TDomain&)>()
+		.add_method("set_subset_handler",
+			&TPartitioner::set_subset_handler)
+		.add_method("enable_hilbert_curve",
+			&TPartitioner::enable_hilbert_curve)
+		.add_method("hilbert_curve_enabled",
+			&TPartitioner::hilbert_curve_enabled)
+		.add_method("set_num_histogram_buckets",
+			&TPartitioner::set_num_histogram_buckets)
+		.add_method("num_histogram_buckets",
+			&TPartitioner::num_histogram_buckets)
+		.add_method("set_tolerance",
+			&TPartitioner::set_tolerance)
+		.set_construct_as_smart_pointer(true);
+
+	reg.add_class_to_group(name, clsGrpName, GetDomainTag<TDomain>());
+}
+
 template <class TDomain, class elem_t>
 static void RegisterSmoothPartitionBounds(
 	Registry& reg,
@@ -218,6 +294,38 @@ static void Common(Registry& reg, string grp) {
 		reg.add_class_<IBalanceWeights>("IBalanceWeights", grp);
 	}
 
+	{
+		reg.add_class_<IConnectionWeights>("IConnectionWeights", grp);
+	}
+
+	{
+		typedef StdConnectionWeights	T;
+		reg.add_class_<T, IConnectionWeights>("StdConnectionWeights", grp)
+			.add_constructor()
+			.add_constructor<void (*)(number)>()
+			.add_method("set_weight", &T::set_weight)
+			.set_construct_as_smart_pointer(true);
+	}
+
+	{
+		typedef PartitionQualityMetrics	T;
+		reg.add_class_<T>("PartitionQualityMetrics", grp)
+			.add_constructor()
+			.add_method("update", &T::update)
+			.add_method("num_levels", &T::num_levels)
+			.add_method("num_procs", &T::num_procs)
+			.add_method("min_value", &T::min_value)
+			.add_method("max_value", &T::max_value)
+			.add_method("total_value", &T::total_value)
+			.add_method("avg_value", &T::avg_value)
+			.add_method("local_value", &T::local_value)
+			.add_method("imbalance", &T::imbalance)
+			.add_method("to_string", &T::to_string)
+			.add_method("write_csv", &T::write_csv)
+			.add_method("write_json", &T::write_json)
+			.set_construct_as_smart_pointer(true);
+	}
+
 	{
 		string name("BalanceWeightsRefMarks");
 		typedef BalanceWeightsRefMarks	T;
@@ -239,7 +347,9 @@ static void Common(Registry& reg, string grp) {
 			.add_method("set_next_process_hierarchy", &T::set_next_process_hierarchy)
 			.add_method("enable_clustered_siblings", &T::enable_clustered_siblings)
 			.add_method("clustered_siblings_enabled", &T::clustered_siblings_enabled)
-			.add_method("set_partition_post_processor", &T::set_partition_post_processor);
+			.add_method("set_partition_post_processor", &T::set_partition_post_processor)
+			.add_method("set_connection_weights", &T::set_connection_weights)
+			.add_method("supports_connection_weights", &T::supports_connection_weights);
 	}
 
 	{
@@ -253,11 +363,14 @@ static void Common(Registry& reg, string grp) {
 				.add_method("rebalance", &T::rebalance)
 				.add_method("set_balance_threshold", &T::set_balance_threshold)
 				.add_method("set_element_threshold", &T::set_element_threshold)
+				.add_method("set_max_redistribution_buffer_size", &T::set_max_redistribution_buffer_size)
+				.add_method("last_redistribution_statistics", &T::last_redistribution_statistics_string)
 				.add_method("set_partitioner", &T::set_partitioner)
 				.add_method("create_quality_record", &T::create_quality_record)
 				.add_method("print_quality_records", &T::print_quality_records)
 				.add_method("estimate_distribution_quality", static_cast<number (T::*)()>(&T::estimate_distribution_quality))
 				.add_method("set_balance_weights", &T::set_balance_weights)
+				.add_method("set_connection_weights", &T::set_connection_weights)
 				.add_method("problems_occurred", &T::problems_occurred);
 	}
 
@@ -272,6 +385,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterSpaceFillingCurvePartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SpaceFillingCurve<Edge, 1> > >(
+			reg,
+			"EdgePartitioner_SpaceFillingCurve1d",
+			grp,
+			"Partitioner_SpaceFillingCurve");
+
 
 		RegisterSmoothPartitionBounds<TDomain, Edge>(
 			reg,
@@ -306,6 +427,22 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterSpaceFillingCurvePartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SpaceFillingCurve<Edge, 2> > >(
+			reg,
+			"EdgePartitioner_SpaceFillingCurve2d",
+			grp,
+			"ManifoldPartitioner_SpaceFillingCurve");
+
+		RegisterSpaceFillingCurvePartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SpaceFillingCurve<Face, 2> > >(
+			reg,
+			"FacePartitioner_SpaceFillingCurve2d",
+			grp,
+			"Partitioner_SpaceFillingCurve");
+
 		RegisterSmoothPartitionBounds<TDomain, Face>(
 			reg,
 			"SmoothPartitionBounds2d",
@@ -347,6 +484,30 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterSpaceFillingCurvePartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SpaceFillingCurve<Edge, 3> > >(
+			reg,
+			"EdgePartitioner_SpaceFillingCurve3d",
+			grp,
+			"HyperManifoldPartitioner_SpaceFillingCurve");
+
+		RegisterSpaceFillingCurvePartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SpaceFillingCurve<Face, 3> > >(
+			reg,
+			"FacePartitioner_SpaceFillingCurve3d",
+			grp,
+			"ManifoldPartitioner_SpaceFillingCurve");
+
+		RegisterSpaceFillingCurvePartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SpaceFillingCurve<Volume, 3> > >(
+			reg,
+			"VolumePartitioner_SpaceFillingCurve3d",
+			grp,
+			"Partitioner_SpaceFillingCurve");
+
 		RegisterSmoothPartitionBounds<TDomain, Volume>(
 			reg,
 			"SmoothPartitionBounds3d",
@@ -487,6 +648,29 @@ static void Domain(Registry& reg, string grp)
 			reg.add_class_to_group(name, "AnisotropicBalanceWeights", tag);
 		}
 
+		{
+			typedef DomainCommunicationCostWeights<TDomain, AnisotropicConnectionWeights<TDomain::dim> > T;
+			string name = string("AnisotropicConnectionWeights").append(suffix);
+			reg.add_class_<T, IConnectionWeights>(name, grp)
+				.template add_constructor<void (*)(TDomain&)>()
+				.add_method("set_weight_factor", &T::set_weight_factor)
+				.add_method("weight_factor", &T::weight_factor)
+				.set_construct_as_smart_pointer(true);
+			reg.add_class_to_group(name, "AnisotropicConnectionWeights", tag);
+		}
+
+		{
+			typedef ConnectionWeightsLuaCallback<TDomain> T;
+			string name = string("ConnectionWeightsLuaCallback").append(suffix);
+			reg.add_class_<T, IConnectionWeights>(name, grp)
+				.template add_constructor<void (*)(SmartPtr<TDomain> spDom,
+												   const char* luaCallbackName)>()
+				.add_method("set_time", &T::set_time)
+				.add_method("time", &T::time)
+				.set_construct_as_smart_pointer(true);
+			reg.add_class_to_group(name, "ConnectionWeightsLuaCallback", tag);
+		}
+
 		{
 			typedef BalanceWeightsLuaCallback<TDomain> T;
 			string name = string("BalanceWeightsLuaCallback").append(suffix);
@@ -526,6 +710,23 @@ static void Domain(Registry& reg, string grp)
 						 "maxNumRedistProcs, maxNumProcs, minDistLvl, "
 						 "maxLvlsWithoutRedist, refiner");
 
+		reg.add_function("CreateAgglomeratingProcessHierarchy",
+						 static_cast<SPProcessHierarchy (*)(TDomain&, size_t,
+						 									size_t, int)>
+						 	(&CreateAgglomeratingProcessHierarchy<TDomain>),
+						 grp, "ProcessHierarchy", "Domain, minNumElemsPerProc, "
+						 "maxNumProcs, minDistLvl",
+						 "Reduces the number of active processes on coarse levels "
+						 "as long as each would hold less than minNumElemsPerProc elements.");
+		reg.add_function("CreateAgglomeratingProcessHierarchy",
+						 static_cast<SPProcessHierarchy (*)(TDomain&, size_t,
+						 									size_t, int, IRefiner*)>
+						 	(&CreateAgglomeratingProcessHierarchy<TDomain>),
+						 grp, "ProcessHierarchy", "Domain, minNumElemsPerProc, "
+						 "maxNumProcs, minDistLvl, refiner",
+						 "Reduces the number of active processes on coarse levels "
+						 "as long as each would hold less than minNumElemsPerProc elements.");
+
 	#endif
 }
 
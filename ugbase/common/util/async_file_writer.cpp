@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "async_file_writer.h"
+#include <fstream>
+#include "common/error.h"
+#include "common/profiler/profiler.h"
+
+using namespace std;
+
+namespace ug {
+
+AsyncFileWriter::AsyncFileWriter(size_t maxQueuedBytes) :
+	m_queuedBytes(0),
+	m_maxQueuedBytes(maxQueuedBytes),
+	m_numWrittenFiles(0)
+#ifdef UG_POSIX
+	,m_threadStarted(false),
+	m_stop(false),
+	m_busy(false)
+#endif
+{
+#ifdef UG_POSIX
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_condQueueChanged, NULL);
+#endif
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+#ifdef UG_POSIX
+	pthread_mutex_lock(&m_mutex);
+	m_stop = true;
+	pthread_cond_broadcast(&m_condQueueChanged);
+	pthread_mutex_unlock(&m_mutex);
+
+//	the thread writes all queued files before it terminates
+	if(m_threadStarted)
+		pthread_join(m_thread, NULL);
+
+	pthread_cond_destroy(&m_condQueueChanged);
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+void AsyncFileWriter::set_max_queued_bytes(size_t maxBytes)
+{
+	m_maxQueuedBytes = maxBytes;
+}
+
+void AsyncFileWriter::write_file(const FileEntry& entry)
+{
+	ofstream out(entry.first.c_str(), ios_base::out | ios_base::trunc | ios_base::binary);
+	UG_COND_THROW(!out, "AsyncFileWriter: Couldn't open file " << entry.first);
+	out.write(entry.second.c_str(), entry.second.size());
+	UG_COND_THROW(!out, "AsyncFileWriter: Couldn't write to file " << entry.first);
+}
+
+void AsyncFileWriter::rethrow_error()
+{
+	if(!m_error.empty()){
+		string err;
+		err.swap(m_error);
+		UG_THROW(err);
+	}
+}
+
+#ifdef UG_POSIX
+
+void AsyncFileWriter::write(const std::string& filename, std::string& content)
+{
+	PROFILE_FUNC();
+
+	pthread_mutex_lock(&m_mutex);
+
+	if(!m_threadStarted){
+		if(pthread_create(&m_thread, NULL, &AsyncFileWriter::thread_func, this) != 0){
+			pthread_mutex_unlock(&m_mutex);
+			UG_THROW("AsyncFileWriter: Couldn't create background thread.");
+		}
+		m_threadStarted = true;
+	}
+
+//	back-pressure: wait until the queue has room for the new content
+	while(!m_queue.empty()
+		  && (m_queuedBytes + content.size() > m_maxQueuedBytes)
+		  && m_error.empty())
+	{
+		pthread_cond_wait(&m_condQueueChanged, &m_mutex);
+	}
+
+	if(!m_error.empty()){
+		pthread_mutex_unlock(&m_mutex);
+		rethrow_error();
+	}
+
+	m_queue.push_back(FileEntry(filename, string()));
+	m_queue.back().second.swap(content);
+	m_queuedBytes += m_queue.back().second.size();
+
+	pthread_cond_broadcast(&m_condQueueChanged);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void AsyncFileWriter::flush()
+{
+	PROFILE_FUNC();
+
+	pthread_mutex_lock(&m_mutex);
+	while((!m_queue.empty() || m_busy) && m_error.empty())
+		pthread_cond_wait(&m_condQueueChanged, &m_mutex);
+	pthread_mutex_unlock(&m_mutex);
+
+	rethrow_error();
+}
+
+void* AsyncFileWriter::thread_func(void* writer)
+{
+	static_cast<AsyncFileWriter*>(writer)->run();
+	return NULL;
+}
+
+void AsyncFileWriter::run()
+{
+	pthread_mutex_lock(&m_mutex);
+	while(1){
+		while(m_queue.empty() && !m_stop)
+			pthread_cond_wait(&m_condQueueChanged, &m_mutex);
+
+		if(m_queue.empty())
+			break;
+
+	//	the entry stays in the queue while it is written, so that its size
+	//	still counts towards the queued bytes.
+		FileEntry& entry = m_queue.front();
+		m_busy = true;
+		pthread_mutex_unlock(&m_mutex);
+
+		string error;
+		try{
+			write_file(entry);
+		}
+		catch(UGError& err){
+			error = err.get_msg();
+		}
+
+		pthread_mutex_lock(&m_mutex);
+		m_busy = false;
+		if(!error.empty() && m_error.empty())
+			m_error = error;
+		m_queuedBytes -= entry.second.size();
+		m_queue.pop_front();
+		++m_numWrittenFiles;
+		pthread_cond_broadcast(&m_condQueueChanged);
+	}
+	pthread_mutex_unlock(&m_mutex);
+}
+
+#else
+
+void AsyncFileWriter::write(const std::string& filename, std::string& content)
+{
+	PROFILE_FUNC();
+	FileEntry entry(filename, string());
+	entry.second.swap(content);
+	write_file(entry);
+	++m_numWrittenFiles;
+}
+
+void AsyncFileWriter::flush()
+{
+}
+
+#endif
+
+} // namespace: ug
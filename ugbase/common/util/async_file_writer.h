@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__UTIL__ASYNC_FILE_WRITER__
+#define __H__UG__COMMON__UTIL__ASYNC_FILE_WRITER__
+
+#include <deque>
+#include <string>
+#include <utility>
+
+#ifdef UG_POSIX
+	#include <pthread.h>
+#endif
+
+namespace ug {
+
+/// \addtogroup ugbase_common_io
+/// \{
+
+///	Writes files on a background thread
+/**	Files are passed to the writer as a pair of filename and content. The
+ * content is written on a background thread, so that the calling thread
+ * may continue immediately.
+ *
+ * The total size of queued contents is bounded by max_queued_bytes. If a new
+ * file would exceed this bound, write blocks until enough queued files have
+ * been written (at least one file is always accepted).
+ *
+ * Errors which occur on the background thread are rethrown by the next call
+ * to write or flush. The destructor waits until all queued files have been
+ * written.
+ *
+ * \note	Background writing requires POSIX threads (UG_POSIX). If those are not
+ *			available, files are written directly in write.
+ */
+class AsyncFileWriter {
+	public:
+		AsyncFileWriter(size_t maxQueuedBytes = 256 * 1024 * 1024);
+		~AsyncFileWriter();
+
+	///	queues the given content for writing to the given file.
+	/**	The contents of 'content' are swapped into the queue, i.e. 'content'
+	 * is empty when the method returns.
+	 * \throws UGError if an error occurred while writing a previous file.*/
+		void write(const std::string& filename, std::string& content);
+
+	///	waits until all queued files have been written
+	/**	\throws UGError if an error occurred while writing a queued file.*/
+		void flush();
+
+		void set_max_queued_bytes(size_t maxBytes);
+		size_t max_queued_bytes() const		{return m_maxQueuedBytes;}
+
+	///	number of files which have been written so far
+		size_t num_written_files() const	{return m_numWrittenFiles;}
+
+	private:
+		typedef std::pair<std::string, std::string>	FileEntry;
+
+		AsyncFileWriter(const AsyncFileWriter&);
+		AsyncFileWriter& operator=(const AsyncFileWriter&);
+
+		static void write_file(const FileEntry& entry);
+		void rethrow_error();
+
+		std::deque<FileEntry>	m_queue;
+		size_t					m_queuedBytes;
+		size_t					m_maxQueuedBytes;
+		size_t					m_numWrittenFiles;
+		std::string				m_error;
+
+	#ifdef UG_POSIX
+		static void* thread_func(void* writer);
+		void run();
+
+		pthread_t		m_thread;
+		pthread_mutex_t	m_mutex;
+		pthread_cond_t	m_condQueueChanged;
+		bool			m_threadStarted;
+		bool			m_stop;
+		bool			m_busy;
+	#endif
+};
+
+// end group ugbase_common_io
+/// \}
+
+} // namespace: ug
+
+#endif // __H__UG__COMMON__UTIL__ASYNC_FILE_WRITER__
@@ -32,12 +32,19 @@
 
 #include "common/util/base64_file_writer.h"
 
+#include <algorithm>
+#include <cstring>
+
 // for base64 encoding with boost
 #include <boost/archive/iterators/transform_width.hpp>
 #include <boost/archive/iterators/base64_from_binary.hpp>
 #include <boost/archive/iterators/ostream_iterator.hpp>
 //#include <boost/filesystem.hpp>
 
+#ifdef UG_ZLIB
+	#include <zlib.h>
+#endif
+
 // debug includes!!
 #include "common/profiler/profiler.h"
 #include "common/error.h"
@@ -76,6 +83,10 @@ Base64FileWriter& Base64FileWriter::operator<<(const fmtflag format)
 	if (format != m_currFormat && m_numBytesWritten > 0) {
 		flushInputBuffer(true);
 	}
+	// leaving binary format finishes the current appended block
+	if (format != m_currFormat && m_currFormat == base64_binary && m_bAppended) {
+		finishAppendedBlock();
+	}
 	m_currFormat = format;
 	return *this;
 }
@@ -131,7 +142,10 @@ Base64FileWriter::Base64FileWriter() :
 	m_currFormat(base64_ascii),
 	m_inBuffer(ios_base::binary | ios_base::out | ios_base::in),
 	m_lastInputByteSize(0),
-	m_numBytesWritten(0)
+	m_numBytesWritten(0),
+	m_pOut(&m_fStream),
+	m_bAppended(false),
+	m_compressionLevel(0)
 {}
 
 Base64FileWriter::Base64FileWriter(const char* filename,
@@ -139,7 +153,10 @@ Base64FileWriter::Base64FileWriter(const char* filename,
 	m_currFormat(base64_ascii),
 	m_inBuffer(ios_base::binary | ios_base::out | ios_base::in),
 	m_lastInputByteSize(0),
-	m_numBytesWritten(0)
+	m_numBytesWritten(0),
+	m_pOut(&m_fStream),
+	m_bAppended(false),
+	m_compressionLevel(0)
 {
 	PROFILE_FUNC();
 
@@ -165,6 +182,7 @@ void Base64FileWriter::open(const char *filename,
 	}
 	*/
 
+	m_pOut = &m_fStream;
 	m_fStream.open(filename, mode);
 	if (!m_fStream.is_open()) {
 		UG_THROW( "Could not open output file: " << filename);
@@ -195,6 +213,11 @@ void Base64FileWriter::dispatch(const T& value)
 			flushInputBuffer();
 			break;
 		case base64_binary: {
+			if (m_bAppended) {
+				const char* p = reinterpret_cast<const char*>(&value);
+				m_appendedBlock.insert(m_appendedBlock.end(), p, p + sizeof(T));
+				break;
+			}
 			// write the value in binary mode to the input buffer
 			UG_ASSERT(m_inBuffer.good(), "can not write to buffer")
 			m_inBuffer.write(reinterpret_cast<const char*>(&value), sizeof(T));
@@ -208,13 +231,15 @@ void Base64FileWriter::dispatch(const T& value)
 		}
 		case normal:
 			// nothing to do here, almost
-			m_fStream << value;
+			*m_pOut << value;
 			break;
 	}
 }
 
 inline void Base64FileWriter::assertFileOpen()
 {
+	if (m_pOut == &m_memStream)
+		return;
 	if (m_fStream.bad() || !m_fStream.is_open()) {
 		UG_THROW( "File stream is not open." );
 	}
@@ -263,7 +288,7 @@ void Base64FileWriter::flushInputBuffer(bool force)
 
 		// encode buff in base64
 		copy(base64_text(buff), base64_text(buff + buff_len),
-				boost::archive::iterators::ostream_iterator<char>(m_fStream));
+				boost::archive::iterators::ostream_iterator<char>(*m_pOut));
 	}
 
 	size_t rest_len = m_numBytesWritten - buff_len;
@@ -299,7 +324,7 @@ void Base64FileWriter::flushInputBuffer(bool force)
 
 	if (force) {
 		for(uint i = 0; i < paddChars; ++i)
-			m_fStream << '=';
+			*m_pOut << '=';
 
 		// resetting num bytes written and bytes in block
 		m_numBytesWritten = 0;
@@ -309,6 +334,125 @@ void Base64FileWriter::flushInputBuffer(bool force)
 	}
 }
 
+void Base64FileWriter::open_memory()
+{
+	m_pOut = &m_memStream;
+	m_memStream.str("");
+}
+
+void Base64FileWriter::release_memory_content(std::string& contentOut)
+{
+	UG_COND_THROW(m_pOut != &m_memStream,
+				  "Base64FileWriter::release_memory_content: writer isn't in memory mode.");
+	flushInputBuffer(true);
+	contentOut = m_memStream.str();
+	m_memStream.str("");
+}
+
+void Base64FileWriter::enable_appended_data(bool enable)
+{
+	if (m_bAppended && !enable && m_currFormat == base64_binary)
+		finishAppendedBlock();
+	m_bAppended = enable;
+}
+
+bool Base64FileWriter::appended_data_enabled() const
+{
+	return m_bAppended;
+}
+
+void Base64FileWriter::set_compression_level(int level)
+{
+#ifdef UG_ZLIB
+	UG_COND_THROW(level < 0 || level > 9,
+				  "Base64FileWriter: compression level has to be in [0, 9], but is " << level);
+#else
+	UG_COND_THROW(level != 0,
+				  "Base64FileWriter: compression requires zlib support. Please "
+				  "recompile ug with -DZLIB=ON.");
+#endif
+	m_compressionLevel = level;
+}
+
+int Base64FileWriter::compression_level() const
+{
+	return m_compressionLevel;
+}
+
+size_t Base64FileWriter::appended_data_offset() const
+{
+	return m_appendedData.size();
+}
+
+void Base64FileWriter::write_appended_data()
+{
+	PROFILE_FUNC();
+	assertFileOpen();
+
+	if (m_currFormat == base64_binary)
+		finishAppendedBlock();
+	*this << normal;
+
+	if (!m_appendedData.empty())
+		m_pOut->write(&m_appendedData[0], m_appendedData.size());
+
+	// free the memory of the collected data
+	std::vector<char>().swap(m_appendedData);
+}
+
+void Base64FileWriter::finishAppendedBlock()
+{
+	if (m_appendedBlock.empty())
+		return;
+
+	if (m_compressionLevel == 0) {
+		m_appendedData.insert(m_appendedData.end(),
+							  m_appendedBlock.begin(), m_appendedBlock.end());
+		m_appendedBlock.clear();
+		return;
+	}
+
+#ifdef UG_ZLIB
+	typedef unsigned int header_t;
+	const size_t chunkSize = 32768;
+
+	UG_COND_THROW(m_appendedBlock.size() < sizeof(int),
+				  "Base64FileWriter: appended block too small to contain a header.");
+
+	const Bytef* data = reinterpret_cast<const Bytef*>(&m_appendedBlock[0] + sizeof(int));
+	const size_t dataSize = m_appendedBlock.size() - sizeof(int);
+	const size_t numChunks = (dataSize + chunkSize - 1) / chunkSize;
+
+	// reserve space for the header. Compressed sizes are written afterwards.
+	const size_t headerPos = m_appendedData.size();
+	const size_t headerSize = (3 + numChunks) * sizeof(header_t);
+	m_appendedData.resize(headerPos + headerSize);
+
+	std::vector<header_t> header(3 + numChunks);
+	header[0] = (header_t)numChunks;
+	header[1] = (header_t)chunkSize;
+	header[2] = (header_t)(dataSize % chunkSize);
+
+	for (size_t i = 0; i < numChunks; ++i) {
+		const size_t srcSize = std::min(chunkSize, dataSize - i * chunkSize);
+		uLongf destSize = compressBound(srcSize);
+		const size_t destPos = m_appendedData.size();
+		m_appendedData.resize(destPos + destSize);
+
+		int err = compress2(reinterpret_cast<Bytef*>(&m_appendedData[destPos]), &destSize,
+							data + i * chunkSize, srcSize, m_compressionLevel);
+		UG_COND_THROW(err != Z_OK, "Base64FileWriter: zlib compression failed with error " << err);
+
+		m_appendedData.resize(destPos + destSize);
+		header[3 + i] = (header_t)destSize;
+	}
+
+	memcpy(&m_appendedData[headerPos], &header[0], headerSize);
+#endif
+
+	m_appendedBlock.clear();
+}
+
 void Base64FileWriter::close()
 {
 	PROFILE_FUNC();
@@ -317,6 +461,8 @@ void Base64FileWriter::close()
 	flushInputBuffer(true);
 
 	// only when this is done, close the file stream
+	if (m_pOut == &m_memStream)
+		return;
 	m_fStream.close();
 	UG_ASSERT(m_fStream.good(), "could not close output file.");
 }
@@ -35,6 +35,7 @@
 
 #include <sstream>
 #include <fstream>
+#include <string>
 #include <vector>
 
 namespace ug {
@@ -67,6 +68,10 @@ namespace ug {
  *   \code{.cpp}
  *     writer << Base64FileWriter::base64_binary << "and back to base64 encoding!";
  *   \endcode
+ *   Instead of being encoded, binary data can also be collected in raw form,
+ *   e.g. for the appended data section of VTK XML files. See
+ *   Base64FileWriter::enable_appended_data.
+ *
  *   To finish off writing, just close the writer:
  *   \code{.cpp}
  *   writer.close();
@@ -112,6 +117,20 @@ public:
 	void open(const char *filename,
 			const std::ios_base::openmode mode = std::ios_base::out );
 
+	/**
+	 * \brief Writes all data to memory instead of a file
+	 * \details The written content can be retrieved through
+	 *   release_memory_content. This is e.g. used to create files in memory
+	 *   which are then written by a background thread.
+	 */
+	void open_memory();
+
+	/**
+	 * \brief Moves the content written in memory mode to the given string
+	 * \throws UGError if the writer wasn't opened through open_memory
+	 */
+	void release_memory_content(std::string& contentOut);
+
 	/**
 	 * \brief gets the current set format
 	 */
@@ -122,6 +141,52 @@ public:
 	 */
 	void close();
 
+	/**
+	 * \brief Enables collection of binary data for appended output
+	 * \details If enabled, data written in Base64FileWriter::base64_binary format
+	 *   is neither encoded nor written to the file directly. Instead it is
+	 *   collected in raw form. Each consecutive sequence of binary data forms a
+	 *   block. The offset of the next block in the collected data is returned by
+	 *   appended_data_offset. Collected data is written to the file through
+	 *   write_appended_data.
+	 *
+	 *   Each block has to start with an int which holds the number of data bytes
+	 *   of the block, as is required by the VTK binary format.
+	 */
+	void enable_appended_data(bool enable);
+
+	/**
+	 * \brief Returns whether binary data is collected for appended output
+	 */
+	bool appended_data_enabled() const;
+
+	/**
+	 * \brief Enables zlib compression of appended blocks
+	 * \details Each block is split into chunks of 32KB which are compressed
+	 *   separately. The leading int of a block is replaced by a header holding the
+	 *   number of chunks, the uncompressed chunk size, the size of the last
+	 *   partial chunk and the compressed size of each chunk
+	 *   (the layout of vtkZLibDataCompressor).
+	 * \param level compression level between 0 (no compression) and 9.
+	 * \throws UGError if level > 0 and ug was compiled without zlib support.
+	 */
+	void set_compression_level(int level);
+
+	/**
+	 * \brief Returns the compression level of appended blocks (0: no compression)
+	 */
+	int compression_level() const;
+
+	/**
+	 * \brief Returns the offset in bytes at which the next appended block will start
+	 */
+	size_t appended_data_offset() const;
+
+	/**
+	 * \brief Writes all collected appended data to the file and clears it
+	 */
+	void write_appended_data();
+
 	/**
 	 * \brief Switch between normal and base64 encoded output
 	 * \param format one of the values defined in Base64FileWriter::fmtflag
@@ -178,6 +243,40 @@ private:
 	 */
 	size_t m_numBytesWritten;
 
+	/**
+	 * \brief Stream which is used in memory mode
+	 */
+	std::ostringstream m_memStream;
+	/**
+	 * \brief Stream to which everything is written (m_fStream or m_memStream)
+	 */
+	std::ostream* m_pOut;
+
+	/**
+	 * \brief Whether binary data is collected for appended output
+	 */
+	bool m_bAppended;
+
+	/**
+	 * \brief Compression level of appended blocks
+	 */
+	int m_compressionLevel;
+
+	/**
+	 * \brief Raw data of the current appended block
+	 */
+	std::vector<char> m_appendedBlock;
+
+	/**
+	 * \brief Collected (possibly compressed) appended blocks
+	 */
+	std::vector<char> m_appendedData;
+
+	/**
+	 * \brief Moves the current block to the appended data (compressing it if required)
+	 */
+	void finishAppendedBlock();
+
 	/**
 	 * \brief Flushes input buffer
 	 * \param force whether to forcefully flush the buffer
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "mapped_file.h"
+#include <fstream>
+#include "common/error.h"
+
+#ifdef UG_POSIX
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace ug {
+
+MappedFile::MappedFile() :
+	m_data(NULL),
+	m_size(0),
+	m_bMapped(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+void MappedFile::open(const char* filename)
+{
+	close();
+
+#ifdef UG_POSIX
+	int fd = ::open(filename, O_RDONLY);
+	UG_COND_THROW(fd < 0, "MappedFile: Couldn't open file " << filename);
+
+	struct stat st;
+	if(fstat(fd, &st) != 0){
+		::close(fd);
+		UG_THROW("MappedFile: Couldn't determine size of file " << filename);
+	}
+
+	m_size = (size_t)st.st_size;
+	if(m_size > 0){
+		void* p = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		UG_COND_THROW(p == MAP_FAILED, "MappedFile: Couldn't map file " << filename);
+		m_data = static_cast<const char*>(p);
+		m_bMapped = true;
+	}
+	else{
+		::close(fd);
+	//	use the (empty) buffer, so that is_open returns true
+		m_buffer.resize(1);
+		m_data = reinterpret_cast<const char*>(&m_buffer.front());
+	}
+#else
+	ifstream in(filename, ios::in | ios::binary);
+	UG_COND_THROW(!in, "MappedFile: Couldn't open file " << filename);
+
+	in.seekg(0, ios::end);
+	m_size = (size_t)in.tellg();
+	in.seekg(0, ios::beg);
+
+	m_buffer.resize(m_size / sizeof(double) + 1);
+	in.read(reinterpret_cast<char*>(&m_buffer.front()), m_size);
+	UG_COND_THROW(!in, "MappedFile: Couldn't read file " << filename);
+	m_data = reinterpret_cast<const char*>(&m_buffer.front());
+#endif
+}
+
+void MappedFile::close()
+{
+#ifdef UG_POSIX
+	if(m_bMapped)
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+	m_data = NULL;
+	m_size = 0;
+	m_bMapped = false;
+	m_buffer.clear();
+}
+
+} // namespace: ug
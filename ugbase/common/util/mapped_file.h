@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__UTIL__MAPPED_FILE__
+#define __H__UG__COMMON__UTIL__MAPPED_FILE__
+
+#include <cstddef>
+#include <vector>
+
+namespace ug {
+
+/// \addtogroup ugbase_common_io
+/// \{
+
+///	Provides read-only access to the contents of a file through a memory mapping
+/**	If POSIX is available (UG_POSIX), the file is mapped into memory through
+ * mmap, so that its contents are only read from disk when they are accessed.
+ * Otherwise the whole file is read into an internal buffer.
+ *
+ * The returned data is aligned to at least 8 bytes.
+ */
+class MappedFile {
+	public:
+		MappedFile();
+		~MappedFile();
+
+	///	maps the given file. Previously mapped files are released.
+	/**	\throws UGError if the file can't be opened or mapped.*/
+		void open(const char* filename);
+
+	///	releases the mapped file
+		void close();
+
+		bool is_open() const		{return m_data != NULL;}
+		const char* data() const	{return m_data;}
+		size_t size() const			{return m_size;}
+
+	private:
+		MappedFile(const MappedFile&);
+		MappedFile& operator=(const MappedFile&);
+
+		const char*			m_data;
+		size_t				m_size;
+		bool				m_bMapped;
+		std::vector<double>	m_buffer;///< fallback storage (double for alignment)
+};
+
+// end group ugbase_common_io
+/// \}
+
+} // namespace: ug
+
+#endif // __H__UG__COMMON__UTIL__MAPPED_FILE__
@@ -34,6 +34,8 @@
 #define __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 namespace ug
 {
 
@@ -222,6 +224,194 @@ void diag_step(const Matrix_type& A, Vector_type& c, const Vector_type& d, numbe
 }
 
 
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	ComputeMulticoloring
+/**
+ * \brief Computes a greedy coloring of the graph of \f$A + A^T\f$.
+ * No two rows of the same color are coupled in A. Thus all rows of a color
+ * can be relaxed concurrently in a Gauss-Seidel sweep.
+ *
+ * \param A			the matrix
+ * \param color		color[i] is the color of row i
+ * \param colorStart	the rows of color k are colorRows[colorStart[k]], ..., colorRows[colorStart[k+1]-1]
+ * \param colorRows	row indices sorted by color, ascending within each color
+ * \return			number of colors
+ */
+template<typename Matrix_type>
+size_t ComputeMulticoloring(const Matrix_type &A, std::vector<int> &color,
+                            std::vector<size_t> &colorStart, std::vector<size_t> &colorRows)
+{
+	const size_t n = A.num_rows();
+	const size_t invalid = (size_t)-1;
+
+	// pattern of the transposed matrix
+	std::vector<size_t> tStart(n+1, 0);
+	for(size_t i = 0; i < n; i++)
+		for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			if(it.index() != i) tStart[it.index()+1]++;
+	for(size_t i = 0; i < n; i++)
+		tStart[i+1] += tStart[i];
+
+	std::vector<size_t> tRows(tStart[n]);
+	{
+		std::vector<size_t> cursor(tStart.begin(), tStart.end()-1);
+		for(size_t i = 0; i < n; i++)
+			for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				if(it.index() != i) tRows[cursor[it.index()]++] = i;
+	}
+
+	// greedy coloring: mark[k] == i if color k is used by a neighbor of i
+	color.assign(n, -1);
+	std::vector<size_t> mark;
+	size_t numColors = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			if(it.index() != i && color[it.index()] >= 0)
+				mark[color[it.index()]] = i;
+		for(size_t q = tStart[i]; q < tStart[i+1]; q++)
+			if(color[tRows[q]] >= 0)
+				mark[color[tRows[q]]] = i;
+
+		size_t k = 0;
+		while(k < numColors && mark[k] == i) k++;
+		if(k == numColors)
+		{
+			mark.push_back(invalid);
+			numColors++;
+		}
+		color[i] = (int)k;
+	}
+
+	colorStart.assign(numColors+1, 0);
+	for(size_t i = 0; i < n; i++)
+		colorStart[color[i]+1]++;
+	for(size_t k = 0; k < numColors; k++)
+		colorStart[k+1] += colorStart[k];
+
+	colorRows.resize(n);
+	std::vector<size_t> cursor(colorStart.begin(), colorStart.end()-1);
+	for(size_t i = 0; i < n; i++)
+		colorRows[cursor[color[i]]++] = i;
+
+	return numColors;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	mc_gs_step_LL
+/**
+ * \brief Performs a forward gauss-seidel-step in multicolor ordering.
+ * The rows are relaxed color by color, where row i uses the corrections of all
+ * rows with a smaller color. Since rows of the same color are not coupled, the
+ * rows of one color are relaxed in parallel if UG_OPENMP is defined.
+ *
+ * \param A Matrix \f$A = D - L - U\f$, where L is the part coupling to smaller colors
+ * \param c Vector. \f$ c = N * d = (D-L)^{-1} * d \f$
+ * \param d Vector d.
+ * \param color, colorStart, colorRows	coloring as computed by ComputeMulticoloring
+ * \sa mc_gs_step_UR, mc_sgs_step
+ */
+template<typename Matrix_type, typename Vector_type>
+void mc_gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                   const std::vector<int> &color, const std::vector<size_t> &colorStart,
+                   const std::vector<size_t> &colorRows)
+{
+	for(size_t k = 0; k + 1 < colorStart.size(); k++)
+	{
+		const long begin = (long)colorStart[k], end = (long)colorStart[k+1];
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static)
+#endif
+		for(long q = begin; q < end; q++)
+		{
+			const size_t i = colorRows[q];
+			typename Vector_type::value_type s = d[i];
+
+			for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				if(color[it.index()] < (int)k)
+					// s -= it.value() * c[it.index()];
+					MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
+
+			// c[i] = relaxFactor * s/A(i,i)
+			InverseMatMult(c[i], relaxFactor, A(i,i), s);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	mc_gs_step_UR
+/**
+ * \brief Performs a backward gauss-seidel-step in multicolor ordering.
+ * The colors are processed in reverse order, row i uses the corrections of all
+ * rows with a larger color.
+ *
+ * \param A Matrix \f$A = D - L - U\f$, where U is the part coupling to larger colors
+ * \param c will be \f$c = N * d = (D-U)^{-1} * d \f$
+ * \param d the vector d. May be the same as c.
+ * \param color, colorStart, colorRows	coloring as computed by ComputeMulticoloring
+ * \sa mc_gs_step_LL, mc_sgs_step
+ */
+template<typename Matrix_type, typename Vector_type>
+void mc_gs_step_UR(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                   const std::vector<int> &color, const std::vector<size_t> &colorStart,
+                   const std::vector<size_t> &colorRows)
+{
+	for(size_t k = colorStart.size(); k-- > 1;)
+	{
+		const long begin = (long)colorStart[k-1], end = (long)colorStart[k];
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static)
+#endif
+		for(long q = begin; q < end; q++)
+		{
+			const size_t i = colorRows[q];
+			typename Vector_type::value_type s = d[i];
+
+			for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				if(color[it.index()] > (int)(k-1))
+					// s -= it.value() * c[it.index()];
+					MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
+
+			// c[i] = relaxFactor * s/A(i,i)
+			InverseMatMult(c[i], relaxFactor, A(i,i), s);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	mc_sgs_step
+/**
+ * \brief Performs a symmetric gauss-seidel step in multicolor ordering.
+ *
+ * \param A Matrix \f$A = D - L - R\f$
+ * \param c will be \f$c = N * d = (D-U)^{-1} D (D-L)^{-1} d \f$
+ * \param d the vector d.
+ * \param color, colorStart, colorRows	coloring as computed by ComputeMulticoloring
+ * \sa mc_gs_step_LL, mc_gs_step_UR
+ */
+template<typename Matrix_type, typename Vector_type>
+void mc_sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                 const std::vector<int> &color, const std::vector<size_t> &colorStart,
+                 const std::vector<size_t> &colorRows)
+{
+	// c1 = (D-L)^{-1} d
+	mc_gs_step_LL(A, c, d, relaxFactor, color, colorStart, colorRows);
+
+	// c2 = D c1
+	const long n = (long)c.size();
+#ifdef UG_OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for(long i = 0; i < n; i++)
+	{
+		typename Vector_type::value_type s = c[i];
+		MatMult(c[i], 1.0, A(i, i), s);
+	}
+
+	// c3 = (D-U)^{-1} c2
+	mc_gs_step_UR(A, c, c, relaxFactor, color, colorStart, colorRows);
+}
+
 /// @}
 }
 #endif // __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
@@ -0,0 +1,684 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__MATRIX_IO_BINARY_H
+#define __H__UG__LIB_ALGEBRA__MATRIX_IO_BINARY_H
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+#include "common/error.h"
+#include "common/types.h"
+#include "common/profiler/profiler.h"
+#include "common/util/vector_util.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+	#include "pcl/pcl_util.h"
+	#include "pcl/pcl_layout_util.h"
+	#include "pcl/parallel_file.h"
+	#include "common/serialization.h"
+	#include "lib_algebra/parallelization/parallelization_util.h"
+#endif
+
+namespace ug{
+
+/// \addtogroup matrixio
+/// \{
+
+/**
+ * \brief Binary sparse matrix and vector files
+ *
+ * The binary format holds the same information as a MatrixMarket coordinate
+ * file ('real general') but stores it in CSR arrays, so that huge matrices can
+ * be written and read without parsing. All processes write their rows
+ * collectively into one file, each process into its own chunk.
+ *
+ * All values are stored in native byte order. The file consists of
+ *  - the header (BinaryAlgebraFileHeader),
+ *  - the chunk table (one BinaryAlgebraChunkInfo per chunk),
+ *  - the chunks. Each chunk holds
+ *    - uint64 rows[numRows]:	global row indices in ascending order,
+ *    - uint64 rowStart[numRows + 1]:	first entry of each row (matrices only),
+ *    - uint64 cols[numEntries]:	global column indices (matrices only),
+ *    - double values[numEntries * blockRows * blockCols]:	values of the
+ *      blocks, each stored row by row. For vectors numEntries == numRows
+ *      and blockCols == 1.
+ *
+ * Global indices are 0-based. Entries with the same row and column index may
+ * appear in several chunks and have to be summed. This way additive parallel
+ * matrices can be written without communication. Vectors are written in a
+ * unique representation. Blocked algebras are stored blockwise, i.e. the
+ * scalar entry (r, c) of block (i, j) has the scalar indices
+ * (i * blockRows + r, j * blockCols + c).
+ *
+ * The readers distribute the rows evenly among the processes, regardless of
+ * the number of processes which wrote the file.
+ */
+struct BinaryAlgebraFileHeader
+{
+	char	magic[8];
+	uint32	version;
+	uint32	objectType;
+	uint32	blockRows;
+	uint32	blockCols;
+	uint64	numRows;
+	uint64	numCols;
+	uint64	numEntries;
+	uint64	numChunks;
+};
+
+///	Describes the location and the row range of a chunk in a binary algebra file
+struct BinaryAlgebraChunkInfo
+{
+	uint64	offset;
+	uint64	numRows;
+	uint64	numEntries;
+	uint64	firstRow;
+	uint64	lastRow;
+};
+
+enum BinaryAlgebraObjectType{
+	BAOT_MATRIX = 1,
+	BAOT_VECTOR = 2
+};
+
+///	Local data of a chunk which is written to a binary algebra file
+struct BinaryAlgebraChunk
+{
+	std::vector<uint64>	rows;
+	std::vector<uint64>	rowStart;
+	std::vector<uint64>	cols;
+	std::vector<double>	values;
+};
+
+
+///	appends the raw bytes of the given vector to the buffer
+template <class T>
+inline void BinaryAlgebraAppendRaw(std::vector<char>& bufOut, const std::vector<T>& v)
+{
+	if(!v.empty()){
+		const char* data = reinterpret_cast<const char*>(&v.front());
+		bufOut.insert(bufOut.end(), data, data + v.size() * sizeof(T));
+	}
+}
+
+///	reads num values of type T at the given offset into vOut
+template <class T>
+inline void BinaryAlgebraReadRaw(std::ifstream& in, std::vector<T>& vOut,
+								 uint64 offset, uint64 num, const char* filename)
+{
+	vOut.resize(num);
+	if(num == 0)
+		return;
+	in.seekg(offset);
+	in.read(reinterpret_cast<char*>(&vOut.front()), num * sizeof(T));
+	UG_COND_THROW(!in, "Couldn't read from binary algebra file " << filename);
+}
+
+///	returns the first global row which is read by the process with the given rank
+inline uint64 BinaryAlgebraRowRangeBegin(uint64 numRows, int rank, int numProcs)
+{
+	return (numRows * (uint64)rank) / (uint64)numProcs;
+}
+
+
+
+
+///	writes the header, the chunk table and the local chunk to a file
+/**	Has to be called by all processes. numRows is the number of global rows
+ * referenced on the calling process. chunk.rows has to be sorted.*/
+inline void WriteBinaryAlgebraFile(const char* filename, uint32 objectType,
+								   uint32 blockRows, uint32 blockCols,
+								   uint64 numRows, const BinaryAlgebraChunk& chunk)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const int numInfos = 6;
+	const uint64 numEntries = (objectType == BAOT_MATRIX) ? chunk.cols.size()
+														  : chunk.rows.size();
+	const uint64 chunkSize = sizeof(uint64) * (chunk.rows.size() + chunk.rowStart.size()
+											   + chunk.cols.size())
+							 + sizeof(double) * chunk.values.size();
+
+	uint64 localInfo[numInfos] = {chunkSize, chunk.rows.size(), numEntries, numRows,
+								  chunk.rows.empty() ? 0 : chunk.rows.front(),
+								  chunk.rows.empty() ? 0 : chunk.rows.back()};
+
+	int rank = 0;
+	std::vector<uint64> infos(localInfo, localInfo + numInfos);
+#ifdef UG_PARALLEL
+	pcl::ProcessCommunicator pc;
+	rank = pc.get_local_proc_id();
+	infos.resize(numInfos * pc.size());
+	pc.allgather(localInfo, numInfos, PCL_DT_UNSIGNED_LONG_LONG,
+				 &infos.front(), numInfos, PCL_DT_UNSIGNED_LONG_LONG);
+#endif
+
+//	the first process writes the header and the chunk table in front of its chunk
+	std::vector<char> data;
+	if(rank == 0){
+		const uint64 numChunks = infos.size() / numInfos;
+		BinaryAlgebraFileHeader h;
+		memset(&h, 0, sizeof(h));
+		memcpy(h.magic, "UGALGBIN", 8);
+		h.version = 1;
+		h.objectType = objectType;
+		h.blockRows = blockRows;
+		h.blockCols = blockCols;
+		h.numChunks = numChunks;
+
+		std::vector<BinaryAlgebraChunkInfo> table(numChunks);
+		uint64 offset = sizeof(BinaryAlgebraFileHeader)
+						+ numChunks * sizeof(BinaryAlgebraChunkInfo);
+		for(size_t i = 0; i < numChunks; ++i){
+			const uint64* info = &infos[numInfos * i];
+			table[i].offset = offset;
+			table[i].numRows = info[1];
+			table[i].numEntries = info[2];
+			table[i].firstRow = info[4];
+			table[i].lastRow = info[5];
+			offset += info[0];
+			h.numRows = std::max(h.numRows, info[3]);
+			h.numEntries += info[2];
+		}
+		h.numCols = (objectType == BAOT_MATRIX) ? h.numRows : 1;
+
+		data.resize(sizeof(h));
+		memcpy(&data.front(), &h, sizeof(h));
+		BinaryAlgebraAppendRaw(data, table);
+	}
+
+	data.reserve(data.size() + chunkSize);
+	BinaryAlgebraAppendRaw(data, chunk.rows);
+	BinaryAlgebraAppendRaw(data, chunk.rowStart);
+	BinaryAlgebraAppendRaw(data, chunk.cols);
+	BinaryAlgebraAppendRaw(data, chunk.values);
+
+#ifdef UG_PARALLEL
+	pcl::WriteConcatenatedParallelFile(GetDataPtr(data), data.size(), filename, 0, pc);
+#else
+	std::ofstream out(filename, std::ios::binary);
+	UG_COND_THROW(!out, "Couldn't open file " << filename << " for writing.");
+	out.write(GetDataPtr(data), data.size());
+	UG_COND_THROW(!out, "Couldn't write to file " << filename);
+#endif
+}
+
+
+///	reads the rows of the calling process from a binary algebra file
+/**	The global rows are distributed evenly among all processes. The rows
+ * [rowBeginOut, rowEndOut) are read into chunkOut, in the order of the chunks
+ * of the file. A row thus appears once for each chunk in which it is stored.
+ * rowStart and cols are only filled for matrices.*/
+inline void ReadBinaryAlgebraFile(BinaryAlgebraChunk& chunkOut,
+								  BinaryAlgebraFileHeader& headerOut,
+								  uint64& rowBeginOut, uint64& rowEndOut,
+								  const char* filename, uint32 objectType,
+								  uint32 blockRows, uint32 blockCols)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	std::ifstream in(filename, std::ios::binary);
+	UG_COND_THROW(!in, "Couldn't open file " << filename << " for reading.");
+
+	BinaryAlgebraFileHeader& h = headerOut;
+	in.read(reinterpret_cast<char*>(&h), sizeof(h));
+	UG_COND_THROW(!in || memcmp(h.magic, "UGALGBIN", 8) != 0,
+				  filename << " is not a binary algebra file.");
+	UG_COND_THROW(h.version != 1, "Unsupported version " << h.version
+				  << " of binary algebra file " << filename);
+	UG_COND_THROW(h.objectType != objectType, filename << " does not contain a "
+				  << (objectType == BAOT_MATRIX ? "matrix." : "vector."));
+	UG_COND_THROW(h.blockRows != blockRows || h.blockCols != blockCols,
+				  "Block size mismatch in " << filename << ": "
+				  << h.blockRows << "x" << h.blockCols << " stored, but "
+				  << blockRows << "x" << blockCols << " requested.");
+
+	std::vector<BinaryAlgebraChunkInfo> chunks;
+	BinaryAlgebraReadRaw(in, chunks, sizeof(h), h.numChunks, filename);
+
+	int rank = 0, numProcs = 1;
+#ifdef UG_PARALLEL
+	rank = pcl::ProcRank();
+	numProcs = pcl::NumProcs();
+#endif
+	rowBeginOut = BinaryAlgebraRowRangeBegin(h.numRows, rank, numProcs);
+	rowEndOut = BinaryAlgebraRowRangeBegin(h.numRows, rank + 1, numProcs);
+
+	const bool isMatrix = (objectType == BAOT_MATRIX);
+	const uint64 blockSize = (uint64)blockRows * (uint64)blockCols;
+
+	chunkOut.rows.clear();
+	chunkOut.rowStart.clear();
+	chunkOut.cols.clear();
+	chunkOut.values.clear();
+	if(isMatrix)
+		chunkOut.rowStart.push_back(0);
+
+	std::vector<uint64> rows, rowStart, cols;
+	std::vector<double> values;
+	for(size_t i = 0; i < chunks.size(); ++i){
+		const BinaryAlgebraChunkInfo& c = chunks[i];
+		if(c.numRows == 0 || c.lastRow < rowBeginOut || c.firstRow >= rowEndOut)
+			continue;
+
+	//	rows are sorted. We thus only read the consecutive block of local rows.
+		BinaryAlgebraReadRaw(in, rows, c.offset, c.numRows, filename);
+		const uint64 lo = std::lower_bound(rows.begin(), rows.end(), rowBeginOut)
+						  - rows.begin();
+		const uint64 hi = std::lower_bound(rows.begin(), rows.end(), rowEndOut)
+						  - rows.begin();
+		if(lo == hi)
+			continue;
+
+		uint64 entryBegin = lo, entryEnd = hi;
+		uint64 valueOffset = c.offset + sizeof(uint64) * c.numRows;
+		if(isMatrix){
+			const uint64 colOffset = c.offset + sizeof(uint64) * (2 * c.numRows + 1);
+			BinaryAlgebraReadRaw(in, rowStart, c.offset + sizeof(uint64) * (c.numRows + lo),
+								 hi - lo + 1, filename);
+			entryBegin = rowStart.front();
+			entryEnd = rowStart.back();
+			BinaryAlgebraReadRaw(in, cols, colOffset + sizeof(uint64) * entryBegin,
+								 entryEnd - entryBegin, filename);
+
+			const uint64 firstEntry = chunkOut.cols.size();
+			for(size_t j = 1; j < rowStart.size(); ++j)
+				chunkOut.rowStart.push_back(firstEntry + rowStart[j] - entryBegin);
+			chunkOut.cols.insert(chunkOut.cols.end(), cols.begin(), cols.end());
+			valueOffset = colOffset + sizeof(uint64) * c.numEntries;
+		}
+
+		BinaryAlgebraReadRaw(in, values, valueOffset + sizeof(double) * blockSize * entryBegin,
+							 blockSize * (entryEnd - entryBegin), filename);
+		chunkOut.rows.insert(chunkOut.rows.end(), rows.begin() + lo, rows.begin() + hi);
+		chunkOut.values.insert(chunkOut.values.end(), values.begin(), values.end());
+	}
+}
+
+
+///	computes global indices for the rows of a local matrix or vector
+/**	In serial environments global and local indices coincide. In parallel
+ * environments global indices are created through GenerateGlobalConsecutiveIndices.
+ * writeRowOut marks the rows which shall be written. Rows without a global index
+ * and - if skipSlaves is true - horizontal slave rows are not written.
+ * numGlobalRowsOut is the highest global index referenced locally + 1.*/
+template <class TAlgebraObj>
+void BinaryAlgebraGlobalIndices(std::vector<size_t>& globalIndsOut,
+								std::vector<bool>& writeRowOut,
+								uint64& numGlobalRowsOut,
+								const TAlgebraObj& obj, size_t numRows,
+								bool skipSlaves)
+{
+	writeRowOut.assign(numRows, true);
+#ifdef UG_PARALLEL
+	GenerateGlobalConsecutiveIndices(globalIndsOut, numRows, *obj.layouts());
+	if(skipSlaves){
+		std::vector<IndexLayout::Element> slaves;
+		CollectUniqueElements(slaves, obj.layouts()->slave());
+		for(size_t i = 0; i < slaves.size(); ++i)
+			writeRowOut[slaves[i]] = false;
+	}
+#else
+	globalIndsOut.resize(numRows);
+	for(size_t i = 0; i < numRows; ++i)
+		globalIndsOut[i] = i;
+#endif
+
+	numGlobalRowsOut = 0;
+	for(size_t i = 0; i < numRows; ++i){
+		if(globalIndsOut[i] == (size_t)-1)
+			writeRowOut[i] = false;
+		else
+			numGlobalRowsOut = std::max<uint64>(numGlobalRowsOut, globalIndsOut[i] + 1);
+	}
+}
+
+///	returns the written rows as pairs of global and local index, sorted by global index
+inline void BinaryAlgebraSortedRows(std::vector<std::pair<uint64, size_t> >& rowsOut,
+									const std::vector<size_t>& globalInds,
+									const std::vector<bool>& writeRow)
+{
+	rowsOut.clear();
+	for(size_t i = 0; i < globalInds.size(); ++i){
+		if(writeRow[i])
+			rowsOut.push_back(std::make_pair((uint64)globalInds[i], i));
+	}
+	std::sort(rowsOut.begin(), rowsOut.end());
+}
+
+
+#ifdef UG_PARALLEL
+///	creates algebra layouts connecting ghost indices with the processes owning them
+/**	The calling process owns the global rows [rowBegin, rowBegin + numOwned),
+ * which are stored at the first local indices. The sorted ghost indices follow
+ * and are horizontal slaves of the processes which own them.*/
+inline SmartPtr<AlgebraLayouts>
+CreateBinaryAlgebraLayouts(const std::vector<uint64>& ghosts, uint64 rowBegin,
+						   size_t numOwned, uint64 numGlobalRows)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	pcl::ProcessCommunicator pc;
+	const int numProcs = pc.size();
+	SmartPtr<AlgebraLayouts> layouts = make_sp(new AlgebraLayouts);
+
+	std::vector<uint64> rangeBegins(numProcs + 1);
+	for(int i = 0; i <= numProcs; ++i)
+		rangeBegins[i] = BinaryAlgebraRowRangeBegin(numGlobalRows, i, numProcs);
+
+//	ghosts are sorted, so the ghosts of each owner are consecutive
+	std::vector<int> sendTo;
+	std::vector<BinaryBuffer> sendBufs;
+	for(size_t i = 0; i < ghosts.size();){
+		const int owner = (int)(std::upper_bound(rangeBegins.begin(), rangeBegins.end(),
+												 ghosts[i]) - rangeBegins.begin()) - 1;
+		size_t iEnd = i;
+		while(iEnd < ghosts.size() && ghosts[iEnd] < rangeBegins[owner + 1])
+			++iEnd;
+
+		sendTo.push_back(owner);
+		sendBufs.push_back(BinaryBuffer());
+		BinaryBuffer& buf = sendBufs.back();
+		Serialize(buf, (uint64)(iEnd - i));
+
+		IndexLayout::Interface& itfc = layouts->slave().interface(owner);
+		for(; i < iEnd; ++i){
+			Serialize(buf, ghosts[i]);
+			itfc.push_back(numOwned + i);
+		}
+	}
+
+//	the owners create the matching master interfaces
+	std::vector<int> recvFrom;
+	pcl::CommunicateInvolvedProcesses(recvFrom, sendTo, pc);
+	std::vector<BinaryBuffer> recvBufs(recvFrom.size());
+	pc.distribute_data(GetDataPtr(recvBufs), GetDataPtr(recvFrom), (int)recvFrom.size(),
+					   GetDataPtr(sendBufs), GetDataPtr(sendTo), (int)sendTo.size());
+
+	for(size_t i = 0; i < recvFrom.size(); ++i){
+		BinaryBuffer& buf = recvBufs[i];
+		uint64 num;
+		Deserialize(buf, num);
+		IndexLayout::Interface& itfc = layouts->master().interface(recvFrom[i]);
+		for(uint64 j = 0; j < num; ++j){
+			uint64 ind;
+			Deserialize(buf, ind);
+			itfc.push_back(ind - rowBegin);
+		}
+	}
+
+	return layouts;
+}
+#endif
+
+
+///	writes a matrix to a binary algebra file
+/**	Has to be called by all processes. Parallel matrices have to be stored
+ * additive or consistent. For consistent matrices only master rows are written.
+ * See BinaryAlgebraFileHeader for a description of the format.*/
+template <class TMatrix>
+void SaveMatrixBinary(const TMatrix& A, const char* filename)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TMatrix::value_type block_type;
+	typedef typename TMatrix::const_row_iterator const_row_iterator;
+
+	const size_t blockRows = block_traits<block_type>::static_num_rows;
+	const size_t blockCols = block_traits<block_type>::static_num_cols;
+	UG_COND_THROW(blockRows == 0 || blockCols == 0,
+				  "SaveMatrixBinary: Only matrices with fixed block sizes are supported.");
+
+	bool skipSlaves = false;
+#ifdef UG_PARALLEL
+	if(!A.has_storage_type(PST_ADDITIVE)){
+		UG_COND_THROW(!A.has_storage_type(PST_CONSISTENT),
+					  "SaveMatrixBinary: The matrix has to be additive or consistent.");
+		skipSlaves = true;
+	}
+#endif
+
+	std::vector<size_t> globalInds;
+	std::vector<bool> writeRow;
+	uint64 numGlobalRows;
+	BinaryAlgebraGlobalIndices(globalInds, writeRow, numGlobalRows, A,
+							   A.num_rows(), skipSlaves);
+
+	std::vector<std::pair<uint64, size_t> > rows;
+	BinaryAlgebraSortedRows(rows, globalInds, writeRow);
+
+	BinaryAlgebraChunk chunk;
+	chunk.rows.reserve(rows.size());
+	chunk.rowStart.reserve(rows.size() + 1);
+	chunk.rowStart.push_back(0);
+	for(size_t i = 0; i < rows.size(); ++i){
+		const size_t row = rows[i].second;
+		chunk.rows.push_back(rows[i].first);
+		for(const_row_iterator it = A.begin_row(row); it != A.end_row(row); ++it){
+			const size_t col = globalInds[it.index()];
+			if(col == (size_t)-1)
+				continue;
+
+			chunk.cols.push_back(col);
+			const block_type& block = it.value();
+			for(size_t r = 0; r < blockRows; ++r)
+				for(size_t c = 0; c < blockCols; ++c)
+					chunk.values.push_back(BlockRef(block, r, c));
+		}
+		chunk.rowStart.push_back(chunk.cols.size());
+	}
+
+	WriteBinaryAlgebraFile(filename, BAOT_MATRIX, blockRows, blockCols,
+						   numGlobalRows, chunk);
+}
+
+
+///	reads a matrix from a binary algebra file
+/**	Has to be called by all processes. The rows are distributed evenly among the
+ * processes. Each process stores its rows at the first local indices, followed
+ * by ghost indices for all columns owned by other processes. In parallel
+ * environments the matrix is stored additive with empty ghost rows and
+ * matching algebra layouts are created.*/
+template <class TMatrix>
+void LoadMatrixBinary(TMatrix& A, const char* filename)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TMatrix::value_type block_type;
+	typedef typename TMatrix::connection connection;
+
+	const size_t blockRows = block_traits<block_type>::static_num_rows;
+	const size_t blockCols = block_traits<block_type>::static_num_cols;
+	UG_COND_THROW(blockRows == 0 || blockCols == 0,
+				  "LoadMatrixBinary: Only matrices with fixed block sizes are supported.");
+
+	BinaryAlgebraChunk chunk;
+	BinaryAlgebraFileHeader header;
+	uint64 rowBegin, rowEnd;
+	ReadBinaryAlgebraFile(chunk, header, rowBegin, rowEnd, filename,
+						  BAOT_MATRIX, blockRows, blockCols);
+
+//	columns outside of the local row range are appended as ghost indices
+	const size_t numOwned = rowEnd - rowBegin;
+	std::vector<uint64> ghosts;
+	for(size_t i = 0; i < chunk.cols.size(); ++i){
+		if(chunk.cols[i] < rowBegin || chunk.cols[i] >= rowEnd)
+			ghosts.push_back(chunk.cols[i]);
+	}
+	std::sort(ghosts.begin(), ghosts.end());
+	ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+
+	const size_t numLocal = numOwned + ghosts.size();
+	A.resize_and_clear(numLocal, numLocal);
+
+	std::vector<connection> cons;
+	const double* val = GetDataPtr(chunk.values);
+	for(size_t i = 0; i < chunk.rows.size(); ++i){
+		cons.resize(chunk.rowStart[i + 1] - chunk.rowStart[i]);
+		for(size_t j = 0; j < cons.size(); ++j){
+			const uint64 col = chunk.cols[chunk.rowStart[i] + j];
+			connection& con = cons[j];
+			if(col >= rowBegin && col < rowEnd)
+				con.iIndex = col - rowBegin;
+			else
+				con.iIndex = numOwned + (std::lower_bound(ghosts.begin(), ghosts.end(), col)
+										 - ghosts.begin());
+			for(size_t r = 0; r < blockRows; ++r)
+				for(size_t c = 0; c < blockCols; ++c, ++val)
+					BlockRef(con.dValue, r, c) = *val;
+		}
+		if(!cons.empty())
+			A.add_matrix_row(chunk.rows[i] - rowBegin, GetDataPtr(cons), cons.size());
+	}
+
+#ifdef UG_PARALLEL
+	A.set_layouts(CreateBinaryAlgebraLayouts(ghosts, rowBegin, numOwned, header.numRows));
+	A.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+
+///	writes a vector to a binary algebra file
+/**	Has to be called by all processes. Each global index is written once.
+ * See BinaryAlgebraFileHeader for a description of the format.*/
+template <class TVector>
+void SaveVectorBinary(const TVector& v, const char* filename)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TVector::value_type block_type;
+
+	const size_t blockSize = block_traits<block_type>::static_size;
+	UG_COND_THROW(blockSize == 0,
+				  "SaveVectorBinary: Only vectors with fixed block sizes are supported.");
+
+	const TVector* pVec = &v;
+#ifdef UG_PARALLEL
+	SmartPtr<TVector> spConsistent = v.clone();
+	UG_COND_THROW(!spConsistent->change_storage_type(PST_CONSISTENT),
+				  "SaveVectorBinary: Couldn't make the vector consistent.");
+	pVec = spConsistent.get();
+#endif
+
+	std::vector<size_t> globalInds;
+	std::vector<bool> writeRow;
+	uint64 numGlobalRows;
+	BinaryAlgebraGlobalIndices(globalInds, writeRow, numGlobalRows, v,
+							   v.size(), true);
+
+	std::vector<std::pair<uint64, size_t> > rows;
+	BinaryAlgebraSortedRows(rows, globalInds, writeRow);
+
+	BinaryAlgebraChunk chunk;
+	chunk.rows.reserve(rows.size());
+	chunk.values.reserve(rows.size() * blockSize);
+	for(size_t i = 0; i < rows.size(); ++i){
+		chunk.rows.push_back(rows[i].first);
+		const block_type& block = (*pVec)[rows[i].second];
+		for(size_t r = 0; r < blockSize; ++r)
+			chunk.values.push_back(BlockRef(block, r));
+	}
+
+	WriteBinaryAlgebraFile(filename, BAOT_VECTOR, blockSize, 1, numGlobalRows, chunk);
+}
+
+
+///	reads the rows of the calling process from a binary vector file
+/**	v is resized to max(numOwned, minSize) and set to zero in all other entries.
+ * \return	the number of owned rows of the calling process.*/
+template <class TVector>
+size_t ReadBinaryVectorRows(TVector& v, const char* filename, size_t minSize)
+{
+	typedef typename TVector::value_type block_type;
+
+	const size_t blockSize = block_traits<block_type>::static_size;
+	UG_COND_THROW(blockSize == 0,
+				  "LoadVectorBinary: Only vectors with fixed block sizes are supported.");
+
+	BinaryAlgebraChunk chunk;
+	BinaryAlgebraFileHeader header;
+	uint64 rowBegin, rowEnd;
+	ReadBinaryAlgebraFile(chunk, header, rowBegin, rowEnd, filename,
+						  BAOT_VECTOR, blockSize, 1);
+
+	const size_t numOwned = rowEnd - rowBegin;
+	v.resize(std::max(numOwned, minSize), false);
+	v.set(0.0);
+
+	const double* val = GetDataPtr(chunk.values);
+	for(size_t i = 0; i < chunk.rows.size(); ++i){
+		block_type& block = v[chunk.rows[i] - rowBegin];
+		for(size_t r = 0; r < blockSize; ++r, ++val)
+			BlockRef(block, r) += *val;
+	}
+	return numOwned;
+}
+
+///	reads a vector from a binary algebra file
+/**	Has to be called by all processes. The rows are distributed evenly among
+ * the processes, as in LoadMatrixBinary. Since no ghost indices are created,
+ * the resulting vector does not have any interfaces.*/
+template <class TVector>
+void LoadVectorBinary(TVector& v, const char* filename)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	ReadBinaryVectorRows(v, filename, 0);
+#ifdef UG_PARALLEL
+	v.set_layouts(make_sp(new AlgebraLayouts));
+	v.set_storage_type(PST_CONSISTENT);
+#endif
+}
+
+///	reads a vector which matches a matrix read by LoadMatrixBinary
+/**	Has to be called by all processes. The vector obtains the size and the
+ * algebra layouts of A and is stored consistent.*/
+template <class TVector, class TMatrix>
+void LoadVectorBinary(TVector& v, const char* filename, const TMatrix& A)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t numOwned = ReadBinaryVectorRows(v, filename, A.num_rows());
+	UG_COND_THROW(v.size() != A.num_rows(),
+				  "LoadVectorBinary: The vector in " << filename << " has " << numOwned
+				  << " local rows, which doesn't match the matrix with "
+				  << A.num_rows() << " local rows.");
+#ifdef UG_PARALLEL
+	v.set_layouts(A.layouts());
+	v.set_storage_type(PST_UNIQUE);
+	v.change_storage_type(PST_CONSISTENT);
+#endif
+}
+
+// end group matrixio
+/// \}
+
+}//	end of namespace
+
+#endif	//__H__UG__LIB_ALGEBRA__MATRIX_IO_BINARY_H
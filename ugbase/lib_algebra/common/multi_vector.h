@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__COMMON__MULTI_VECTOR__
+#define __H__UG__LIB_ALGEBRA__COMMON__MULTI_VECTOR__
+
+#include <vector>
+#include "common/util/smart_pointer.h"
+#include "common/types.h"
+#include "common/error.h"
+
+namespace ug{
+
+///	\addtogroup lib_algebra
+///	@{
+
+///	A block of vectors sharing the same layout, e.g. several right-hand sides
+/**	The vectors are stored as smart pointers, so that the dynamic type of the
+ * vectors (e.g. a GridFunction) is preserved when a MultiVector is created from
+ * a prototype. Operators and iterators provide a multi_apply method, that
+ * processes all vectors of a MultiVector at once.
+ */
+template <typename TVector>
+class MultiVector
+{
+	public:
+	///	vector type
+		typedef TVector vector_type;
+
+	public:
+	///	creates an empty block
+		MultiVector() {}
+
+	///	creates numVec vectors with the pattern (and layouts) of the prototype
+		MultiVector(const vector_type& prototype, size_t numVec)
+		{
+			resize(prototype, numVec);
+		}
+
+	///	resizes the block to numVec vectors with the pattern of the prototype
+	/**	Existing vectors are kept, new vectors are zero-initialized clones of
+	 * the prototype.*/
+		void resize(const vector_type& prototype, size_t numVec)
+		{
+			const size_t oldNum = m_vVec.size();
+			m_vVec.resize(numVec);
+			for(size_t i = oldNum; i < numVec; ++i){
+				m_vVec[i] = prototype.clone_without_values();
+				m_vVec[i]->set(0.0);
+			}
+		}
+
+	///	appends a vector to the block (the vector is not copied)
+		void push_back(SmartPtr<vector_type> spVec) {m_vVec.push_back(spVec);}
+
+	///	removes all vectors
+		void clear() {m_vVec.clear();}
+
+	///	number of vectors in the block
+		size_t size() const {return m_vVec.size();}
+
+	///	access to the i'th vector
+	/// \{
+		vector_type& operator[](size_t i) {return *m_vVec[i];}
+		const vector_type& operator[](size_t i) const {return *m_vVec[i];}
+	/// \}
+
+	///	returns the i'th vector as smart pointer
+	/// \{
+		SmartPtr<vector_type> vector(size_t i) {return m_vVec[i];}
+		ConstSmartPtr<vector_type> vector(size_t i) const {return m_vVec[i];}
+	/// \}
+
+	///	sets all entries of all vectors to w
+		void set(number w)
+		{
+			for(size_t i = 0; i < m_vVec.size(); ++i)
+				m_vVec[i]->set(w);
+		}
+
+	protected:
+		std::vector<SmartPtr<vector_type> > m_vVec;
+};
+
+///	computes dest[i] = A*src[i] for all vectors of the block
+/**	This is the fallback for matrix types without a dedicated kernel, that
+ * applies the matrix to each vector separately. Matrix types that provide a
+ * multi_apply kernel (one pass over the matrix for all vectors) overload this
+ * function.*/
+template <typename TMatrix, typename TDest, typename TSrc>
+void MatMultMulti(MultiVector<TDest>& dest, const TMatrix& A,
+                  const MultiVector<TSrc>& src)
+{
+	UG_COND_THROW(dest.size() != src.size(),
+				"MatMultMulti: Number of vectors mismatch: dest: "
+				<< dest.size() << ", src: " << src.size());
+	for(size_t i = 0; i < src.size(); ++i)
+		A.apply(dest[i], src[i]);
+}
+
+///	computes dest[i] -= A*src[i] for all vectors of the block
+/**	Fallback for matrix types without a dedicated kernel, see MatMultMulti.*/
+template <typename TMatrix, typename TDest, typename TSrc>
+void MatMultMultiSub(MultiVector<TDest>& dest, const TMatrix& A,
+                     const MultiVector<TSrc>& src)
+{
+	UG_COND_THROW(dest.size() != src.size(),
+				"MatMultMultiSub: Number of vectors mismatch: dest: "
+				<< dest.size() << ", src: " << src.size());
+	for(size_t i = 0; i < src.size(); ++i)
+		A.matmul_minus(dest[i], src[i]);
+}
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__COMMON__MULTI_VECTOR__ */
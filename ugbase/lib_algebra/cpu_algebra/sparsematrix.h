@@ -43,6 +43,11 @@
 #include "../algebra_common/connection.h"
 #include "../algebra_common/matrixrow.h"
 #include "../common/operations_mat/operations_mat.h"
+#include "../common/multi_vector.h"
+
+#ifdef UG_OPENMP
+	#include <omp.h>
+#endif
 
 #define PROFILE_SPMATRIX(name) PROFILE_BEGIN_GROUP(name, "SparseMatrix algebra")
 
@@ -172,6 +177,16 @@ public:
 	void apply_transposed_ignore_zero_rows(vector_t &dest,
 			const number &beta1, const vector_t &w1) const;
 
+	//! calculate dest[k] = A*src[k] for all vectors of the block in one pass over A
+	template<typename vector_t>
+	void multi_apply(MultiVector<vector_t> &dest,
+			const MultiVector<vector_t> &src) const;
+
+	//! calculate dest[k] -= A*src[k] for all vectors of the block in one pass over A
+	template<typename vector_t>
+	void multi_matmul_minus(MultiVector<vector_t> &dest,
+			const MultiVector<vector_t> &src) const;
+
 	// DEPRECATED!
 	//! calculate res = A x
 		// apply is deprecated because of axpy(res, 0.0, res, 1.0, beta, w1)
@@ -583,6 +598,11 @@ private:
 
 	void add_iterator(size_t row) const
 	{
+#ifdef UG_OPENMP
+	//	iterators created in threaded loops are not counted. The matrix
+	//	must not be modified there anyway.
+		if(omp_in_parallel()) return;
+#endif
 #ifdef CHECK_ROW_ITERATORS
 		nrOfRowIterators[row]++;
 #endif
@@ -590,6 +610,9 @@ private:
 	}
 	void remove_iterator(size_t row) const
 	{
+#ifdef UG_OPENMP
+		if(omp_in_parallel()) return;
+#endif
 #ifdef CHECK_ROW_ITERATORS
 		nrOfRowIterators[row]--;
 		UG_ASSERT(nrOfRowIterators[row] >= 0, row);
@@ -661,6 +684,22 @@ inline void MatMultTransposedAdd(vector_t &dest,
 	A1.axpy_transposed(dest, alpha1, v1, beta1, w1);
 }
 
+//! calculates dest[k] = A1*src[k] for all vectors of the block (one pass over A1)
+template<typename vector_t, typename matrix_t>
+inline void MatMultMulti(MultiVector<vector_t> &dest,
+		const SparseMatrix<matrix_t> &A1, const MultiVector<vector_t> &src)
+{
+	A1.multi_apply(dest, src);
+}
+
+//! calculates dest[k] -= A1*src[k] for all vectors of the block (one pass over A1)
+template<typename vector_t, typename matrix_t>
+inline void MatMultMultiSub(MultiVector<vector_t> &dest,
+		const SparseMatrix<matrix_t> &A1, const MultiVector<vector_t> &src)
+{
+	A1.multi_matmul_minus(dest, src);
+}
+
 
 
 
@@ -233,6 +233,80 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 	}
 }
 
+// calculate dest[k] = A*src[k] for all k (A = this matrix)
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::multi_apply(MultiVector<vector_t> &dest,
+		const MultiVector<vector_t> &src) const
+{
+	PROFILE_SPMATRIX(SparseMatrix_multi_apply);
+	UG_COND_THROW(dest.size() != src.size(), "SparseMatrix::multi_apply: "
+			"Number of vectors mismatch: dest: "<<dest.size()<<", src: "<<src.size());
+	check_fragmentation();
+
+	const size_t numVec = src.size();
+	std::vector<vector_t*> vDest(numVec);
+	std::vector<const vector_t*> vSrc(numVec);
+	for(size_t k = 0; k < numVec; ++k){
+		vDest[k] = &dest[k];
+		vSrc[k] = &src[k];
+	}
+
+	//	each matrix entry is loaded once and applied to all vectors of the block
+	for(size_t i=0; i < num_rows(); i++)
+	{
+		size_t rowIt=rowStart[i];
+		size_t itEnd=rowEnd[i];
+		if(rowIt == itEnd)
+		{
+			for(size_t k = 0; k < numVec; ++k)
+				(*vDest[k])[i] = 0.0;
+			continue;
+		}
+		for(size_t k = 0; k < numVec; ++k)
+			MatMult((*vDest[k])[i], 1.0, values[rowIt], (*vSrc[k])[cols[rowIt]]);
+		for(++rowIt; rowIt != itEnd; ++rowIt)
+		{
+			const value_type& a = values[rowIt];
+			const int col = cols[rowIt];
+			for(size_t k = 0; k < numVec; ++k)
+				MatMultAdd((*vDest[k])[i], 1.0, (*vDest[k])[i], 1.0, a, (*vSrc[k])[col]);
+		}
+	}
+}
+
+// calculate dest[k] -= A*src[k] for all k (A = this matrix)
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::multi_matmul_minus(MultiVector<vector_t> &dest,
+		const MultiVector<vector_t> &src) const
+{
+	PROFILE_SPMATRIX(SparseMatrix_multi_matmul_minus);
+	UG_COND_THROW(dest.size() != src.size(), "SparseMatrix::multi_matmul_minus: "
+			"Number of vectors mismatch: dest: "<<dest.size()<<", src: "<<src.size());
+	check_fragmentation();
+
+	const size_t numVec = src.size();
+	std::vector<vector_t*> vDest(numVec);
+	std::vector<const vector_t*> vSrc(numVec);
+	for(size_t k = 0; k < numVec; ++k){
+		vDest[k] = &dest[k];
+		vSrc[k] = &src[k];
+	}
+
+	//	each matrix entry is loaded once and applied to all vectors of the block
+	for(size_t i=0; i < num_rows(); i++)
+	{
+		for(size_t rowIt=rowStart[i]; rowIt != rowEnd[i]; ++rowIt)
+		{
+			const value_type& a = values[rowIt];
+			const int col = cols[rowIt];
+			for(size_t k = 0; k < numVec; ++k)
+				MatMultAdd((*vDest[k])[i], 1.0, (*vDest[k])[i], -1.0, a, (*vSrc[k])[col]);
+		}
+	}
+}
+
 // calculate dest = alpha1*v1 + beta1*A^T*w1 (A = this matrix)
 template<typename T>
 template<typename vector_t>
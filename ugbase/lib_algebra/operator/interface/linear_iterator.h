@@ -35,6 +35,7 @@
 
 #include "lib_algebra/operator/damping.h"
 #include "common/util/smart_pointer.h"
+#include "lib_algebra/common/multi_vector.h"
 
 namespace ug{
 
@@ -151,6 +152,27 @@ class ILinearIterator
 	 */
 		virtual bool apply_update_defect(Y& c, X& d) = 0;
 
+	///	compute new corrections c_k = B*d_k for several defects
+	/**
+	 * This method applies the iterator to each defect of the block, i.e.
+	 * c_k = B*d_k. The defects remain unchanged. The default implementation
+	 * calls apply for each defect, iterators that can share work between
+	 * the defects (e.g. the application of the operator) override it.
+	 *
+	 * \param[in]	vd		defects
+	 * \param[out]	vc		corrections
+	 * \returns		bool	success flag (false if one of the applications fails)
+	 */
+		virtual bool multi_apply(MultiVector<Y>& vc, const MultiVector<X>& vd)
+		{
+			UG_COND_THROW(vc.size() != vd.size(), "ILinearIterator::multi_apply: "
+						"Number of functions mismatch: "<<vc.size()<<" != "<<vd.size());
+			bool bRes = true;
+			for(size_t k = 0; k < vd.size(); ++k)
+				if(!apply(vc[k], vd[k])) bRes = false;
+			return bRes;
+		}
+
 	///	sets a scaling for the correction
 	/**
 	 * Sets a scaling for the correction, i.e., once the correction has been
@@ -34,6 +34,7 @@
 #define __H__LIB_ALGEBRA__OPERATOR__INTERFACE__LINEAR_OPERATOR__
 
 #include "operator.h"
+#include "lib_algebra/common/multi_vector.h"
 
 namespace ug{
 
@@ -138,6 +139,43 @@ class ILinearOperator : public IOperator<X,Y>
 	 */
 		virtual void apply_sub(Y& f, const X& u) = 0;
 
+	//	applies the operator to several functions
+	/**
+	 * This method applies the operator to each function of the block, i.e.
+	 * f_k = L*u_k. The default implementation calls apply for each function.
+	 * Matrix based operators override this method to apply the matrix to all
+	 * functions in a single pass over the matrix.
+	 *
+	 * \param[in]	vu		domain functions
+	 * \param[out]	vf		codomain functions
+	 */
+		virtual void multi_apply(MultiVector<Y>& vf, const MultiVector<X>& vu)
+		{
+			UG_COND_THROW(vf.size() != vu.size(), "ILinearOperator::multi_apply: "
+						"Number of functions mismatch: "<<vf.size()<<" != "<<vu.size());
+			for(size_t k = 0; k < vu.size(); ++k)
+				apply(vf[k], vu[k]);
+		}
+
+	//	applies the operator to several functions and subtracts the results
+	/**
+	 * This method applies the operator to each function of the block and
+	 * subtracts the result, i.e. f_k -= L*u_k. The default implementation
+	 * calls apply_sub for each function. Matrix based operators override this
+	 * method to apply the matrix to all functions in a single pass over the
+	 * matrix.
+	 *
+	 * \param[in]		vu		domain functions
+	 * \param[in,out]	vf		codomain functions
+	 */
+		virtual void multi_apply_sub(MultiVector<Y>& vf, const MultiVector<X>& vu)
+		{
+			UG_COND_THROW(vf.size() != vu.size(), "ILinearOperator::multi_apply_sub: "
+						"Number of functions mismatch: "<<vf.size()<<" != "<<vu.size());
+			for(size_t k = 0; k < vu.size(); ++k)
+				apply_sub(vf[k], vu[k]);
+		}
+
 	/// virtual	destructor
 		virtual ~ILinearOperator() {};
 };
@@ -70,6 +70,18 @@ class MatrixOperator :	public virtual ILinearOperator<X,Y>,
 	// 	Apply Operator, i.e. f = f - L*u;
 		virtual void apply_sub(Y& f, const X& u) {matrix_type::matmul_minus(f,u);}
 
+	// 	Apply Operator to several functions in one pass over the matrix, f_k = L*u_k
+		virtual void multi_apply(MultiVector<Y>& vf, const MultiVector<X>& vu)
+		{
+			MatMultMulti(vf, static_cast<const matrix_type&>(*this), vu);
+		}
+
+	// 	Apply Operator to several functions in one pass over the matrix, f_k = f_k - L*u_k
+		virtual void multi_apply_sub(MultiVector<Y>& vf, const MultiVector<X>& vu)
+		{
+			MatMultMultiSub(vf, static_cast<const matrix_type&>(*this), vu);
+		}
+
 	// 	Access to matrix
 		virtual M& get_matrix() {return *this;};
 };
@@ -174,6 +174,25 @@ class IPreconditioner :
 	 */
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)  = 0;
 
+	///	computes new corrections c_k = B*d_k for several defects
+	/**
+	 * This method computes the corrections for all defects of the block. The
+	 * default implementation calls step for each defect, preconditioners that
+	 * can share the traversal of their data between the defects override it.
+	 *
+	 * \param[in]	mat			underlying matrix (i.e. L in L*u = f)
+	 * \param[out]	vc			corrections
+	 * \param[in]	vd			defects
+	 * \returns		bool		success flag
+	 */
+		virtual bool multi_step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp,
+		                        MultiVector<vector_type>& vc, const MultiVector<vector_type>& vd)
+		{
+			for(size_t k = 0; k < vd.size(); ++k)
+				if(!step(pOp, vc[k], vd[k])) return false;
+			return true;
+		}
+
 	///	cleans the operator
 		virtual bool postprocess() = 0;
 
@@ -325,6 +344,69 @@ class IPreconditioner :
 			return true;
 		}
 
+	///	compute new corrections c_k = B*d_k for several defects
+	/**
+	 * This method implements the virtual method of the ILinearIterator-interface.
+	 * The corrections of all defects are computed by the (virtual)
+	 * 'multi_step'-method, damping and parallel storage are handled as in apply.
+	 *
+	 * \param[out]	vc		corrections
+	 * \param[in]	vd		defects
+	 * \returns		bool	success flag
+	 */
+		virtual bool multi_apply(MultiVector<vector_type>& vc, const MultiVector<vector_type>& vd)
+		{
+		//	Check that operator is initialized
+			if(!m_bInit)
+			{
+				UG_LOG("ERROR in '"<<name()<<"::multi_apply': Iterator not initialized.\n");
+				return false;
+			}
+
+			UG_COND_THROW(vc.size() != vd.size(), name() << "::multi_apply: "
+						"Number of functions mismatch: "<<vc.size()<<" != "<<vd.size());
+
+			for(size_t k = 0; k < vd.size(); ++k)
+			{
+			//	Check parallel status
+				#ifdef UG_PARALLEL
+				if(!vd[k].has_storage_type(PST_ADDITIVE))
+					UG_THROW(name() << "::multi_apply: Wrong parallel "
+					               "storage format. Defects must be additive.");
+				#endif
+
+			//	Check sizes
+				THROW_IF_NOT_EQUAL_4(vc[k].size(), vd[k].size(),
+						m_spApproxOperator->num_rows(), m_spApproxOperator->num_cols());
+			}
+
+		// 	apply iterator: c_k = B*d_k
+			if(!multi_step(m_spApproxOperator, vc, vd))
+			{
+				UG_LOG("ERROR in '"<<name()<<"::multi_apply': Step Routine failed.\n");
+				return false;
+			}
+
+			for(size_t k = 0; k < vd.size(); ++k)
+			{
+			//	apply scaling
+				const number kappa = damping()->damping(vc[k], vd[k], m_spApproxOperator);
+				if(kappa != 1.0){
+					vc[k] *= kappa;
+				}
+
+			//	Correction is always consistent
+				#ifdef 	UG_PARALLEL
+				if(!vc[k].change_storage_type(PST_CONSISTENT))
+					UG_THROW(name() << "::multi_apply': Cannot change "
+							"parallel storage type of correction to consistent.");
+				#endif
+			}
+
+		//	we're done
+			return true;
+		}
+
 	///	compute new correction c = B*d and update defect d:= d - L*c
 	/**
 	 * This method implements the virtual method of the ILinearIterator-interface.
@@ -35,6 +35,8 @@
 
 #include <iostream>
 #include <string>
+#include <sstream>
+#include <vector>
 
 #include "lib_algebra/operator/interface/operator.h"
 #include "common/profiler/profiler.h"
@@ -217,7 +219,187 @@ class CG
 			return convergence_check()->post();
 		}
 
+	///	Solve J(u)*x_k = b_k for several right-hand sides
+	/**
+	 * The CG recurrences of the right-hand sides are independent, but the
+	 * applications of the operator and of the preconditioner are performed
+	 * for all not yet converged right-hand sides at once (i.e. with one pass
+	 * over the matrix for a matrix operator). Each right-hand side is
+	 * monitored by its own clone of the convergence check.
+	 *
+	 * Note that the preconditioner only benefits from the block application
+	 * if it overrides multi_apply (e.g. ILUT, which shares its substitution
+	 * passes, or the geometric multigrid cycle, which shares the passes over
+	 * the level matrices). Other iterators are applied to each right-hand
+	 * side separately.
+	 */
+		virtual bool multi_apply(MultiVector<vector_type>& vx, const MultiVector<vector_type>& vb)
+		{
+			PROFILE_BEGIN_GROUP(CG_multi_apply, "CG algebra");
+			UG_COND_THROW(vx.size() != vb.size(), "CG::multi_apply: Number of "
+						"solutions and right-hand sides mismatch: "
+						<< vx.size() << " != " << vb.size());
+			const size_t numVec = vb.size();
+
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			for(size_t k = 0; k < numVec; ++k)
+				if(!vb[k].has_storage_type(PST_ADDITIVE) || !vx[k].has_storage_type(PST_CONSISTENT))
+					UG_THROW("CG::multi_apply:"
+									"Inadequate storage format of Vectors.");
+			#endif
+
+		// 	create help vectors (r is a copy of b)
+			MultiVector<vector_type> vr, vq, vz, vp;
+			for(size_t k = 0; k < numVec; ++k)
+			{
+				vr.push_back(vb[k].clone());
+				vq.push_back(vb[k].clone_without_values());
+				vz.push_back(vx[k].clone_without_values());
+				vp.push_back(vx[k].clone_without_values());
+			}
+
+		// 	Build defects:  r_k := b_k - J(u)*x_k
+			linear_operator()->multi_apply(vq, vx);
+			for(size_t k = 0; k < numVec; ++k)
+				VecScaleAdd(vr[k], 1.0, vr[k], -1.0, vq[k]);
+
+		// 	Preconditioning
+			if(!multi_precondition(vz, vr)) return false;
+
+		//	compute start defects, each rhs uses an own convergence check
+			prepare_conv_check();
+			std::vector<SmartPtr<IConvergenceCheck<vector_type> > > vConvCheck(numVec);
+			std::vector<number> vRhoOld(numVec);
+			std::vector<size_t> vActive;
+			for(size_t k = 0; k < numVec; ++k)
+			{
+				std::stringstream ss; ss << conv_check_info() << " (RHS " << k << ")";
+				vConvCheck[k] = convergence_check()->clone();
+				vConvCheck[k]->set_info(ss.str());
+				vConvCheck[k]->start(vr[k]);
+
+			// 	start search direction and rho
+				vp[k] = vz[k];
+				vRhoOld[k] = VecProd(vz[k], vr[k]);
+
+				if(!vConvCheck[k]->iteration_ended())
+					vActive.push_back(k);
+			}
+
+		// 	Iteration loop
+			while(!vActive.empty())
+			{
+			// 	Build q_k = A*p_k for all active rhs (q is additive afterwards)
+				MultiVector<vector_type> vActiveQ, vActiveP;
+				for(size_t a = 0; a < vActive.size(); ++a){
+					vActiveQ.push_back(vq.vector(vActive[a]));
+					vActiveP.push_back(vp.vector(vActive[a]));
+				}
+				linear_operator()->multi_apply(vActiveQ, vActiveP);
+
+			//	update solutions and defects, remove converged rhs
+				std::vector<size_t> vStillActive;
+				MultiVector<vector_type> vActiveZ, vActiveR;
+				for(size_t a = 0; a < vActive.size(); ++a)
+				{
+					const size_t k = vActive[a];
+
+				// 	lambda = (q,p)
+					const number lambda = VecProd(vq[k], vp[k]);
+
+				//	check lambda
+					if(lambda == 0.0)
+					{
+						UG_LOG("ERROR in 'CG::multi_apply': lambda=" << lambda
+						       << " is not admitted for RHS " << k << ". Aborting solver.\n");
+						return false;
+					}
+
+				//	alpha = rho / (q,p)
+					const number alpha = vRhoOld[k]/lambda;
+
+				// 	Update x := x + alpha*p
+					VecScaleAdd(vx[k], 1.0, vx[k], alpha, vp[k]);
+
+				// 	Update r := r - alpha*t
+					VecScaleAdd(vr[k], 1.0, vr[k], -alpha, vq[k]);
+
+				// 	Check convergence
+					vConvCheck[k]->update(vr[k]);
+					if(vConvCheck[k]->iteration_ended()) continue;
+
+					vStillActive.push_back(k);
+					vActiveZ.push_back(vz.vector(k));
+					vActiveR.push_back(vr.vector(k));
+				}
+				vActive.swap(vStillActive);
+				if(vActive.empty()) break;
+
+			// 	Preconditioning
+				if(!multi_precondition(vActiveZ, vActiveR)) return false;
+
+				for(size_t a = 0; a < vActive.size(); ++a)
+				{
+					const size_t k = vActive[a];
+
+				// 	new rho = (z,r)
+					const number rho = VecProd(vz[k], vr[k]);
+
+				// 	new beta = rho / rhoOld
+					const number beta = rho/vRhoOld[k];
+
+				// 	new direction p := beta * p + z
+					VecScaleAdd(vp[k], beta, vp[k], 1.0, vz[k]);
+
+				// 	remember old rho
+					vRhoOld[k] = rho;
+				}
+			}
+
+		//	post output
+			bool bRes = true;
+			for(size_t k = 0; k < numVec; ++k)
+				if(!vConvCheck[k]->post()) bRes = false;
+			return bRes;
+		}
+
 	protected:
+	///	computes z_k = M^{-1} r_k for several defects and makes z_k consistent
+		bool multi_precondition(MultiVector<vector_type>& vz, const MultiVector<vector_type>& vr)
+		{
+			if(preconditioner().valid())
+			{
+				// apply z_k = M^-1 * r_k
+				if(!preconditioner()->multi_apply(vz, vr))
+				{
+					UG_LOG("ERROR in 'CG::multi_apply': "
+							"Cannot apply preconditioner. Aborting.\n");
+					return false;
+				}
+			}
+			else
+				for(size_t k = 0; k < vr.size(); ++k)
+					vz[k] = vr[k];
+
+		// 	make z consistent
+			#ifdef UG_PARALLEL
+			for(size_t k = 0; k < vz.size(); ++k)
+				if(!vz[k].change_storage_type(PST_CONSISTENT))
+					UG_THROW("CG::multi_apply: "
+									"Cannot convert z to consistent vector.");
+			#endif
+			return true;
+		}
+
+	///	preconditioner string for the output of the convergence check
+		std::string conv_check_info() const
+		{
+			if(preconditioner().valid())
+				return std::string(" (Precond: ") + preconditioner()->name() + ")";
+			return " (No Preconditioner) ";
+		}
+
 	///	adjust output of convergence check
 		void prepare_conv_check()
 		{
@@ -226,12 +408,7 @@ class CG
 			convergence_check()->set_symbol('%');
 
 		//	set preconditioner string
-			std::string s;
-			if(preconditioner().valid())
-			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
-			else
-				s = " (No Preconditioner) ";
-			convergence_check()->set_info(s);
+			convergence_check()->set_info(conv_check_info());
 		}
 
 	protected:
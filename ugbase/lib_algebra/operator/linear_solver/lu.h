@@ -44,6 +44,7 @@
 #include "../preconditioner/ilut_scalar.h"
 #include "../interface/preconditioned_linear_operator_inverse.h"
 #include "linear_solver.h"
+#include "supernodal_lu.h"
 
 #include "lib_algebra/cpu_algebra_types.h"
 
@@ -75,7 +76,8 @@ class LU
 
 	public:
 	///	constructor
-		LU() : m_spOperator(NULL), m_mat(), m_bSortSparse(true), m_bInfo(false)
+		LU() : m_spOperator(NULL), m_mat(), m_bSortSparse(true), m_bInfo(false),
+			   m_bSupernodal(false)
 		{
 #ifdef LAPACK_AVAILABLE
 			m_iMinimumForSparse = 4000;
@@ -103,6 +105,15 @@ class LU
 			m_bInfo = b;
 		}
 
+	///	if true, a supernodal LU with nested dissection ordering is used for sparse matrices
+	/**	Ordering and symbolic factorization are reused as long as the sparsity
+	 * pattern of the matrix does not change. If false, an ILUT with threshold 0
+	 * is used instead. default false.*/
+		void set_supernodal(bool b)
+		{
+			m_bSupernodal = b;
+		}
+
 		virtual const char* name() const {return "LU";}
 
 	private:
@@ -185,6 +196,15 @@ class LU
 				print_info(A);
 				UG_LOG("\n");
 			}
+
+			if(m_bSupernodal)
+			{
+				GetDoubleSparseFromBlockSparse(m_scalarMat, A);
+				m_supernodal.set_info(m_bInfo);
+				m_supernodal.init(m_scalarMat);
+				return true;
+			}
+
 			ilut_scalar = make_sp(new ILUTScalarPreconditioner<algebra_type>(0.0));
 			ilut_scalar->set_sort(m_bSortSparse);
 			ilut_scalar->set_info(m_bInfo);
@@ -221,6 +241,25 @@ class LU
 		bool solve_sparse(vector_type &x, const vector_type &b)
 		{
 			PROFILE_FUNC();
+			if(m_bSupernodal)
+			{
+				m_tmpSparse.resize(m_size);
+				for(size_t i=0, k=0; i<b.size(); i++)
+				{
+					for(size_t j=0; j<GetSize(b[i]); j++)
+						m_tmpSparse[k++] = BlockRef(b[i],j);
+				}
+
+				if(m_size > 0)
+					m_supernodal.solve(&m_tmpSparse[0], &m_tmpSparse[0]);
+
+				for(size_t i=0, k=0; i<x.size(); i++)
+				{
+					for(size_t j=0; j<GetSize(x[i]); j++)
+						BlockRef(x[i],j) = m_tmpSparse[k++];
+				}
+				return true;
+			}
 			ilut_scalar->solve(x, b);
 			return true;
 		}
@@ -380,6 +419,7 @@ class LU
 			ss << " Minimum Entries for Sparse LU: " << m_iMinimumForSparse;
 			if(m_iMinimumForSparse==0)
 				ss << " (= always Sparse LU)";
+			ss << "\n Sparse LU: " << (m_bSupernodal ? "supernodal, nested dissection ordering" : "ILUT(0)");
 			return ss.str();
 		}
 
@@ -403,8 +443,11 @@ class LU
 
 		bool m_bDense;
 		SmartPtr<ILUTScalarPreconditioner<algebra_type> > ilut_scalar;
+		SupernodalLU m_supernodal;
+		SparseMatrix<double> m_scalarMat;
+		std::vector<double> m_tmpSparse;
 		size_t m_iMinimumForSparse;
-		bool m_bSortSparse, m_bInfo;
+		bool m_bSortSparse, m_bInfo, m_bSupernodal;
 };
 
 } // end namespace ug
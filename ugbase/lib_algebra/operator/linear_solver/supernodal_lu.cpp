@@ -0,0 +1,698 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "supernodal_lu.h"
+#include "common/error.h"
+#include "common/log.h"
+#include "common/profiler/profiler.h"
+
+#if defined(LAPACK_AVAILABLE) && defined(BLAS_AVAILABLE)
+	#include "lib_algebra/small_algebra/lapack/lapack.h"
+#endif
+
+namespace ug{
+
+namespace{
+
+const size_t INVALID = (size_t)-1;
+
+///	LU factorization of a column major dense n x n block with partial pivoting
+/**	Pivots are stored 1-based like in getrf. Returns 0 on success and k > 0 if
+ * the k-th pivot is exactly zero.*/
+int DenseLUFactor(int n, double* a, int lda, int* piv)
+{
+#if defined(LAPACK_AVAILABLE) && defined(BLAS_AVAILABLE)
+	return getrf(n, n, a, lda, piv);
+#else
+	for(int k = 0; k < n; ++k){
+		int p = k;
+		double maxVal = std::fabs(a[k + k*lda]);
+		for(int i = k + 1; i < n; ++i){
+			if(std::fabs(a[i + k*lda]) > maxVal){
+				maxVal = std::fabs(a[i + k*lda]);
+				p = i;
+			}
+		}
+		piv[k] = p + 1;
+		if(maxVal == 0)
+			return k + 1;
+
+		if(p != k){
+			for(int j = 0; j < n; ++j)
+				std::swap(a[k + j*lda], a[p + j*lda]);
+		}
+
+		const double inv = 1. / a[k + k*lda];
+		for(int i = k + 1; i < n; ++i)
+			a[i + k*lda] *= inv;
+
+		for(int j = k + 1; j < n; ++j){
+			const double akj = a[k + j*lda];
+			if(akj == 0) continue;
+			for(int i = k + 1; i < n; ++i)
+				a[i + j*lda] -= a[i + k*lda] * akj;
+		}
+	}
+	return 0;
+#endif
+}
+
+
+///	Work data for the nested dissection ordering
+struct NDWork{
+	const std::vector<size_t>*	adjStart;
+	const std::vector<size_t>*	adj;
+	std::vector<size_t>	labels;
+	std::vector<size_t>	visited;
+	std::vector<size_t>	level;
+	std::vector<size_t>	order;
+	size_t	stamp;
+	size_t	nextLabel;
+	size_t	leafSize;
+};
+
+///	breadth first search on the vertices with the given label
+/**	The vertices are written level by level to lvl. lvlStart[i] is the first
+ * entry of level i in lvl. Returns the number of levels.*/
+size_t LevelStructure(NDWork& w, size_t root, size_t label,
+					  std::vector<size_t>& lvl, std::vector<size_t>& lvlStart)
+{
+	const std::vector<size_t>& adjStart = *w.adjStart;
+	const std::vector<size_t>& adj = *w.adj;
+
+	++w.stamp;
+	lvl.clear();
+	lvlStart.clear();
+	lvl.push_back(root);
+	w.visited[root] = w.stamp;
+
+	size_t begin = 0;
+	while(begin < lvl.size()){
+		const size_t end = lvl.size();
+		lvlStart.push_back(begin);
+		for(size_t i = begin; i < end; ++i){
+			const size_t v = lvl[i];
+			w.level[v] = lvlStart.size() - 1;
+			for(size_t q = adjStart[v]; q < adjStart[v+1]; ++q){
+				const size_t u = adj[q];
+				if(w.labels[u] == label && w.visited[u] != w.stamp){
+					w.visited[u] = w.stamp;
+					lvl.push_back(u);
+				}
+			}
+		}
+		begin = end;
+	}
+	lvlStart.push_back(lvl.size());
+	return lvlStart.size() - 1;
+}
+
+///	orders the vertices of part recursively. Separators are numbered last.
+void Dissect(NDWork& w, std::vector<size_t>& part, size_t label)
+{
+	if(part.size() <= w.leafSize){
+		w.order.insert(w.order.end(), part.begin(), part.end());
+		return;
+	}
+
+	const std::vector<size_t>& adjStart = *w.adjStart;
+	const std::vector<size_t>& adj = *w.adj;
+
+	std::vector<size_t> lvl, lvlStart;
+	size_t numLvls = LevelStructure(w, part[0], label, lvl, lvlStart);
+
+//	disconnected parts are split into their components first
+	if(lvl.size() < part.size()){
+		std::vector<std::vector<size_t> > comps(1);
+		std::vector<size_t> compLabels(1, w.nextLabel++);
+		comps[0].swap(lvl);
+		for(size_t i = 0; i < comps[0].size(); ++i)
+			w.labels[comps[0][i]] = compLabels[0];
+
+		for(size_t i = 0; i < part.size(); ++i){
+			if(w.labels[part[i]] != label) continue;
+			comps.push_back(std::vector<size_t>());
+			compLabels.push_back(w.nextLabel++);
+			LevelStructure(w, part[i], label, comps.back(), lvlStart);
+			for(size_t j = 0; j < comps.back().size(); ++j)
+				w.labels[comps.back()[j]] = compLabels.back();
+		}
+
+		std::vector<size_t>().swap(part);
+		for(size_t i = 0; i < comps.size(); ++i)
+			Dissect(w, comps[i], compLabels[i]);
+		return;
+	}
+
+//	search a pseudo peripheral vertex to obtain a deep level structure
+	for(int iter = 0; iter < 5; ++iter){
+		size_t cand = lvl[lvlStart[numLvls - 1]];
+		for(size_t i = lvlStart[numLvls - 1]; i < lvlStart[numLvls]; ++i){
+			const size_t v = lvl[i];
+			if(adjStart[v+1] - adjStart[v] < adjStart[cand+1] - adjStart[cand])
+				cand = v;
+		}
+
+		std::vector<size_t> candLvl, candLvlStart;
+		const size_t candNumLvls = LevelStructure(w, cand, label, candLvl, candLvlStart);
+		if(candNumLvls <= numLvls){
+		//	restore the level information of the current structure
+			LevelStructure(w, lvl[0], label, lvl, lvlStart);
+			break;
+		}
+		lvl.swap(candLvl);
+		lvlStart.swap(candLvlStart);
+		numLvls = candNumLvls;
+	}
+
+	if(numLvls < 3){
+		w.order.insert(w.order.end(), lvl.begin(), lvl.end());
+		return;
+	}
+
+//	the separator is taken from the level which splits the vertices in halves
+	size_t sepLvl = 1;
+	while(sepLvl < numLvls - 2 && lvlStart[sepLvl + 1] < part.size() / 2)
+		++sepLvl;
+
+	const size_t labelA = w.nextLabel++;
+	const size_t labelB = w.nextLabel++;
+	std::vector<size_t> partA, partB, sep;
+
+	partA.insert(partA.end(), lvl.begin(), lvl.begin() + lvlStart[sepLvl]);
+	partB.insert(partB.end(), lvl.begin() + lvlStart[sepLvl + 1], lvl.end());
+
+//	only those vertices of the separator level are required which are
+//	connected to the next level
+	for(size_t i = lvlStart[sepLvl]; i < lvlStart[sepLvl + 1]; ++i){
+		const size_t v = lvl[i];
+		bool isSep = false;
+		for(size_t q = adjStart[v]; q < adjStart[v+1]; ++q){
+			const size_t u = adj[q];
+			if(w.labels[u] == label && w.level[u] == sepLvl + 1){
+				isSep = true;
+				break;
+			}
+		}
+		if(isSep)	sep.push_back(v);
+		else		partA.push_back(v);
+	}
+
+	for(size_t i = 0; i < partA.size(); ++i)	w.labels[partA[i]] = labelA;
+	for(size_t i = 0; i < partB.size(); ++i)	w.labels[partB[i]] = labelB;
+	for(size_t i = 0; i < sep.size(); ++i)		w.labels[sep[i]] = INVALID;
+
+	std::vector<size_t>().swap(part);
+	std::vector<size_t>().swap(lvl);
+	Dissect(w, partA, labelA);
+	Dissect(w, partB, labelB);
+	w.order.insert(w.order.end(), sep.begin(), sep.end());
+}
+
+}//	end of anonymous namespace
+
+
+SupernodalLU::SupernodalLU() :
+	m_ndLeafSize(64),
+	m_bInfo(false),
+	m_bSymbolicReused(false)
+{
+}
+
+
+void SupernodalLU::init(const SparseMatrix<double>& A)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	UG_COND_THROW(A.num_rows() != A.num_cols(),
+				  "SupernodalLU: only square matrices are supported.");
+
+	m_bSymbolicReused = same_pattern(A);
+	if(!m_bSymbolicReused)
+		analyze(A);
+
+	factorize(A);
+
+	if(m_bInfo){
+		UG_LOG("SupernodalLU: " << num_rows() << " rows, "
+				<< A.total_num_connections() << " nonzeros, "
+				<< num_supernodes() << " supernodes, "
+				<< num_factor_entries() << " entries in L+U (fill-in factor "
+				<< (double)num_factor_entries() / std::max<size_t>(A.total_num_connections(), 1)
+				<< ")" << (m_bSymbolicReused ? ", reused symbolic factorization" : "")
+				<< "\n");
+	}
+}
+
+
+bool SupernodalLU::same_pattern(const SparseMatrix<double>& A) const
+{
+	if(m_patternRowStart.empty() || A.num_rows() + 1 != m_patternRowStart.size())
+		return false;
+
+	size_t q = 0;
+	for(size_t r = 0; r < A.num_rows(); ++r){
+		if(q != m_patternRowStart[r])
+			return false;
+		for(SparseMatrix<double>::const_row_iterator it = A.begin_row(r);
+			it != A.end_row(r); ++it, ++q)
+		{
+			if(q >= m_patternCols.size() || m_patternCols[q] != it.index())
+				return false;
+		}
+	}
+	return q == m_patternCols.size();
+}
+
+
+void SupernodalLU::analyze(const SparseMatrix<double>& A)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t n = A.num_rows();
+
+//	remember the pattern and build the graph of A+A^T
+	m_patternRowStart.resize(n + 1);
+	m_patternCols.clear();
+	m_patternCols.reserve(A.total_num_connections());
+	std::vector<size_t> adjStart(n + 1, 0);
+	for(size_t r = 0; r < n; ++r){
+		m_patternRowStart[r] = m_patternCols.size();
+		for(SparseMatrix<double>::const_row_iterator it = A.begin_row(r);
+			it != A.end_row(r); ++it)
+		{
+			const size_t c = it.index();
+			m_patternCols.push_back(c);
+			if(c == r) continue;
+			++adjStart[r + 1];
+			++adjStart[c + 1];
+		}
+	}
+	m_patternRowStart[n] = m_patternCols.size();
+
+	for(size_t i = 0; i < n; ++i)
+		adjStart[i + 1] += adjStart[i];
+
+	std::vector<size_t> adj(adjStart[n]);
+	{
+		std::vector<size_t> cursor(adjStart.begin(), adjStart.end() - 1);
+		for(size_t r = 0; r < n; ++r){
+			for(size_t q = m_patternRowStart[r]; q < m_patternRowStart[r+1]; ++q){
+				const size_t c = m_patternCols[q];
+				if(c == r) continue;
+				adj[cursor[r]++] = c;
+				adj[cursor[c]++] = r;
+			}
+		}
+	}
+
+//	remove duplicates
+	{
+		size_t numEntries = 0;
+		for(size_t i = 0; i < n; ++i){
+			const size_t begin = numEntries;
+			std::sort(adj.begin() + adjStart[i], adj.begin() + adjStart[i+1]);
+			for(size_t q = adjStart[i]; q < adjStart[i+1]; ++q){
+				if(numEntries == begin || adj[numEntries - 1] != adj[q])
+					adj[numEntries++] = adj[q];
+			}
+			adjStart[i] = begin;
+		}
+		adjStart[n] = numEntries;
+		adj.resize(numEntries);
+	}
+
+	compute_ordering(adjStart, adj);
+
+//	elimination tree and column counts of L in the new ordering
+	std::vector<size_t> parent(n, INVALID), ancestor(n, INVALID);
+	std::vector<size_t> mark(n, INVALID), colCount(n, 1), numChildren(n, 0);
+	for(size_t i = 0; i < n; ++i){
+		const size_t old = m_perm[i];
+		for(size_t q = adjStart[old]; q < adjStart[old+1]; ++q){
+			size_t r = m_invPerm[adj[q]];
+			if(r >= i) continue;
+			while(ancestor[r] != INVALID && ancestor[r] != i){
+				const size_t next = ancestor[r];
+				ancestor[r] = i;
+				r = next;
+			}
+			if(ancestor[r] == INVALID){
+				ancestor[r] = i;
+				parent[r] = i;
+				++numChildren[i];
+			}
+		}
+
+		mark[i] = i;
+		for(size_t q = adjStart[old]; q < adjStart[old+1]; ++q){
+			size_t j = m_invPerm[adj[q]];
+			if(j >= i) continue;
+			while(mark[j] != i){
+				++colCount[j];
+				mark[j] = i;
+				j = parent[j];
+			}
+		}
+	}
+
+//	fundamental supernodes
+	m_snFirst.clear();
+	m_snOf.resize(n);
+	if(n > 0) m_snFirst.push_back(0);
+	for(size_t j = 1; j < n; ++j){
+		if(!(parent[j-1] == j && colCount[j-1] == colCount[j] + 1 && numChildren[j] == 1))
+			m_snFirst.push_back(j);
+	}
+	m_snFirst.push_back(n);
+
+	const size_t numSn = m_snFirst.size() - 1;
+	m_snRowStart.resize(numSn + 1);
+	m_lOffset.resize(numSn);
+	m_uOffset.resize(numSn);
+	std::vector<size_t> cursor(numSn);
+	size_t numRows = 0, numValues = 0;
+	for(size_t s = 0; s < numSn; ++s){
+		const size_t first = m_snFirst[s], last = m_snFirst[s+1];
+		const size_t nc = last - first;
+		const size_t m = nc + colCount[last - 1] - 1;
+		for(size_t j = first; j < last; ++j)
+			m_snOf[j] = s;
+		m_snRowStart[s] = numRows;
+		cursor[s] = numRows + nc;
+		numRows += m;
+		m_lOffset[s] = numValues;
+		numValues += m * nc;
+		m_uOffset[s] = numValues;
+		numValues += nc * (m - nc);
+	}
+	m_snRowStart[numSn] = numRows;
+
+//	row structure of the supernodes: the columns of the supernode followed by
+//	the structure of its last column
+	m_snRows.resize(numRows);
+	for(size_t s = 0; s < numSn; ++s){
+		for(size_t j = m_snFirst[s]; j < m_snFirst[s+1]; ++j)
+			m_snRows[m_snRowStart[s] + j - m_snFirst[s]] = j;
+	}
+
+	mark.assign(n, INVALID);
+	for(size_t i = 0; i < n; ++i){
+		const size_t old = m_perm[i];
+		mark[i] = i;
+		for(size_t q = adjStart[old]; q < adjStart[old+1]; ++q){
+			size_t j = m_invPerm[adj[q]];
+			if(j >= i) continue;
+			while(mark[j] != i){
+				const size_t s = m_snOf[j];
+				if(j + 1 == m_snFirst[s+1])
+					m_snRows[cursor[s]++] = i;
+				mark[j] = i;
+				j = parent[j];
+			}
+		}
+	}
+
+	m_values.resize(numValues);
+	m_pivots.resize(n);
+
+//	destination of each matrix entry in the factor storage
+	m_entryDest.resize(m_patternCols.size());
+	for(size_t r = 0; r < n; ++r){
+		for(size_t q = m_patternRowStart[r]; q < m_patternRowStart[r+1]; ++q){
+			const size_t i = m_invPerm[r], j = m_invPerm[m_patternCols[q]];
+			const size_t s = m_snOf[std::min(i, j)];
+			const size_t first = m_snFirst[s], nc = m_snFirst[s+1] - first;
+			const size_t* rows = &m_snRows[m_snRowStart[s]];
+			const size_t m = m_snRowStart[s+1] - m_snRowStart[s];
+
+			if(j < first + nc){
+				size_t pos = i - first;
+				if(pos >= nc)
+					pos = std::lower_bound(rows + nc, rows + m, i) - rows;
+				UG_ASSERT(pos < m && rows[pos] == i, "Entry not contained in structure of L.");
+				m_entryDest[q] = m_lOffset[s] + pos + (j - first) * m;
+			}
+			else{
+				const size_t pos = std::lower_bound(rows + nc, rows + m, j) - rows;
+				UG_ASSERT(pos < m && rows[pos] == j, "Entry not contained in structure of U.");
+				m_entryDest[q] = m_uOffset[s] + (i - first) + (pos - nc) * nc;
+			}
+		}
+	}
+}
+
+
+void SupernodalLU::compute_ordering(const std::vector<size_t>& adjStart,
+									const std::vector<size_t>& adj)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t n = adjStart.size() - 1;
+
+	NDWork w;
+	w.adjStart = &adjStart;
+	w.adj = &adj;
+	w.labels.assign(n, 0);
+	w.visited.assign(n, 0);
+	w.level.assign(n, 0);
+	w.order.reserve(n);
+	w.stamp = 0;
+	w.nextLabel = 1;
+	w.leafSize = std::max<size_t>(m_ndLeafSize, 1);
+
+	std::vector<size_t> part(n);
+	for(size_t i = 0; i < n; ++i)
+		part[i] = i;
+	Dissect(w, part, 0);
+
+	UG_COND_THROW(w.order.size() != n, "SupernodalLU: nested dissection ordering "
+				  "is incomplete (" << w.order.size() << " of " << n << " indices).");
+
+	m_perm.swap(w.order);
+	m_invPerm.resize(n);
+	for(size_t i = 0; i < n; ++i)
+		m_invPerm[m_perm[i]] = i;
+}
+
+
+void SupernodalLU::factorize(const SparseMatrix<double>& A)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	std::fill(m_values.begin(), m_values.end(), 0.);
+
+	size_t q = 0;
+	for(size_t r = 0; r < A.num_rows(); ++r){
+		for(SparseMatrix<double>::const_row_iterator it = A.begin_row(r);
+			it != A.end_row(r); ++it, ++q)
+		{
+			m_values[m_entryDest[q]] += it.value();
+		}
+	}
+
+	for(size_t s = 0; s < num_supernodes(); ++s)
+		factorize_supernode(s);
+}
+
+
+void SupernodalLU::factorize_supernode(size_t s)
+{
+	const size_t first = m_snFirst[s];
+	const size_t nc = m_snFirst[s+1] - first;
+	const size_t m = m_snRowStart[s+1] - m_snRowStart[s];
+	const size_t m2 = m - nc;
+	const size_t* R = &m_snRows[m_snRowStart[s] + nc];
+	double* L = &m_values[m_lOffset[s]];
+	double* U = m2 ? &m_values[m_uOffset[s]] : NULL;
+	int* piv = &m_pivots[first];
+
+//	dense LU of the diagonal block
+	const int info = DenseLUFactor((int)nc, L, (int)m, piv);
+	UG_COND_THROW(info > 0, "SupernodalLU: zero pivot in row " << m_perm[first + info - 1]
+				  << ". The matrix is singular or requires pivoting across supernodes.");
+	UG_COND_THROW(info < 0, "SupernodalLU: dense factorization failed (info = " << info << ").");
+
+	if(m2 == 0) return;
+
+//	U12 := L11^{-1} P U12
+	for(size_t k = 0; k < nc; ++k){
+		const size_t p = piv[k] - 1;
+		if(p == k) continue;
+		for(size_t c = 0; c < m2; ++c)
+			std::swap(U[k + c*nc], U[p + c*nc]);
+	}
+	for(size_t c = 0; c < m2; ++c){
+		double* u = U + c*nc;
+		for(size_t k = 0; k < nc; ++k){
+			const double uk = u[k];
+			if(uk == 0) continue;
+			for(size_t i = k + 1; i < nc; ++i)
+				u[i] -= L[i + k*m] * uk;
+		}
+	}
+
+//	L21 := L21 U11^{-1}
+	for(size_t j = 0; j < nc; ++j){
+		double* lj = L + j*m + nc;
+		for(size_t k = 0; k < j; ++k){
+			const double ukj = L[k + j*m];
+			if(ukj == 0) continue;
+			const double* lk = L + k*m + nc;
+			for(size_t r = 0; r < m2; ++r)
+				lj[r] -= lk[r] * ukj;
+		}
+		const double inv = 1. / L[j + j*m];
+		for(size_t r = 0; r < m2; ++r)
+			lj[r] *= inv;
+	}
+
+//	Schur complement update W = L21 U12
+	m_update.assign(m2 * m2, 0.);
+	double* W = &m_update[0];
+	for(size_t c = 0; c < m2; ++c){
+		double* wc = W + c*m2;
+		for(size_t k = 0; k < nc; ++k){
+			const double ukc = U[k + c*nc];
+			if(ukc == 0) continue;
+			const double* lk = L + k*m + nc;
+			for(size_t r = 0; r < m2; ++r)
+				wc[r] += lk[r] * ukc;
+		}
+	}
+
+//	scatter the update to the supernodes owning the columns of R
+	m_relPos.resize(m2);
+	size_t jj = 0;
+	while(jj < m2){
+		const size_t t = m_snOf[R[jj]];
+		const size_t firstT = m_snFirst[t];
+		const size_t lastT = m_snFirst[t+1];
+		const size_t nct = lastT - firstT;
+		const size_t mt = m_snRowStart[t+1] - m_snRowStart[t];
+		const size_t* rowsT = &m_snRows[m_snRowStart[t]];
+		double* Lt = &m_values[m_lOffset[t]];
+		double* Ut = &m_values[m_uOffset[t]];
+
+		size_t jEnd = jj;
+		while(jEnd < m2 && R[jEnd] < lastT)
+			++jEnd;
+
+	//	positions of the remaining rows of R in the structure of t
+		for(size_t r = jj, q = 0; r < m2; ++r){
+			while(rowsT[q] < R[r]) ++q;
+			UG_ASSERT(q < mt && rowsT[q] == R[r], "Row structure of supernode "
+					  << s << " is not contained in the one of supernode " << t);
+			m_relPos[r] = q;
+		}
+
+		for(size_t c = jj; c < jEnd; ++c){
+			double* ltc = Lt + (R[c] - firstT) * mt;
+			const double* wc = W + c*m2;
+			for(size_t r = jj; r < m2; ++r)
+				ltc[m_relPos[r]] -= wc[r];
+		}
+
+		for(size_t c = jEnd; c < m2; ++c){
+			double* utc = Ut + (m_relPos[c] - nct) * nct;
+			const double* wc = W + c*m2;
+			for(size_t r = jj; r < jEnd; ++r)
+				utc[R[r] - firstT] -= wc[r];
+		}
+
+		jj = jEnd;
+	}
+}
+
+
+void SupernodalLU::solve(double* x, const double* b) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t n = num_rows();
+	m_y.resize(n);
+	double* y = n ? &m_y[0] : NULL;
+	for(size_t i = 0; i < n; ++i)
+		y[i] = b[m_perm[i]];
+
+//	forward substitution
+	for(size_t s = 0; s < num_supernodes(); ++s){
+		const size_t first = m_snFirst[s];
+		const size_t nc = m_snFirst[s+1] - first;
+		const size_t m = m_snRowStart[s+1] - m_snRowStart[s];
+		const size_t* R = &m_snRows[m_snRowStart[s] + nc];
+		const double* L = &m_values[m_lOffset[s]];
+		const int* piv = &m_pivots[first];
+		double* ys = y + first;
+
+		for(size_t k = 0; k < nc; ++k){
+			const size_t p = piv[k] - 1;
+			if(p != k) std::swap(ys[k], ys[p]);
+		}
+		for(size_t k = 0; k < nc; ++k){
+			const double yk = ys[k];
+			if(yk == 0) continue;
+			const double* lk = L + k*m;
+			for(size_t i = k + 1; i < nc; ++i)
+				ys[i] -= lk[i] * yk;
+			for(size_t r = nc; r < m; ++r)
+				y[R[r - nc]] -= lk[r] * yk;
+		}
+	}
+
+//	backward substitution
+	for(size_t s = num_supernodes(); s > 0; --s){
+		const size_t first = m_snFirst[s-1];
+		const size_t nc = m_snFirst[s] - first;
+		const size_t m = m_snRowStart[s] - m_snRowStart[s-1];
+		const size_t* R = &m_snRows[m_snRowStart[s-1] + nc];
+		const double* L = &m_values[m_lOffset[s-1]];
+		double* ys = y + first;
+
+		for(size_t c = 0; c < m - nc; ++c){
+			const double xc = y[R[c]];
+			if(xc == 0) continue;
+			const double* uc = &m_values[m_uOffset[s-1] + c*nc];
+			for(size_t k = 0; k < nc; ++k)
+				ys[k] -= uc[k] * xc;
+		}
+		for(size_t k = nc; k > 0; --k){
+			const double* lk = L + (k-1)*m;
+			ys[k-1] /= lk[k-1];
+			const double yk = ys[k-1];
+			for(size_t i = 0; i < k - 1; ++i)
+				ys[i] -= lk[i] * yk;
+		}
+	}
+
+	for(size_t i = 0; i < n; ++i)
+		x[m_perm[i]] = y[i];
+}
+
+}//	end of namespace
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__SUPERNODAL_LU__
+#define __H__UG__LIB_ALGEBRA__SUPERNODAL_LU__
+
+#include <vector>
+#include "lib_algebra/cpu_algebra/sparsematrix.h"
+
+namespace ug{
+
+///	Sparse direct LU factorization of scalar sparse matrices
+/**	The matrix is reordered with a nested dissection ordering computed on the
+ * graph of A+A^T. Based on the elimination tree of the symmetrized pattern,
+ * columns with identical structure are grouped into supernodes. The numeric
+ * factorization is right-looking: the diagonal block of each supernode is
+ * factorized densely (with getrf if LAPACK is available), the off-diagonal
+ * panels are computed by dense triangular solves and the Schur complement
+ * update is scattered into the panels of the ancestor supernodes.
+ *
+ * Pivoting is restricted to the diagonal block of each supernode. This is
+ * sufficient for most discretization matrices, but matrices requiring
+ * pivoting across supernodes will be reported as singular.
+ *
+ * If init is called with a matrix with the same sparsity pattern as in the
+ * previous call, ordering and symbolic factorization are reused and only
+ * the numeric factorization is recomputed.
+ */
+class SupernodalLU
+{
+	public:
+		SupernodalLU();
+
+	///	sets the size of subgraphs which are no longer split by nested dissection
+		void set_nested_dissection_leaf_size(size_t leafSize)	{m_ndLeafSize = leafSize;}
+
+	///	prints statistics about the factorization if enabled
+		void set_info(bool b)									{m_bInfo = b;}
+
+	///	computes the factorization of A
+	/**	Ordering and symbolic factorization are reused if the sparsity
+	 * pattern of A matches the one of the previously factorized matrix.*/
+		void init(const SparseMatrix<double>& A);
+
+	///	solves A*x = b. x and b have to hold num_rows() entries and may coincide.
+		void solve(double* x, const double* b) const;
+
+	///	number of rows of the factorized matrix
+		size_t num_rows() const									{return m_perm.size();}
+
+	///	number of supernodes of the current factorization
+		size_t num_supernodes() const							{return m_snFirst.empty() ? 0 : m_snFirst.size() - 1;}
+
+	///	number of entries stored in the factors L and U
+		size_t num_factor_entries() const						{return m_values.size();}
+
+	///	returns true if the last call to init reused the symbolic factorization
+		bool symbolic_reused() const							{return m_bSymbolicReused;}
+
+	private:
+		bool same_pattern(const SparseMatrix<double>& A) const;
+		void analyze(const SparseMatrix<double>& A);
+		void compute_ordering(const std::vector<size_t>& adjStart,
+							  const std::vector<size_t>& adj);
+		void factorize(const SparseMatrix<double>& A);
+		void factorize_supernode(size_t s);
+
+	private:
+		size_t	m_ndLeafSize;
+		bool	m_bInfo;
+		bool	m_bSymbolicReused;
+
+	//	pattern of the last analyzed matrix
+		std::vector<size_t>	m_patternRowStart;
+		std::vector<size_t>	m_patternCols;
+
+	//	ordering: m_perm[new] = old, m_invPerm[old] = new
+		std::vector<size_t>	m_perm;
+		std::vector<size_t>	m_invPerm;
+
+	//	supernode s holds the columns [m_snFirst[s], m_snFirst[s+1]).
+	//	Its row structure is stored in m_snRows[m_snRowStart[s], m_snRowStart[s+1])
+	//	and starts with the columns of the supernode itself.
+		std::vector<size_t>	m_snFirst;
+		std::vector<size_t>	m_snOf;
+		std::vector<size_t>	m_snRowStart;
+		std::vector<size_t>	m_snRows;
+
+	//	the L-panel of s is a column major (numRows x numCols) block starting at
+	//	m_lOffset[s], which also holds the dense LU factors of the diagonal
+	//	block. The U-panel is a column major (numCols x (numRows-numCols))
+	//	block starting at m_uOffset[s].
+		std::vector<size_t>	m_lOffset;
+		std::vector<size_t>	m_uOffset;
+		std::vector<double>	m_values;
+		std::vector<int>	m_pivots;
+
+	//	position in m_values for each entry of the analyzed matrix
+		std::vector<size_t>	m_entryDest;
+
+	//	work arrays
+		std::vector<double>	m_update;
+		std::vector<size_t>	m_relPos;
+		mutable std::vector<double>	m_y;
+};
+
+}//	end of namespace
+
+#endif
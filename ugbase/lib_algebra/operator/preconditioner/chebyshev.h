@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+
+#include <cmath>
+#include <sstream>
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "lib_algebra/small_algebra/additional_math.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	Chebyshev polynomial smoother
+/**
+ * Computes the correction c = p(D^{-1} A) D^{-1} d, where p is the Chebyshev
+ * polynomial of the given degree which is minimal on the interval
+ * [ratio * lambdaMax, lambdaMax] of the spectrum of D^{-1} A. Only
+ * matrix-vector products and diagonal scalings are performed, so the smoother
+ * needs no sequential sweeps and in parallel only the communication of a
+ * Jacobi step per degree.
+ *
+ * D is either the (block) diagonal of A or, if l1 is enabled, the diagonal
+ * augmented by the l1-norms of the off-diagonal entries of each row, which
+ * bounds the spectrum of D^{-1} A by 1 for symmetric positive definite A.
+ *
+ * If no upper bound for the spectrum is given, it is estimated in init by
+ * some power iterations on D^{-1} A and enlarged by a safety factor.
+ *
+ *	References:
+ * <ul>
+ * <li> Y. Saad. Iterative methods for sparse linear systems, Alg. 12.1
+ * <li> M. Adams, M. Brezina, J. Hu, R. Tuminaro. Parallel multigrid smoothing:
+ * 		polynomial versus Gauss-Seidel. J. Comput. Phys. 188 (2003)
+ * </ul>
+ */
+template <typename TAlgebra>
+class Chebyshev : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	protected:
+		using base_type::approx_operator;
+
+	public:
+	///	default constructor
+		Chebyshev()
+			: m_degree(3), m_eigRatio(0.3), m_safety(1.1), m_numPowerIter(10),
+			  m_userLambdaMax(0), m_bL1(false), m_lambdaMin(0), m_lambdaMax(0)
+		{}
+
+	///	constructor setting the degree of the polynomial
+		Chebyshev(int degree)
+			: m_degree(3), m_eigRatio(0.3), m_safety(1.1), m_numPowerIter(10),
+			  m_userLambdaMax(0), m_bL1(false), m_lambdaMin(0), m_lambdaMax(0)
+		{
+			set_degree(degree);
+		}
+
+	/// clone constructor
+		Chebyshev(const Chebyshev<TAlgebra>& parent)
+			: base_type(parent),
+			  m_degree(parent.m_degree), m_eigRatio(parent.m_eigRatio),
+			  m_safety(parent.m_safety), m_numPowerIter(parent.m_numPowerIter),
+			  m_userLambdaMax(parent.m_userLambdaMax), m_bL1(parent.m_bL1),
+			  m_lambdaMin(0), m_lambdaMax(0)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new Chebyshev<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Destructor
+		virtual ~Chebyshev() {}
+
+	///	sets the degree of the polynomial, i.e. the number of matrix-vector products per application
+		void set_degree(int degree)
+		{
+			UG_COND_THROW(degree < 1, "Chebyshev: degree has to be at least 1.");
+			m_degree = degree;
+		}
+
+	///	sets the ratio between lower and upper bound of the smoothed spectrum (default 0.3)
+		void set_eigenvalue_ratio(number ratio)
+		{
+			UG_COND_THROW(ratio <= 0 || ratio >= 1, "Chebyshev: eigenvalue ratio has to be in (0, 1).");
+			m_eigRatio = ratio;
+		}
+
+	///	sets the factor by which the estimated largest eigenvalue is enlarged (default 1.1)
+		void set_safety_factor(number safety)	{m_safety = safety;}
+
+	///	sets the number of power iterations used to estimate the largest eigenvalue (default 10)
+		void set_power_iterations(int numIter)	{m_numPowerIter = numIter;}
+
+	///	sets the largest eigenvalue of D^{-1} A. If > 0 no estimation is performed.
+		void set_max_eigenvalue(number lambdaMax)	{m_userLambdaMax = lambdaMax;}
+
+	///	if true, the l1-Jacobi scaling is used as preconditioner
+		void set_l1(bool b)						{m_bL1 = b;}
+
+	///	returns the upper bound of the spectrum used in the last init
+		number max_eigenvalue() const			{return m_lambdaMax;}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "Chebyshev(degree = " << m_degree << ", eigenvalue ratio = " << m_eigRatio
+			   << ", " << (m_bL1 ? "l1-Jacobi" : "Jacobi") << " scaling";
+			if(m_lambdaMax > 0)
+				ss << ", spectrum = [" << m_lambdaMin << ", " << m_lambdaMax << "]";
+			ss << ")";
+			return ss.str();
+		}
+
+	protected:
+	///	Name of preconditioner
+		virtual const char* name() const {return "Chebyshev";}
+
+	///	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_preprocess, "algebra Chebyshev");
+
+			matrix_type &mat = *pOp;
+			const matrix_type &cmat = mat;
+			const size_t size = mat.num_rows();
+			if(size != mat.num_cols())
+			{
+				UG_LOG("Square Matrix needed for Chebyshev Iteration.\n");
+				return false;
+			}
+
+		//	collect the (l1-)diagonal
+#ifdef UG_PARALLEL
+			ParallelVector<Vector< typename matrix_type::value_type > > diag;
+			diag.resize(size);
+			diag.set_layouts(mat.layouts());
+#else
+			Vector< typename matrix_type::value_type > diag;
+			diag.resize(size);
+#endif
+			for(size_t i = 0; i < size; ++i)
+			{
+				diag[i] = mat(i, i);
+				if(!m_bL1) continue;
+
+				typename matrix_type::value_type& d = diag[i];
+				for(typename matrix_type::const_row_iterator it = cmat.begin_row(i);
+					it != cmat.end_row(i); ++it)
+				{
+					const typename matrix_type::value_type& a = it.value();
+					for(size_t r = 0; r < (size_t)GetRows(a); ++r)
+					{
+						number sum = 0;
+						for(size_t c = 0; c < (size_t)GetCols(a); ++c)
+							if(it.index() != i || r != c)
+								sum += std::fabs(BlockRef(a, r, c));
+						BlockRef(d, r, r) += sum;
+					}
+				}
+			}
+
+#ifdef UG_PARALLEL
+			diag.set_storage_type(PST_ADDITIVE);
+			diag.change_storage_type(PST_CONSISTENT);
+#endif
+
+			m_diagInv.resize(size);
+			for(size_t i = 0; i < size; ++i)
+				if(!GetInverse(m_diagInv[i], diag[i]))
+					UG_THROW("Chebyshev: diagonal block " << i << " is not invertible.");
+
+			if(m_userLambdaMax > 0)
+				m_lambdaMax = m_userLambdaMax;
+			else
+				m_lambdaMax = m_safety * estimate_max_eigenvalue(mat);
+
+			UG_COND_THROW(!(m_lambdaMax > 0), "Chebyshev: could not determine a positive "
+						  "upper bound for the spectrum of D^{-1}A (got " << m_lambdaMax << ").");
+			m_lambdaMin = m_eigRatio * m_lambdaMax;
+
+			return true;
+		}
+
+	///	computes c = p(D^{-1}A) D^{-1} d
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_step, "algebra Chebyshev");
+
+			matrix_type &mat = *pOp;
+			const number theta = 0.5 * (m_lambdaMax + m_lambdaMin);
+			const number delta = 0.5 * (m_lambdaMax - m_lambdaMin);
+			const number sigma = theta / delta;
+			number rho = 1. / sigma;
+
+			SmartPtr<vector_type> spR = d.clone();
+			SmartPtr<vector_type> spZ = d.clone_without_values();
+			SmartPtr<vector_type> spP = d.clone_without_values();
+			vector_type& r = *spR;
+			vector_type& z = *spZ;
+			vector_type& p = *spP;
+
+		//	first step: c = 1/theta D^{-1} d
+			apply_diag_inv(z, r);
+			VecScaleAssign(p, 1. / theta, z);
+			VecScaleAssign(c, 1.0, p);
+
+			for(int k = 1; k < m_degree; ++k)
+			{
+			//	r = d - A c
+				mat.matmul_minus(r, p);
+
+				const number rhoNew = 1. / (2. * sigma - rho);
+				apply_diag_inv(z, r);
+				VecScaleAdd(p, rhoNew * rho, p, 2. * rhoNew / delta, z);
+				VecScaleAdd(c, 1.0, c, 1.0, p);
+				rho = rhoNew;
+			}
+
+			return true;
+		}
+
+	///	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+	///	z = D^{-1} r, z is consistent afterwards
+		void apply_diag_inv(vector_type& z, const vector_type& r)
+		{
+			for(size_t i = 0; i < m_diagInv.size(); ++i)
+				MatMult(z[i], 1.0, m_diagInv[i], r[i]);
+
+#ifdef UG_PARALLEL
+			z.set_storage_type(PST_ADDITIVE);
+			z.change_storage_type(PST_CONSISTENT);
+#endif
+		}
+
+	///	estimates the largest eigenvalue of D^{-1}A by power iterations
+		number estimate_max_eigenvalue(const matrix_type& mat)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_estimate_max_eigenvalue, "algebra Chebyshev");
+
+			vector_type x;
+			x.resize(mat.num_rows());
+#ifdef UG_PARALLEL
+			x.set_layouts(mat.layouts());
+#endif
+			x.set_random(-1., 1.);
+
+			SmartPtr<vector_type> spY = x.clone_without_values();
+			vector_type& y = *spY;
+
+		//	note: the norm changes the storage type of x to unique, but the
+		//	application of the matrix needs a consistent vector
+			number norm = x.norm();
+			if(norm == 0) return 0;
+			x *= 1. / norm;
+#ifdef UG_PARALLEL
+			x.change_storage_type(PST_CONSISTENT);
+#endif
+
+			number lambda = 0;
+			for(int k = 0; k < m_numPowerIter; ++k)
+			{
+				mat.apply(y, x);
+				apply_diag_inv(x, y);
+				lambda = x.norm();
+				if(lambda == 0) return 0;
+				x *= 1. / lambda;
+#ifdef UG_PARALLEL
+				x.change_storage_type(PST_CONSISTENT);
+#endif
+			}
+
+			return lambda;
+		}
+
+	protected:
+	///	type of block-inverse
+		typedef typename block_traits<typename matrix_type::value_type>::inverse_type inverse_type;
+
+	///	inverse of the (l1-)diagonal
+		std::vector<inverse_type> m_diagInv;
+
+		int m_degree;
+		number m_eigRatio;
+		number m_safety;
+		int m_numPowerIter;
+		number m_userLambdaMax;
+		bool m_bL1;
+
+	///	smoothed interval of the spectrum of D^{-1}A
+		number m_lambdaMin, m_lambdaMax;
+};
+
+} // end namespace ug
+
+#endif
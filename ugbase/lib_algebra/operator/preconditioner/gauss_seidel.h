@@ -283,6 +283,164 @@ public:
 		}
 };
 
+
+/// Base class for Gauss-Seidel preconditioners in multicolor ordering
+/**
+ * In preprocess, a greedy coloring of the matrix graph is computed such that
+ * rows of the same color are not coupled. The sweeps then process the colors
+ * one after another and relax all rows of a color concurrently (using OpenMP
+ * threads if ug is compiled with OPENMP=ON). The convergence is that of a
+ * Gauss-Seidel method in the color-permuted ordering.
+ *
+ * \tparam	TAlgebra	Algebra type
+ */
+template <typename TAlgebra>
+class MulticolorGaussSeidelBase : public GaussSeidelBase<TAlgebra>
+{
+	typedef TAlgebra algebra_type;
+	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef GaussSeidelBase<TAlgebra> base_type;
+
+public:
+	/// constructor
+		MulticolorGaussSeidelBase() : base_type() {}
+
+	/// clone constructor
+		MulticolorGaussSeidelBase( const MulticolorGaussSeidelBase<TAlgebra> &parent )
+			: base_type(parent)
+		{	}
+
+	///	number of colors of the last preprocessed matrix
+		size_t num_colors() const {return m_colorStart.empty() ? 0 : m_colorStart.size() - 1;}
+
+protected:
+	//	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			if(!base_type::preprocess(pOp)) return false;
+
+			PROFILE_BEGIN_GROUP(MulticolorGaussSeidel_preprocess, "algebra gaussseidel");
+			const matrix_type *pA = &(*pOp);
+#ifdef UG_PARALLEL
+			if(pcl::NumProcs() > 1)
+				pA = &this->m_A;
+#endif
+			ComputeMulticoloring(*pA, m_color, m_colorStart, m_colorRows);
+			return true;
+		}
+
+protected:
+	///	color of each row
+		std::vector<int> m_color;
+
+	///	rows sorted by color and begin of each color in m_colorRows
+		std::vector<size_t> m_colorStart;
+		std::vector<size_t> m_colorRows;
+};
+
+/// Gauss-Seidel preconditioner for the 'forward' multicolor ordering of the dofs
+template <typename TAlgebra>
+class MulticolorGaussSeidel : public MulticolorGaussSeidelBase<TAlgebra>
+{
+	typedef TAlgebra algebra_type;
+	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef MulticolorGaussSeidelBase<TAlgebra> base_type;
+
+public:
+	//	Name of preconditioner
+		virtual const char* name() const {return "Multicolor Gauss-Seidel";}
+
+	/// constructor
+		MulticolorGaussSeidel() : base_type() {}
+
+	/// clone constructor
+		MulticolorGaussSeidel( const MulticolorGaussSeidel<TAlgebra> &parent )
+			: base_type(parent)
+		{	}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MulticolorGaussSeidel<algebra_type>(*this));
+		}
+
+	//	Stepping routine
+		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			mc_gs_step_LL(A, c, d, relax, this->m_color, this->m_colorStart, this->m_colorRows);
+		}
+};
+
+/// Gauss-Seidel preconditioner for the 'backward' multicolor ordering of the dofs
+template <typename TAlgebra>
+class MulticolorBackwardGaussSeidel : public MulticolorGaussSeidelBase<TAlgebra>
+{
+	typedef TAlgebra algebra_type;
+	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef MulticolorGaussSeidelBase<TAlgebra> base_type;
+
+public:
+	//	Name of preconditioner
+		virtual const char* name() const {return "Multicolor Backward Gauss-Seidel";}
+
+	/// constructor
+		MulticolorBackwardGaussSeidel() : base_type() {}
+
+	/// clone constructor
+		MulticolorBackwardGaussSeidel( const MulticolorBackwardGaussSeidel<TAlgebra> &parent )
+			: base_type(parent)
+		{	}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MulticolorBackwardGaussSeidel<algebra_type>(*this));
+		}
+
+	//	Stepping routine
+		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			mc_gs_step_UR(A, c, d, relax, this->m_color, this->m_colorStart, this->m_colorRows);
+		}
+};
+
+/// Symmetric Gauss-Seidel (SSOR) preconditioner in multicolor ordering
+template <typename TAlgebra>
+class MulticolorSymmetricGaussSeidel : public MulticolorGaussSeidelBase<TAlgebra>
+{
+	typedef TAlgebra algebra_type;
+	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef MulticolorGaussSeidelBase<TAlgebra> base_type;
+
+public:
+	//	Name of preconditioner
+		virtual const char* name() const {return "Multicolor Symmetric Gauss-Seidel";}
+
+	/// constructor
+		MulticolorSymmetricGaussSeidel() : base_type() {}
+
+	/// clone constructor
+		MulticolorSymmetricGaussSeidel( const MulticolorSymmetricGaussSeidel<TAlgebra> &parent )
+			: base_type(parent)
+		{	}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MulticolorSymmetricGaussSeidel<algebra_type>(*this));
+		}
+
+	//	Stepping routine
+		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			mc_sgs_step(A, c, d, relax, this->m_color, this->m_colorStart, this->m_colorRows);
+		}
+};
+
 } // end namespace ug
 
 #endif // __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__GAUSS_SEIDEL__
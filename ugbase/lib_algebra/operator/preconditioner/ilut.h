@@ -444,7 +444,58 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			return true;
 		}
 
+		using base_type::multi_apply;
+
 		virtual bool multi_apply(std::vector<vector_type> &vc, const std::vector<vector_type> &vd)
+		{
+			return multi_applyLU(vc, vd);
+		}
+
+	///	computes the corrections of several defects in one pass over L and U
+		virtual bool multi_step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp,
+		                        MultiVector<vector_type>& vc, const MultiVector<vector_type>& vd)
+		{
+#ifdef UG_PARALLEL
+			MultiVector<vector_type> vDtmp;
+			for(size_t k = 0; k < vd.size(); ++k){
+				SmartPtr<vector_type> spDtmp = vd[k].clone();
+				spDtmp->change_storage_type(PST_UNIQUE);
+				vDtmp.push_back(spDtmp);
+			}
+			bool b = multi_solve(vc, vDtmp);
+
+			for(size_t k = 0; k < vc.size(); ++k){
+				vc[k].set_storage_type(PST_ADDITIVE);
+				vc[k].change_storage_type(PST_CONSISTENT);
+			}
+			return b;
+#else
+			return multi_solve(vc, vd);
+#endif
+		}
+
+		virtual bool multi_solve(MultiVector<vector_type>& vc, const MultiVector<vector_type>& vd)
+		{
+			if(m_bSort == false || m_bSortIsIdentity)
+				return multi_applyLU(vc, vd);
+
+			PROFILE_BEGIN_GROUP(ILUT_MultiStepWithReorder, "ilut algebra");
+
+			MultiVector<vector_type> vc2;
+			for(size_t k = 0; k < vd.size(); ++k){
+				SetVectorAsPermutation(vc[k], vd[k], newIndex);
+				vc2.push_back(vc[k].clone_without_values());
+			}
+			if(multi_applyLU(vc2, vc) == false) return false;
+			for(size_t k = 0; k < vc.size(); ++k)
+				SetVectorAsPermutation(vc[k], vc2[k], oldIndex);
+			return true;
+		}
+
+	protected:
+	///	forward and backward substitution for several vectors (std::vector or MultiVector)
+		template <typename TVectors>
+		bool multi_applyLU(TVectors &vc, const TVectors &vd)
 		{
 			PROFILE_BEGIN_GROUP(ILUT_step, "ilut algebra");
 			// apply iterator: c = LU^{-1}*d (damp is not used)
@@ -527,6 +578,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			return true;
 		}
 
+	public:
 	//	Postprocess routine
 		virtual bool postprocess() {return true;}
 
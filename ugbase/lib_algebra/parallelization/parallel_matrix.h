@@ -40,6 +40,7 @@
 #include "algebra_layouts.h"
 #include "lib_algebra/common/operations.h"
 #include "parallel_vector.h"
+#include "lib_algebra/common/multi_vector.h"
 
 namespace ug
 {
@@ -136,6 +137,14 @@ class ParallelMatrix : public TMatrix
 		template<typename TPVector>
 		bool matmul_minus(TPVector &res, const TPVector &x) const;
 
+	/// calculate res[k] = A x[k] for all vectors of the block (one pass over A)
+		template<typename TPVector>
+		bool multi_apply(MultiVector<TPVector> &res, const MultiVector<TPVector> &x) const;
+
+	/// calculate res[k] -= A x[k] for all vectors of the block (one pass over A)
+		template<typename TPVector>
+		bool multi_matmul_minus(MultiVector<TPVector> &res, const MultiVector<TPVector> &x) const;
+
 	///	assignment
 		this_type &operator =(const this_type &M);
 
@@ -160,6 +169,22 @@ struct matrix_algebra_type_traits<ParallelMatrix<T> >
 	};
 };
 
+///	calculates dest[k] = A1*src[k] for all vectors of the block (one pass over A1)
+template<typename TPVector, typename TMatrix>
+inline void MatMultMulti(MultiVector<TPVector> &dest,
+		const ParallelMatrix<TMatrix> &A1, const MultiVector<TPVector> &src)
+{
+	A1.multi_apply(dest, src);
+}
+
+///	calculates dest[k] -= A1*src[k] for all vectors of the block (one pass over A1)
+template<typename TPVector, typename TMatrix>
+inline void MatMultMultiSub(MultiVector<TPVector> &dest,
+		const ParallelMatrix<TMatrix> &A1, const MultiVector<TPVector> &src)
+{
+	A1.multi_matmul_minus(dest, src);
+}
+
 } // end namespace ug
 
 #include "parallel_matrix_impl.h"
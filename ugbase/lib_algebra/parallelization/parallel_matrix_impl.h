@@ -117,6 +117,97 @@ apply(TPVector &res, const TPVector &x) const
 	return true;
 }
 
+// calculate res[k] = A x[k]
+template <typename TMatrix>
+template<typename TPVector>
+bool
+ParallelMatrix<TMatrix>::
+multi_apply(MultiVector<TPVector> &res, const MultiVector<TPVector> &x) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	UG_COND_THROW(res.size() != x.size(), "ParallelMatrix::multi_apply: "
+			"Number of vectors mismatch: res: "<<res.size()<<", x: "<<x.size());
+
+//	check types combinations
+	std::vector<int> vType(x.size(), -1);
+	for(size_t k = 0; k < x.size(); ++k)
+	{
+		if(has_storage_type(PST_ADDITIVE)
+				&& x[k].has_storage_type(PST_CONSISTENT)) vType[k] = 0;
+		if(has_storage_type(PST_CONSISTENT)
+				&& x[k].has_storage_type(PST_ADDITIVE)) vType[k] = 1;
+		if(has_storage_type(PST_CONSISTENT)
+				&& x[k].has_storage_type(PST_CONSISTENT)) vType[k] = 2;
+
+	//	if no admissible type is found, return error
+		if(vType[k] == -1)
+		{
+			UG_THROW("ParallelMatrix::multi_apply (b_k = A*x_k): "
+					"Wrong storage type of Matrix/Vector: Possibilities are:\n"
+					"    - A is PST_ADDITIVE and x_k is PST_CONSISTENT\n"
+					"    - A is PST_CONSISTENT and x_k is PST_ADDITIVE\n"
+					"    (storage type of A = " << get_storage_type() << ", x_"
+					<< k << " = " << x[k].get_storage_type() << ")");
+		}
+	}
+
+//	apply on single process vectors
+	TMatrix::multi_apply(res, x);
+
+//	set outgoing vectors to additive storage
+	for(size_t k = 0; k < res.size(); ++k)
+	{
+		switch(vType[k])
+		{
+			case 0: res[k].set_storage_type(PST_ADDITIVE); break;
+			case 1: res[k].set_storage_type(PST_ADDITIVE); break;
+			case 2: res[k].set_storage_type(PST_CONSISTENT); break;
+		}
+	}
+
+//	we're done.
+	return true;
+}
+
+// calculate res[k] -= A x[k]
+template <typename TMatrix>
+template<typename TPVector>
+bool
+ParallelMatrix<TMatrix>::
+multi_matmul_minus(MultiVector<TPVector> &res, const MultiVector<TPVector> &x) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	UG_COND_THROW(res.size() != x.size(), "ParallelMatrix::multi_matmul_minus: "
+			"Number of vectors mismatch: res: "<<res.size()<<", x: "<<x.size());
+
+//	check types combinations
+	for(size_t k = 0; k < x.size(); ++k)
+	{
+		if(!(this->has_storage_type(PST_ADDITIVE)
+				&& x[k].has_storage_type(PST_CONSISTENT)
+				&& res[k].has_storage_type(PST_ADDITIVE)))
+		{
+			UG_THROW("ParallelMatrix::multi_matmul_minus (b_k -= A*x_k):"
+					" Wrong storage type of Matrix/Vector: Possibilities are:\n"
+					"    - A is PST_ADDITIVE and x_k is PST_CONSISTENT and b_k is PST_ADDITIVE\n"
+					"    (storage type of A = " << this->get_storage_type() << ", x_"
+					<< k << " = " << x[k].get_storage_type() << ", b_" << k
+					<< " = " << res[k].get_storage_type() << ")");
+		}
+	}
+
+//	apply on single process vectors
+	TMatrix::multi_matmul_minus(res, x);
+
+//	set outgoing vectors to additive storage
+//	(they could have been PST_UNIQUE before)
+	for(size_t k = 0; k < res.size(); ++k)
+		res[k].set_storage_type(PST_ADDITIVE);
+
+//	we're done.
+	return true;
+}
+
 // calculate res = A.T x
 template <typename TMatrix>
 template<typename TPVector>
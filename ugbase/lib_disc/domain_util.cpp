@@ -36,14 +36,161 @@
 #include "common/util/file_util.h"
 #include "lib_grid/file_io/file_io.h"
 #include "lib_grid/file_io/file_io_ugx.h"
+#include "lib_grid/file_io/file_io_ugb.h"
 #include "lib_grid/algorithms/geom_obj_util/misc_util.h"
 #include "lib_grid/refinement/projectors/projection_handler.h"
 #include "common/profiler/profiler.h"
 
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_util.h"
+	#include "lib_grid/parallelization/distributed_grid.h"
+#endif
+
 using namespace std;
 
 namespace ug{
 
+///	name of the ugb file of the local process for the given pugb filename
+static string DistributedUGBFilename(const char* filename)
+{
+	string name(filename);
+	name = name.substr(0, name.rfind("."));
+	#ifdef UG_PARALLEL
+		AppendCounterToString(name, "_p", pcl::ProcRank(), pcl::NumProcs() - 1);
+	#else
+		AppendCounterToString(name, "_p", 0, 0);
+	#endif
+	return name.append(".ugb");
+}
+
+///	reads grid, subset handlers and projection handler of a domain from an opened ugb file
+template <typename TDomain>
+static void ReadDomainFromUGB(TDomain& domain, GridReaderUGB& ugbReader)
+{
+	ugbReader.grid(*domain.grid(), domain.position_attachment());
+
+	if(ugbReader.num_subset_handlers() > 0)
+		ugbReader.subset_handler(*domain.subset_handler(), 0);
+
+	vector<string> additionalSHNames = domain.additional_subset_handler_names();
+	for(size_t i_name = 0; i_name < additionalSHNames.size(); ++i_name){
+		string shName = additionalSHNames[i_name];
+		for(size_t i_sh = 0; i_sh < ugbReader.num_subset_handlers(); ++i_sh){
+			if(shName == ugbReader.get_subset_handler_name(i_sh)){
+				ugbReader.subset_handler(*domain.additional_subset_handler(shName), i_sh);
+			}
+		}
+	}
+
+	if(ugbReader.num_projection_handlers() > 0){
+		SPProjectionHandler ph = make_sp(
+				new ProjectionHandler(domain.geometry3d(), domain.subset_handler()));
+		ugbReader.projection_handler(*ph, 0);
+		size_t shIndex = ugbReader.get_projection_handler_subset_handler_index(0);
+		if (shIndex > 0)
+		{
+			std::string shName = ugbReader.get_subset_handler_name(shIndex);
+			try {ph->set_subset_handler(domain.additional_subset_handler(shName));}
+			UG_CATCH_THROW("Additional subset handler '"<< shName << "' has not been added to the domain.\n"
+					       "Do so by using Domain::create_additional_subset_handler(std::string name).");
+		}
+		domain.set_refinement_projector(ph);
+	}
+}
+
+///	writes the domain to a ugb file. If withLayouts, the local grid layouts are written, too.
+template <typename TDomain>
+static void WriteDomainToUGB(TDomain& domain, const char* filename, bool withLayouts)
+{
+	GridWriterUGB ugbWriter;
+	ugbWriter.add_grid(*domain.grid(), domain.position_attachment());
+	ugbWriter.add_subset_handler(*domain.subset_handler(), "defSH");
+
+	vector<string> additionalSHNames = domain.additional_subset_handler_names();
+	for(size_t i_name = 0; i_name < additionalSHNames.size(); ++i_name){
+		const char* shName = additionalSHNames[i_name].c_str();
+		ugbWriter.add_subset_handler(*domain.additional_subset_handler(shName), shName);
+	}
+
+	ProjectionHandler* ph = dynamic_cast<ProjectionHandler*>(
+								domain.refinement_projector().get());
+	if(ph)
+		ugbWriter.add_projection_handler(*ph, "defPH");
+
+	#ifdef UG_PARALLEL
+		if(withLayouts)
+			ugbWriter.add_layout_map(domain.grid()->distributed_grid_manager()->grid_layout_map());
+	#endif
+
+	try {ugbWriter.write_to_file(filename);}
+	UG_CATCH_THROW("Couldn't save domain to the specified file: " << filename);
+}
+
+///	loads the local part of a distributed domain on each process
+/**	Each process reads the ugb file written by the process with the same rank
+ * (see DistributedUGBFilename) and restores the grid layouts stored in it.
+ * No redistribution takes place. The domain has to be saved and loaded with
+ * the same number of processes.*/
+template <typename TDomain>
+static void LoadDistributedDomain(TDomain& domain, const char* filename)
+{
+	string nfilename = FindFileInStandardPaths(DistributedUGBFilename(filename).c_str());
+
+//	make sure that all processes found their files, before anything is created
+	GridReaderUGB ugbReader;
+	string errMsg;
+	try{
+		if(nfilename.empty())
+			UG_THROW("File not found: " << DistributedUGBFilename(filename));
+		ugbReader.open(nfilename.c_str());
+
+		int numProcs = 1;
+		#ifdef UG_PARALLEL
+			numProcs = pcl::NumProcs();
+		#endif
+		if(numProcs > 1 && !ugbReader.has_layout_map())
+			UG_THROW("File " << nfilename << " doesn't contain grid layouts.");
+		if(ugbReader.has_layout_map() && ugbReader.layout_map_num_procs() != numProcs)
+			UG_THROW("File " << nfilename << " was written by "
+					 << ugbReader.layout_map_num_procs() << " processes, but "
+					 << numProcs << " processes are used to load it.");
+	}
+	catch(UGError& err){
+		errMsg = err.get_msg();
+	}
+
+	#ifdef UG_PARALLEL
+		if(!pcl::AllProcsTrue(errMsg.empty())){
+			UG_THROW("ERROR in LoadDomain: Couldn't load the distributed domain "
+					 << filename << " on all processes. Local message: " << errMsg);
+		}
+	#else
+		UG_COND_THROW(!errMsg.empty(), "ERROR in LoadDomain: " << errMsg);
+	#endif
+
+//	all processes load their part of the grid
+	domain.grid()->message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS, -2));
+
+	#ifdef UG_PARALLEL
+		DistributedGridManager& dgm = *domain.grid()->distributed_grid_manager();
+		dgm.enable_interface_management(false);
+	#endif
+
+	ReadDomainFromUGB(domain, ugbReader);
+
+	#ifdef UG_PARALLEL
+		if(ugbReader.has_layout_map()){
+			GridLayoutMap& glm = dgm.grid_layout_map();
+			glm.clear();
+			ugbReader.layout_map(glm);
+		}
+		dgm.enable_interface_management(true);
+		dgm.grid_layouts_changed(false);
+	#endif
+
+	domain.grid()->message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS, -2));
+}
+
 template <typename TDomain>
 void LoadDomain(TDomain& domain, const char* filename)
 {
@@ -52,8 +199,11 @@ void LoadDomain(TDomain& domain, const char* filename)
 
 
 // Use procId = -2 (i.e., 4294967294 for 32bit int) to achieve loading on all procs.
+//	If pAttachmentNames is specified, only the attachments with the given names
+//	are read from ugx files.
 template <typename TDomain>
-void LoadDomain(TDomain& domain, const char* filename, int procId)
+static void LoadDomain(TDomain& domain, const char* filename, int procId,
+					   const std::vector<std::string>* pAttachmentNames)
 {
 	PROFILE_FUNC_GROUP("grid");
 	if(GetFilenameExtension(string(filename)) == string("ugx")){
@@ -69,6 +219,9 @@ void LoadDomain(TDomain& domain, const char* filename, int procId)
 			string nfilename = FindFileInStandardPaths(filename);
 			if(!nfilename.empty()){
 				GridReaderUGX ugxReader;
+				if(pAttachmentNames)
+					ugxReader.set_attachments_to_load(*pAttachmentNames);
+
 				if(!ugxReader.parse_file(nfilename.c_str())){
 					UG_THROW("An error occured while parsing '" << nfilename << "'");
 				}
@@ -114,6 +267,30 @@ void LoadDomain(TDomain& domain, const char* filename, int procId)
 		}
 		domain.grid()->message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS, procId));
 	}
+	else if(GetFilenameExtension(string(filename)) == string("ugb")){
+		domain.grid()->message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS, procId));
+
+		bool loadingGrid = true;
+		#ifdef UG_PARALLEL
+			if((procId != -1) && (procId != -2) && (pcl::ProcRank() != procId))
+				loadingGrid = false;
+		#endif
+
+		if(loadingGrid){
+			string nfilename = FindFileInStandardPaths(filename);
+			if(nfilename.empty()){
+				UG_THROW("ERROR in LoadDomain: File not found: " << filename);
+			}
+
+			GridReaderUGB ugbReader;
+			ugbReader.open(nfilename.c_str());
+			ReadDomainFromUGB(domain, ugbReader);
+		}
+		domain.grid()->message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS, procId));
+	}
+	else if(GetFilenameExtension(string(filename)) == string("pugb")){
+		LoadDistributedDomain(domain, filename);
+	}
 	else if(!LoadGridFromFile(*domain.grid(), *domain.subset_handler(),
 						 filename, domain.position_attachment(), procId))
 	{
@@ -121,6 +298,19 @@ void LoadDomain(TDomain& domain, const char* filename, int procId)
 	}
 }
 
+template <typename TDomain>
+void LoadDomain(TDomain& domain, const char* filename, int procId)
+{
+	LoadDomain(domain, filename, procId, NULL);
+}
+
+template <typename TDomain>
+void LoadDomain(TDomain& domain, const char* filename, int procId,
+				const std::vector<std::string>& attachmentNames)
+{
+	LoadDomain(domain, filename, procId, &attachmentNames);
+}
+
 
 template <typename TDomain>
 void SaveDomain(TDomain& domain, const char* filename)
@@ -141,6 +331,12 @@ void SaveDomain(TDomain& domain, const char* filename)
 			UG_THROW("Couldn't save domain to the specified file: " << filename);
 		}
 	}
+	else if(GetFilenameExtension(string(filename)) == string("ugb")){
+		WriteDomainToUGB(domain, filename, false);
+	}
+	else if(GetFilenameExtension(string(filename)) == string("pugb")){
+		WriteDomainToUGB(domain, DistributedUGBFilename(filename).c_str(), true);
+	}
 	else if(!SaveGridToFile(*domain.grid(), *domain.subset_handler(),
 						  filename, domain.position_attachment()))
 		UG_THROW("SaveDomain: Could not save to file: "<<filename);
@@ -164,6 +360,10 @@ template void LoadDomain<Domain1d>(Domain1d& domain, const char* filename, int p
 template void LoadDomain<Domain2d>(Domain2d& domain, const char* filename, int procId);
 template void LoadDomain<Domain3d>(Domain3d& domain, const char* filename, int procId);
 
+template void LoadDomain<Domain1d>(Domain1d& domain, const char* filename, int procId, const std::vector<std::string>& attachmentNames);
+template void LoadDomain<Domain2d>(Domain2d& domain, const char* filename, int procId, const std::vector<std::string>& attachmentNames);
+template void LoadDomain<Domain3d>(Domain3d& domain, const char* filename, int procId, const std::vector<std::string>& attachmentNames);
+
 template void SaveDomain<Domain1d>(Domain1d& domain, const char* filename);
 template void SaveDomain<Domain2d>(Domain2d& domain, const char* filename);
 template void SaveDomain<Domain3d>(Domain3d& domain, const char* filename);
@@ -45,6 +45,12 @@ namespace ug{
 /**	By optionally specifying a procId, you can make sure that the domain is only
  * loaded on one process. Pass -1, if you want to load it on all processes.
  * Note that the procId is only important in parallel environments.
+ *
+ * If the filename has the extension 'pugb', each process loads the ugb file
+ * which was written by the process with the same rank through SaveDomain
+ * (e.g. 'grid_p3.ugb' for 'grid.pugb'), including the grid layouts. The
+ * distribution is thus restored without any redistribution. procId is ignored
+ * in this case and the number of processes has to match.
  * \{
  */
 template <typename TDomain>
@@ -52,9 +58,23 @@ void LoadDomain(TDomain& domain, const char* filename);
 
 template <typename TDomain>
 void LoadDomain(TDomain& domain, const char* filename, int procId);
+
+///	Loads a domain but reads only the given attachments from ugx files.
+/**	Attachments stored in ugx files are normally all read together with the grid.
+ * Here only the attachments whose names are listed in attachmentNames are read,
+ * the values of all others are never loaded from the file. Pass an empty list
+ * to skip all attachments. For all other file types this is the same as
+ * LoadDomain(domain, filename, procId).*/
+template <typename TDomain>
+void LoadDomain(TDomain& domain, const char* filename, int procId,
+				const std::vector<std::string>& attachmentNames);
 /**	\} */
 
 ///	Saves the domain to a grid-file.
+/**	If the filename has the extension 'pugb', each process writes its local part
+ * of the distributed domain together with its grid layouts to a separate ugb
+ * file (e.g. 'grid_p3.ugb' for 'grid.pugb'). The domain can then be loaded
+ * through LoadDomain with the same number of processes.*/
 template <typename TDomain>
 void SaveDomain(TDomain& domain, const char* filename);
 
@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG_grid_function_checkpoint
+#define __H__UG_grid_function_checkpoint
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+#include "common/common.h"
+#include "common/util/binary_buffer.h"
+#include "lib_algebra/small_algebra/blocks.h"
+#include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/parallel_file.h"
+	#include "lib_grid/parallelization/distributed_grid.h"
+#endif
+
+namespace ug{
+
+/**	\page pageGridFunctionCheckpoint Checkpoints of grid functions
+ *
+ * In contrast to SaveToFile / ReadFromFile, which store the raw algebra vector
+ * of each process, checkpoints identify each degree of freedom by the element
+ * it belongs to. An element is identified by its base object type, its level
+ * in the multigrid hierarchy and its center. A checkpoint can thus be read with
+ * a different number of processes or after a redistribution of the grid, as
+ * long as the same grid hierarchy and approximation space are used.
+ *
+ * A checkpoint is a single binary file in native byte order. It consists of
+ *  - the header (GridFunctionCheckpointHeader),
+ *  - the chunk table (one GridFunctionCheckpointChunkInfo per chunk),
+ *  - the chunks. A chunk contains one record per element: int32 {baseObjectId,
+ *    level, numValues, 0}, double center[dim] and double values[numValues].
+ *
+ * In parallel, each process writes its records as one chunk through MPI-IO
+ * into the same file. h-slaves are skipped. The chunk table stores the
+ * bounding box of the element centers of each chunk, so that a process only
+ * has to read those chunks which may contain its elements.
+ */
+
+///	identifies an element in a checkpoint
+template <int dim>
+struct GridFunctionCheckpointKey
+{
+	int				baseObjId;
+	int				level;
+	MathVector<dim>	center;
+
+///	centers are compared exactly
+/**	The center of an element is computed from the same positions in the same
+ * order on every process, so it is reproduced bitwise. Note that the operator<
+ * of MathVector compares with a tolerance and thus is no strict weak ordering.*/
+	bool operator<(const GridFunctionCheckpointKey& k) const
+	{
+		if(baseObjId != k.baseObjId) return baseObjId < k.baseObjId;
+		if(level != k.level) return level < k.level;
+		for(int i = 0; i < dim; ++i)
+			if(center[i] != k.center[i]) return center[i] < k.center[i];
+		return false;
+	}
+};
+
+static const char GRID_FUNCTION_CHECKPOINT_MAGIC[8] =
+						{'U', 'G', 'C', 'H', 'K', 'P', 'T', '\0'};
+static const int GRID_FUNCTION_CHECKPOINT_VERSION = 2;
+
+///	Header of a checkpoint file
+struct GridFunctionCheckpointHeader
+{
+	char	magic[8];
+	int32	version;
+	int32	dim;
+	uint64	numChunks;
+};
+
+///	Describes the location and the bounding box of the element centers of a chunk
+struct GridFunctionCheckpointChunkInfo
+{
+	uint64	offset;
+	uint64	size;
+	uint64	numRecords;
+	double	minCenter[3];
+	double	maxCenter[3];
+};
+
+
+template <typename TGridFunction, typename TElem>
+GridFunctionCheckpointKey<TGridFunction::dim>
+GetGridFunctionCheckpointKey(const TGridFunction& u, TElem* elem)
+{
+	GridFunctionCheckpointKey<TGridFunction::dim> key;
+	key.baseObjId = TElem::BASE_OBJECT_ID;
+	key.level = u.domain()->grid()->get_level(elem);
+	typename TGridFunction::domain_type::position_accessor_type aaPos
+												= u.domain()->position_accessor();
+	key.center = CalculateCenter(elem, aaPos);
+	return key;
+}
+
+
+///	extends the bounding box of a chunk by the given center
+template <std::size_t dim>
+void ExtendGridFunctionCheckpointChunk(GridFunctionCheckpointChunkInfo& chunk,
+									   const MathVector<dim>& center)
+{
+	for(std::size_t i = 0; i < dim; ++i){
+		if(chunk.numRecords == 0 || center[i] < chunk.minCenter[i])
+			chunk.minCenter[i] = center[i];
+		if(chunk.numRecords == 0 || center[i] > chunk.maxCenter[i])
+			chunk.maxCenter[i] = center[i];
+	}
+	++chunk.numRecords;
+}
+
+
+///	appends the records of all elements of type TElem to buf
+template <typename TGridFunction, typename TElem>
+void WriteGridFunctionCheckpointRecords(BinaryBuffer& buf,
+										GridFunctionCheckpointChunkInfo& chunk,
+										const TGridFunction& u)
+{
+	typedef typename TGridFunction::template traits<TElem>::const_iterator iter_t;
+	static const int dim = TGridFunction::dim;
+
+	if(u.dd()->max_dofs(TElem::BASE_OBJECT_ID) == 0)
+		return;
+
+	#ifdef UG_PARALLEL
+		const DistributedGridManager* dgm = u.domain()->grid()->distributed_grid_manager();
+	#endif
+
+	std::vector<size_t> ind;
+	std::vector<double> vals;
+	for(iter_t iter = u.template begin<TElem>(); iter != u.template end<TElem>(); ++iter)
+	{
+		TElem* elem = *iter;
+		#ifdef UG_PARALLEL
+			if(dgm && dgm->contains_status(elem, ES_H_SLAVE))
+				continue;
+		#endif
+
+		u.inner_algebra_indices(elem, ind);
+		if(ind.empty())
+			continue;
+
+		vals.clear();
+		for(size_t i = 0; i < ind.size(); ++i){
+			for(size_t j = 0; j < GetSize(u[ind[i]]); ++j)
+				vals.push_back(BlockRef(u[ind[i]], j));
+		}
+
+		GridFunctionCheckpointKey<dim> key = GetGridFunctionCheckpointKey(u, elem);
+		int info[4] = {key.baseObjId, key.level, (int)vals.size(), 0};
+		double center[dim];
+		for(int i = 0; i < dim; ++i)
+			center[i] = key.center[i];
+
+		buf.write((const char*)info, sizeof(info));
+		buf.write((const char*)center, sizeof(center));
+		buf.write((const char*)&vals.front(), vals.size() * sizeof(double));
+
+		ExtendGridFunctionCheckpointChunk(chunk, key.center);
+	}
+}
+
+
+///	algebra indices of an element and whether its values were found in a checkpoint
+struct GridFunctionCheckpointEntry
+{
+	GridFunctionCheckpointEntry() : found(false)	{}
+	std::vector<size_t>	ind;
+	bool				found;
+};
+
+///	collects the algebra indices of all elements of type TElem, except of h-slaves
+/**	The bounding box of the centers of the collected elements is stored in box.*/
+template <typename TGridFunction, typename TElem>
+void CollectGridFunctionCheckpointIndices(
+		std::map<GridFunctionCheckpointKey<TGridFunction::dim>,
+				 GridFunctionCheckpointEntry>& indMap,
+		GridFunctionCheckpointChunkInfo& box,
+		const TGridFunction& u)
+{
+	typedef typename TGridFunction::template traits<TElem>::const_iterator iter_t;
+
+	if(u.dd()->max_dofs(TElem::BASE_OBJECT_ID) == 0)
+		return;
+
+	#ifdef UG_PARALLEL
+		const DistributedGridManager* dgm = u.domain()->grid()->distributed_grid_manager();
+	#endif
+
+	std::vector<size_t> ind;
+	for(iter_t iter = u.template begin<TElem>(); iter != u.template end<TElem>(); ++iter)
+	{
+		TElem* elem = *iter;
+		#ifdef UG_PARALLEL
+			if(dgm && dgm->contains_status(elem, ES_H_SLAVE))
+				continue;
+		#endif
+
+		u.inner_algebra_indices(elem, ind);
+		if(!ind.empty()){
+			GridFunctionCheckpointKey<TGridFunction::dim> key
+											= GetGridFunctionCheckpointKey(u, elem);
+			indMap[key].ind = ind;
+			ExtendGridFunctionCheckpointChunk(box, key.center);
+		}
+	}
+}
+
+
+///	writes the values of a grid function to a process-count-independent checkpoint
+/**	The vector is made consistent before writing (on a copy).
+ * \sa pageGridFunctionCheckpoint*/
+template <typename TGridFunction>
+void SaveGridFunctionCheckpoint(const TGridFunction& u, const char* filename)
+{
+	PROFILE_FUNC_GROUP("gridfunction");
+	static const int dim = TGridFunction::dim;
+
+	SmartPtr<TGridFunction> spTmp = u.clone();
+	#ifdef UG_PARALLEL
+		spTmp->change_storage_type(PST_CONSISTENT);
+	#endif
+
+	BinaryBuffer buf;
+	GridFunctionCheckpointChunkInfo chunk;
+	memset(&chunk, 0, sizeof(chunk));
+	WriteGridFunctionCheckpointRecords<TGridFunction, Vertex>(buf, chunk, *spTmp);
+	WriteGridFunctionCheckpointRecords<TGridFunction, Edge>(buf, chunk, *spTmp);
+	WriteGridFunctionCheckpointRecords<TGridFunction, Face>(buf, chunk, *spTmp);
+	WriteGridFunctionCheckpointRecords<TGridFunction, Volume>(buf, chunk, *spTmp);
+	chunk.size = buf.write_pos();
+
+//	collect the chunk infos of all processes
+	int rank = 0;
+	std::vector<GridFunctionCheckpointChunkInfo> table(1, chunk);
+	#ifdef UG_PARALLEL
+		pcl::ProcessCommunicator pc;
+		rank = pc.get_local_proc_id();
+		table.resize(pc.size());
+		pc.allgather(&chunk, sizeof(chunk), PCL_DT_BYTE,
+					 &table.front(), sizeof(chunk), PCL_DT_BYTE);
+	#endif
+
+//	the first process writes the header and the chunk table in front of its chunk
+	std::vector<char> data;
+	if(rank == 0){
+		GridFunctionCheckpointHeader h;
+		memset(&h, 0, sizeof(h));
+		memcpy(h.magic, GRID_FUNCTION_CHECKPOINT_MAGIC, 8);
+		h.version = GRID_FUNCTION_CHECKPOINT_VERSION;
+		h.dim = dim;
+		h.numChunks = table.size();
+
+		uint64 offset = sizeof(h) + table.size() * sizeof(GridFunctionCheckpointChunkInfo);
+		for(size_t i = 0; i < table.size(); ++i){
+			table[i].offset = offset;
+			offset += table[i].size;
+		}
+
+		data.resize(sizeof(h) + table.size() * sizeof(GridFunctionCheckpointChunkInfo));
+		memcpy(&data.front(), &h, sizeof(h));
+		memcpy(&data.front() + sizeof(h), &table.front(),
+			   table.size() * sizeof(GridFunctionCheckpointChunkInfo));
+	}
+	data.insert(data.end(), buf.buffer(), buf.buffer() + buf.write_pos());
+
+	#ifdef UG_PARALLEL
+		pcl::WriteConcatenatedParallelFile(GetDataPtr(data), data.size(), filename, 0, pc);
+	#else
+		std::ofstream out(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+		UG_COND_THROW(!out, "SaveGridFunctionCheckpoint: Couldn't open file " << filename);
+		out.write(GetDataPtr(data), data.size());
+		UG_COND_THROW(!out, "SaveGridFunctionCheckpoint: Couldn't write file " << filename);
+	#endif
+}
+
+
+///	reads the given extents (offset, size) of a checkpoint file
+/**	In parallel, this has to be called by all processes (collective MPI-IO).*/
+inline void ReadGridFunctionCheckpointExtents(std::vector<char>& dataOut,
+		const char* filename, const std::vector<std::pair<size_t, size_t> >& extents)
+{
+	#ifdef UG_PARALLEL
+		pcl::ReadParallelFileExtents(dataOut, filename, extents);
+	#else
+		size_t totalSize = 0;
+		for(size_t i = 0; i < extents.size(); ++i)
+			totalSize += extents[i].second;
+		dataOut.resize(totalSize);
+
+		std::ifstream in(filename, std::ios::in | std::ios::binary);
+		UG_COND_THROW(!in, "LoadGridFunctionCheckpoint: Couldn't open file " << filename);
+		char* dest = GetDataPtr(dataOut);
+		for(size_t i = 0; i < extents.size(); ++i){
+			in.seekg(extents[i].first);
+			in.read(dest, extents[i].second);
+			UG_COND_THROW(!in, "LoadGridFunctionCheckpoint: Unexpected end of file "
+						  << filename);
+			dest += extents[i].second;
+		}
+	#endif
+}
+
+///	reads the header and the chunk table of a checkpoint file
+/**	In parallel, only the first process reads them and broadcasts them to all
+ * other processes. Has to be called by all processes.*/
+inline void ReadGridFunctionCheckpointTable(
+		std::vector<GridFunctionCheckpointChunkInfo>& tableOut,
+		const char* filename, int dim)
+{
+	int rank = 0;
+	#ifdef UG_PARALLEL
+		pcl::ProcessCommunicator pc;
+		rank = pc.get_local_proc_id();
+	#endif
+
+	std::vector<char> data;
+	std::vector<std::pair<size_t, size_t> > extents;
+	if(rank == 0)
+		extents.push_back(std::make_pair(size_t(0), sizeof(GridFunctionCheckpointHeader)));
+	ReadGridFunctionCheckpointExtents(data, filename, extents);
+
+	GridFunctionCheckpointHeader h;
+	if(rank == 0)
+		memcpy(&h, GetDataPtr(data), sizeof(h));
+	#ifdef UG_PARALLEL
+		pc.broadcast(&h, sizeof(h), PCL_DT_BYTE, 0);
+	#endif
+
+	UG_COND_THROW(memcmp(h.magic, GRID_FUNCTION_CHECKPOINT_MAGIC, 8) != 0,
+				  "LoadGridFunctionCheckpoint: " << filename << " is not a checkpoint file.");
+	UG_COND_THROW(h.version != GRID_FUNCTION_CHECKPOINT_VERSION,
+				  "LoadGridFunctionCheckpoint: Unsupported version " << h.version
+				  << " of file " << filename);
+	UG_COND_THROW(h.dim != dim, "LoadGridFunctionCheckpoint: The checkpoint "
+				  << filename << " was written for dimension " << h.dim
+				  << ", but the grid function has dimension " << dim);
+
+	tableOut.resize(h.numChunks);
+	if(tableOut.empty())
+		return;
+
+	const size_t tableSize = h.numChunks * sizeof(GridFunctionCheckpointChunkInfo);
+	extents.clear();
+	if(rank == 0)
+		extents.push_back(std::make_pair(sizeof(h), tableSize));
+	ReadGridFunctionCheckpointExtents(data, filename, extents);
+
+	if(rank == 0)
+		memcpy(&tableOut.front(), GetDataPtr(data), tableSize);
+	#ifdef UG_PARALLEL
+		pc.broadcast(&tableOut.front(), tableSize, PCL_DT_BYTE, 0);
+	#endif
+}
+
+
+///	reads the values of a grid function from a checkpoint
+/**	Each process only reads those chunks of the file, whose bounding box
+ * overlaps with the bounding box of its local elements. All local elements
+ * carrying DoFs have to be found in the checkpoint. The resulting vector is
+ * consistent.
+ * \sa pageGridFunctionCheckpoint*/
+template <typename TGridFunction>
+void LoadGridFunctionCheckpoint(TGridFunction& u, const char* filename)
+{
+	PROFILE_FUNC_GROUP("gridfunction");
+	static const int dim = TGridFunction::dim;
+	typedef GridFunctionCheckpointKey<dim>			key_t;
+	typedef std::map<key_t, GridFunctionCheckpointEntry>	index_map_t;
+
+	index_map_t indMap;
+	GridFunctionCheckpointChunkInfo box;
+	memset(&box, 0, sizeof(box));
+	CollectGridFunctionCheckpointIndices<TGridFunction, Vertex>(indMap, box, u);
+	CollectGridFunctionCheckpointIndices<TGridFunction, Edge>(indMap, box, u);
+	CollectGridFunctionCheckpointIndices<TGridFunction, Face>(indMap, box, u);
+	CollectGridFunctionCheckpointIndices<TGridFunction, Volume>(indMap, box, u);
+
+	std::vector<GridFunctionCheckpointChunkInfo> table;
+	ReadGridFunctionCheckpointTable(table, filename, dim);
+
+//	select the chunks which may contain local elements
+	std::vector<std::pair<size_t, size_t> > extents;
+	for(size_t i = 0; i < table.size(); ++i){
+		const GridFunctionCheckpointChunkInfo& c = table[i];
+		if(box.numRecords == 0 || c.numRecords == 0)
+			continue;
+
+		bool overlaps = true;
+		for(int d = 0; d < dim; ++d){
+			if(c.maxCenter[d] < box.minCenter[d] || c.minCenter[d] > box.maxCenter[d])
+				overlaps = false;
+		}
+		if(overlaps)
+			extents.push_back(std::make_pair((size_t)c.offset, (size_t)c.size));
+	}
+
+	std::vector<char> data;
+	ReadGridFunctionCheckpointExtents(data, filename, extents);
+
+	u.set(0.0);
+
+	const size_t headerSize = 4 * sizeof(int) + dim * sizeof(double);
+	size_t pos = 0;
+	double center[dim];
+	std::vector<double> vals;
+	while(pos < data.size()){
+		int info[4];
+		UG_COND_THROW(pos + headerSize > data.size(), "LoadGridFunctionCheckpoint: "
+					  "Unexpected end of chunk in file " << filename);
+		memcpy(info, &data[pos], sizeof(info));
+		memcpy(center, &data[pos + sizeof(info)], sizeof(center));
+		pos += headerSize;
+
+		UG_COND_THROW(info[2] < 0 || pos + info[2] * sizeof(double) > data.size(),
+					  "LoadGridFunctionCheckpoint: Unexpected end of chunk in file "
+					  << filename);
+		vals.resize(info[2]);
+		if(info[2] > 0)
+			memcpy(&vals.front(), &data[pos], info[2] * sizeof(double));
+		pos += info[2] * sizeof(double);
+
+		key_t key;
+		key.baseObjId = info[0];
+		key.level = info[1];
+		for(int i = 0; i < dim; ++i)
+			key.center[i] = center[i];
+
+	//	elements may be contained several times (e.g. ghosts)
+		typename index_map_t::iterator iter = indMap.find(key);
+		if(iter == indMap.end() || iter->second.found)
+			continue;
+
+		const std::vector<size_t>& ind = iter->second.ind;
+		size_t numVals = 0;
+		for(size_t i = 0; i < ind.size(); ++i)
+			numVals += GetSize(u[ind[i]]);
+		UG_COND_THROW(numVals != vals.size(), "LoadGridFunctionCheckpoint: "
+					  "Number of values of an element in the checkpoint doesn't "
+					  "match the approximation space.");
+
+		size_t curVal = 0;
+		for(size_t i = 0; i < ind.size(); ++i){
+			for(size_t j = 0; j < GetSize(u[ind[i]]); ++j)
+				BlockRef(u[ind[i]], j) = vals[curVal++];
+		}
+
+		iter->second.found = true;
+	}
+
+	size_t numMissing = 0;
+	for(typename index_map_t::iterator iter = indMap.begin(); iter != indMap.end(); ++iter)
+		if(!iter->second.found)
+			++numMissing;
+
+	#ifdef UG_PARALLEL
+	//	h-slaves were skipped. Their values are copied from their masters.
+		u.set_storage_type(PST_UNIQUE);
+		u.change_storage_type(PST_CONSISTENT);
+		pcl::ProcessCommunicator commWorld;
+		numMissing = commWorld.allreduce(numMissing, PCL_RO_SUM);
+	#endif
+
+	UG_COND_THROW(numMissing > 0, "LoadGridFunctionCheckpoint: The values of "
+				  << numMissing << " elements couldn't be found in " << filename
+				  << ". Make sure to use the same grid hierarchy and approximation "
+				  "space as when writing the checkpoint.");
+}
+
+}//	end of namespace
+
+#endif	//__H__UG_grid_function_checkpoint
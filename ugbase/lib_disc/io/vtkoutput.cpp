@@ -33,6 +33,10 @@
 #include "vtkoutput.h"
 #include <sstream>
 
+#ifdef UG_PARALLEL
+#include "pcl/parallel_file.h"
+#endif
+
 namespace ug{
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -64,7 +68,8 @@ print(const char* filename, Domain<TDim>& domain)
 //	get name for *.vtu file
 	std::string name;
 	try{
-		vtu_filename(name, filename, rank, si, sh.num_subsets()-1, -1);
+		vtu_filename(name, filename, single_file_output() ? -1 : rank, si,
+		             sh.num_subsets()-1, -1);
 	}
 	UG_CATCH_THROW("VTK::print_subset: Can not write vtu - file.");
 
@@ -72,18 +77,11 @@ print(const char* filename, Domain<TDim>& domain)
 //	open the file
 	try
 	{
-	VTKFileWriter File(name.c_str());
-
-//	header
-	File << VTKFileWriter::normal;
-	File << "<?xml version=\"1.0\"?>\n";
-	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-	if(IsLittleEndian()) File << "LittleEndian";
-	else File << "BigEndian";
-	File << "\">\n";
+	VTKFileWriter File;
+	open_vtu_file(File, name);
 
-//	opening the grid
-	File << "  <UnstructuredGrid>\n";
+//	header and opening of the grid
+	write_vtu_header(File);
 
 // 	get dimension of grid-piece
 	int dim = DimensionOfSubsets(sh);
@@ -112,8 +110,8 @@ print(const char* filename, Domain<TDim>& domain)
 	}
 
 //	write closing xml tags
-	File << "  </UnstructuredGrid>\n";
-	File << "</VTKFile>\n";
+	write_vtu_footer(File);
+	close_vtu_file(File, name);
 
 // 	detach help indices
 	grid.detach_from_vertices(aVrtIndex);
@@ -135,7 +133,7 @@ write_empty_grid_piece(VTKFileWriter& File, bool binary)
 	File << "    <Piece NumberOfPoints=\"0\" NumberOfCells=\"0\">\n";
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, binary) << ">\n";
 	if(binary)
 		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	else
@@ -144,18 +142,18 @@ write_empty_grid_piece(VTKFileWriter& File, bool binary)
 	File << "      </Points>\n";
 	File << "      <Cells>\n";
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, binary) << ">\n";
 	if(binary)
 		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	else
 		File << n;
 	File << "\n        </DataArray>\n";
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, binary) << ">\n";
 	File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	File << "\n        </DataArray>\n";
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, binary) << ">\n";
 	if(binary)
 		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	else
@@ -201,7 +199,7 @@ vtu_filename(std::string& nameOut, std::string nameIn, int rank,
 
 #ifdef UG_PARALLEL
 // 	process index
-	if(pcl::NumProcs() > 1)
+	if(pcl::NumProcs() > 1 && rank >= 0)
 		AppendCounterToString(nameOut, "_p", rank, pcl::NumProcs() - 1);
 #endif
 
@@ -239,6 +237,18 @@ pvtu_filename(std::string& nameOut, std::string nameIn,
 }
 
 
+template <int TDim>
+void VTKOutput<TDim>::
+parallel_filename(std::string& nameOut, std::string nameIn,
+                  int si, int maxSi, int step) const
+{
+	if(single_file_output())
+		vtu_filename(nameOut, nameIn, -1, si, maxSi, step);
+	else
+		pvtu_filename(nameOut, nameIn, si, maxSi, step);
+}
+
+
 template <int TDim>
 void VTKOutput<TDim>::
 pvd_filename(std::string& nameOut, std::string nameIn)
@@ -311,7 +321,7 @@ write_subset_pvd(int numSubset, const std::string& filename, int step, number ti
 		for(int si = 0; si < numSubset; ++si)
 		{
 			vtu_filename(name, filename, rank, si, numSubset-1, step);
-			if(numProcs > 1) pvtu_filename(name, filename, si, numSubset-1, step);
+			if(numProcs > 1) parallel_filename(name, filename, si, numSubset-1, step);
 
 			name = FilenameWithoutPath(name);
 			fprintf(file, "  <DataSet timestep=\"%g\" part=\"%d\" file=\"%s\"/>\n",
@@ -348,7 +358,7 @@ write_subset_pvd(int numSubset, const std::string& filename, int step, number ti
 			for(int si = 0; si < numSubset; ++si)
 			{
 				vtu_filename(name, filename, rank, si, numSubset-1, step);
-				if(numProcs > 1) pvtu_filename(name, filename, si, numSubset-1, step);
+				if(numProcs > 1) parallel_filename(name, filename, si, numSubset-1, step);
 
 				name = FilenameWithoutPath(name);
 				fprintf(file, "  <DataSet timestep=\"%g\" part=\"%d\" file=\"%s\"/>\n",
@@ -590,6 +600,208 @@ set_binary(bool b) {
 	m_bBinary = b;
 }
 
+template <int TDim>
+void VTKOutput<TDim>::
+set_appended(bool b) {
+	m_bAppended = b;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_compression_level(int level) {
+#ifndef UG_ZLIB
+	UG_COND_THROW(level != 0, "VTKOutput::set_compression_level: Compression "
+				  "requires zlib support. Please recompile ug with -DZLIB=ON.");
+#endif
+	UG_COND_THROW(level < 0 || level > 9, "VTKOutput::set_compression_level: "
+				  "level has to be in [0, 9], but is " << level);
+	m_compressionLevel = level;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_async(bool b) {
+	if(b){
+		UG_COND_THROW(m_bSingleFile, "VTKOutput::set_async: async output "
+					  "can't be combined with single file output. Disable "
+					  "single file output first.");
+		if(m_spAsyncWriter.invalid())
+			m_spAsyncWriter = make_sp(new AsyncFileWriter(m_asyncMaxQueuedBytes));
+	}
+	else if(m_spAsyncWriter.valid()){
+		m_spAsyncWriter->flush();
+		m_spAsyncWriter = SPNULL;
+	}
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_async_max_queued_bytes(size_t maxBytes) {
+	m_asyncMaxQueuedBytes = maxBytes;
+	if(m_spAsyncWriter.valid())
+		m_spAsyncWriter->set_max_queued_bytes(maxBytes);
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+flush() {
+	if(m_spAsyncWriter.valid())
+		m_spAsyncWriter->flush();
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_single_file(bool b) {
+	UG_COND_THROW(b && m_spAsyncWriter.valid(), "VTKOutput::set_single_file: "
+				  "single file output can't be combined with async output. "
+				  "Disable async output first.");
+	m_bSingleFile = b;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_num_aggregators(int num) {
+	UG_COND_THROW(num < 0, "VTKOutput::set_num_aggregators: number of "
+				  "aggregators has to be non-negative, but is " << num);
+	m_numAggregators = num;
+}
+
+template <int TDim>
+bool VTKOutput<TDim>::
+single_file_output() const {
+#ifdef UG_PARALLEL
+	return m_bSingleFile && (pcl::NumProcs() > 1);
+#else
+	return false;
+#endif
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+open_vtu_file(VTKFileWriter& File, const std::string& name)
+{
+	if(single_file_output() || m_spAsyncWriter.valid())
+		File.open_memory();
+	else
+		File.open(name.c_str(), std::ios_base::out | std::ios_base::trunc
+							| std::ios_base::binary);
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+close_vtu_file(VTKFileWriter& File, const std::string& name)
+{
+#ifdef UG_PARALLEL
+	if(single_file_output()){
+	//	the pieces of all processes are concatenated in the order of their ranks
+		std::string content;
+		File.release_memory_content(content);
+		pcl::WriteConcatenatedParallelFile(content.data(), content.size(),
+										   name, m_numAggregators);
+		return;
+	}
+#endif
+
+	if(m_spAsyncWriter.valid()){
+		std::string content;
+		File.release_memory_content(content);
+		m_spAsyncWriter->write(name, content);
+	}
+	else
+		File.close();
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+write_vtu_header(VTKFileWriter& File, int step, number time)
+{
+//	appended data offsets are relative to a single process' data, thus
+//	appended output can't be used if the pieces of all processes are combined
+	const bool appended = m_bBinary && m_bAppended && !single_file_output();
+	File.enable_appended_data(appended);
+	File.set_compression_level(appended ? m_compressionLevel : 0);
+
+	File << VTKFileWriter::normal;
+
+//	bool if time point should be written to *.vtu file
+//	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
+	bool bTimeDep = (step >= 0);
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() > 1){
+		if(single_file_output()){
+		//	there's no *.pvtu file, the first process writes the header
+			if(pcl::ProcRank() != 0)
+				return;
+		}
+		else
+			bTimeDep = false;
+	}
+#endif
+
+	File << "<?xml version=\"1.0\"?>\n";
+	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
+	if(IsLittleEndian()) File << "LittleEndian";
+	else File << "BigEndian";
+	if(File.compression_level() > 0)
+		File << "\" compressor=\"vtkZLibDataCompressor";
+	File << "\">\n";
+
+//	writing time point
+	if(bTimeDep)
+	{
+		File << "  <Time timestep=\""<<time<<"\"/>\n";
+	}
+
+//	opening the grid
+	File << "  <UnstructuredGrid>\n";
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+write_vtu_footer(VTKFileWriter& File)
+{
+	File << VTKFileWriter::normal;
+
+#ifdef UG_PARALLEL
+//	in single file mode, the last process closes the file
+	if(single_file_output() && pcl::ProcRank() != pcl::NumProcs() - 1)
+		return;
+#endif
+
+	File << "  </UnstructuredGrid>\n";
+	write_appended_data(File);
+	File << "</VTKFile>\n";
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+write_appended_data(VTKFileWriter& File)
+{
+	if(!File.appended_data_enabled())
+		return;
+
+	File << VTKFileWriter::normal;
+	File << "  <AppendedData encoding=\"raw\">\n   _";
+	File.write_appended_data();
+	File << "\n  </AppendedData>\n";
+}
+
+template <int TDim>
+std::string VTKOutput<TDim>::
+data_array_format(VTKFileWriter& File, bool binary)
+{
+	if(!binary)
+		return "\"ascii\"";
+
+	if(File.appended_data_enabled()){
+		std::stringstream ss;
+		ss << "\"appended\" offset=\"" << File.appended_data_offset() << "\"";
+		return ss.str();
+	}
+
+	return "\"binary\"";
+}
+
 template <int TDim>
 bool VTKOutput<TDim>::
 vtk_name_used(const char* name) const
@@ -40,6 +40,8 @@
 // other ug modules
 #include "common/util/string_util.h"
 #include "common/util/base64_file_writer.h"
+#include "common/util/async_file_writer.h"
+#include "common/util/smart_pointer.h"
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/domain.h"
 #include "lib_disc/spatial_disc/user_data/user_data.h"
@@ -902,13 +904,19 @@ protected:
 
 	public:
 	///	writes a grouping *.pvd file, grouping all data from different subsets
-		static void write_subset_pvd(int numSubset, const std::string&  filename,
-		                             int step = -1, number time = 0.0);
+		void write_subset_pvd(int numSubset, const std::string&  filename,
+		                      int step = -1, number time = 0.0);
 
 	///	creates the needed vtu file name
+	/**	In parallel, the process index is appended unless rank < 0.*/
 		static void vtu_filename(std::string& nameOut, std::string nameIn,
 		                         int rank, int si, int maxSi, int step);
 
+	///	creates the name of the file which groups the pieces of all processes
+	/**	This is the *.pvtu file or, in single file mode, the common *.vtu file.*/
+		void parallel_filename(std::string& nameOut, std::string nameIn,
+		                       int si, int maxSi, int step) const;
+
 	///	create the needed pvtu file name
 		static void pvtu_filename(std::string& nameOut, std::string nameIn,
 		                          int si, int maxSi, int step);
@@ -922,12 +930,87 @@ protected:
 
 	public:
 	///	default constructor
-		VTKOutput()	: m_bSelectAll(true), m_bBinary(true) {}
+		VTKOutput()	: m_bSelectAll(true), m_bBinary(true), m_bAppended(false),
+					  m_compressionLevel(0),
+					  m_asyncMaxQueuedBytes(256 * 1024 * 1024),
+					  m_bSingleFile(false), m_numAggregators(0) {}
 
 	/// should values be printed in binary (base64 encoded way ) or plain ascii
 		void set_binary(bool b);
 
+	///	should binary values be written raw to an appended data section
+	/**	If enabled (and if binary output is enabled), binary data is not base64
+	 * encoded and written inline, but written raw to the <AppendedData> section
+	 * at the end of each *.vtu file. Each DataArray references its data through
+	 * an offset. This reduces file size and the time spent for encoding.*/
+		void set_appended(bool b);
+
+	///	sets the zlib compression level of appended data (0: no compression)
+	/**	Only used if appended output is enabled. Requires ug to be compiled
+	 * with -DZLIB=ON.*/
+		void set_compression_level(int level);
+
+	///	should *.vtu files be written on a background thread
+	/**	If enabled, the content of each *.vtu file is generated in memory and
+	 * written to disk on a background thread, so that the computation may
+	 * continue while the file is written. The grouping files (*.pvtu, *.pvd)
+	 * are still written directly. Disabling async output waits until all
+	 * queued files have been written. Can't be combined with single file
+	 * output (set_single_file).*/
+		void set_async(bool b);
+
+	///	sets the maximal number of bytes which may be queued for async output
+	/**	If the queue is full, print blocks until enough files have been written.*/
+		void set_async_max_queued_bytes(size_t maxBytes);
+
+	///	waits until all *.vtu files queued for async output have been written
+		void flush();
+
+	///	should all processes write into one common *.vtu file
+	/**	If enabled (in parallel), the pieces of all processes are collected
+	 * and written into one *.vtu file per time step (and subset) through
+	 * MPI-IO, instead of writing one *.vtu file per process and a grouping
+	 * *.pvtu file. This drastically reduces the number of created files.
+	 * Appended data (set_appended) is not used in this mode. Single file
+	 * output can't be combined with async output (set_async); enabling both
+	 * throws an error.*/
+		void set_single_file(bool b);
+
+	///	sets the number of processes which write to the file in single file mode
+	/**	The processes are split into groups of consecutive ranks, each of which
+	 * sends its data to one aggregating process which accesses the file.
+	 * 0 (default) means that every process writes its own piece.*/
+		void set_num_aggregators(int num);
+
 	protected:
+	///	returns true if the pieces of all processes are written into one file
+		bool single_file_output() const;
+
+	///	opens the given *.vtu file (or a memory buffer if async output is enabled)
+		void open_vtu_file(VTKFileWriter& File, const std::string& name);
+
+	///	closes the given *.vtu file (or queues its content if async output is enabled)
+		void close_vtu_file(VTKFileWriter& File, const std::string& name);
+
+
+	///	configures the given file writer and writes the opening VTKFile and UnstructuredGrid tags
+	/**	If step >= 0, the time point is written, too (only in serial, since in
+	 * parallel it is written to the *.pvtu file). In single file mode, only
+	 * the first process writes the tags.*/
+		void write_vtu_header(VTKFileWriter& File, int step = -1, number time = 0.0);
+
+	///	writes the closing UnstructuredGrid and VTKFile tags and the appended data
+	/**	In single file mode, only the last process writes the tags.*/
+		void write_vtu_footer(VTKFileWriter& File);
+
+	///	writes the appended data section of the given file, if appended output is enabled
+		void write_appended_data(VTKFileWriter& File);
+
+	///	returns the value of the format attribute of a DataArray
+	/**	If appended output is enabled for the given file, an offset attribute
+	 * is contained in the returned string, too.*/
+		static std::string data_array_format(VTKFileWriter& File, bool binary);
+
 	///	returns true if name for vtk-component is already used
 		bool vtk_name_used(const char* name) const;
 
@@ -957,6 +1040,18 @@ protected:
 		bool m_bSelectAll;
 	/// print values in binary (base64 encoded way) or plain ascii
 		bool m_bBinary;
+	///	write binary values raw to an appended data section
+		bool m_bAppended;
+	///	zlib compression level of appended data
+		int m_compressionLevel;
+	///	background writer used for async output (invalid if disabled)
+		SmartPtr<AsyncFileWriter> m_spAsyncWriter;
+	///	maximal number of bytes queued for async output
+		size_t m_asyncMaxQueuedBytes;
+	///	write the pieces of all processes into one file
+		bool m_bSingleFile;
+	///	number of processes accessing the file in single file mode (0: all)
+		int m_numAggregators;
 		std::map<std::string, std::vector<std::string> > m_vSymbFct;
 		std::map<std::string, std::vector<std::string> > m_vSymbFctNodal;
 		std::map<std::string, std::vector<std::string> > m_vSymbFctElem;
@@ -216,7 +216,7 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 //	get name for *.vtu file
 	std::string name;
 	try{
-		vtu_filename(name, filename, rank, si, u.num_subsets()-1, step);
+		vtu_filename(name, filename, single_file_output() ? -1 : rank, si, u.num_subsets()-1, step);
 	}
 	UG_CATCH_THROW("VTK::print_subset: Can not write vtu - file.");
 
@@ -224,31 +224,11 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 //	open the file
 	try
 	{
-	VTKFileWriter File(name.c_str());
+	VTKFileWriter File;
+	open_vtu_file(File, name);
 
-//	bool if time point should be written to *.vtu file
-//	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
-	bool bTimeDep = (step >= 0);
-#ifdef UG_PARALLEL
-	if(pcl::NumProcs() > 1) bTimeDep = false;
-#endif
-
-//	header
-	File << VTKFileWriter::normal;
-	File << "<?xml version=\"1.0\"?>\n";
-	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-	if(IsLittleEndian()) File << "LittleEndian";
-	else File << "BigEndian";
-	File << "\">\n";
-
-//	writing time point
-	if(bTimeDep)
-	{
-		File << "  <Time timestep=\""<<time<<"\"/>\n";
-	}
-
-//	opening the grid
-	File << "  <UnstructuredGrid>\n";
+//	header and opening of the grid
+	write_vtu_header(File, step, time);
 
 // 	get dimension of grid-piece
 	int dim = -1;
@@ -277,9 +257,8 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 	}
 
 //	write closing xml tags
-	File << VTKFileWriter::normal;
-	File << "  </UnstructuredGrid>\n";
-	File << "</VTKFile>\n";
+	write_vtu_footer(File);
+	close_vtu_file(File, name);
 
 // 	detach help indices
 	grid.detach_from_vertices(aVrtIndex);
@@ -345,7 +324,7 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 //	get name for *.vtu file
 	std::string name;
 	try{
-		vtu_filename(name, filename, rank, -1, u.num_subsets()-1, step); // "-1" because we do not want any subset prefixes!
+		vtu_filename(name, filename, single_file_output() ? -1 : rank, -1, u.num_subsets()-1, step); // "-1" because we do not want any subset prefixes!
 	}
 	UG_CATCH_THROW("VTK::print_subsets: Can not write vtu - file.");
 
@@ -353,31 +332,11 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 //	open the file
 	try
 	{
-	VTKFileWriter File(name.c_str());
+	VTKFileWriter File;
+	open_vtu_file(File, name);
 
-//	bool if time point should be written to *.vtu file
-//	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
-	bool bTimeDep = (step >= 0);
-#ifdef UG_PARALLEL
-	if(pcl::NumProcs() > 1) bTimeDep = false;
-#endif
-
-//	header
-	File << VTKFileWriter::normal;
-	File << "<?xml version=\"1.0\"?>\n";
-	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-	if(IsLittleEndian()) File << "LittleEndian";
-	else File << "BigEndian";
-	File << "\">\n";
-
-//	writing time point
-	if(bTimeDep)
-	{
-		File << "  <Time timestep=\""<<time<<"\"/>\n";
-	}
-
-//	opening the grid
-	File << "  <UnstructuredGrid>\n";
+//	header and opening of the grid
+	write_vtu_header(File, step, time);
 
 // 	get dimension of grid-piece: the highest dimension of the specified subsets
 	int dim = -1;
@@ -403,9 +362,8 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 	}
 
 //	write closing xml tags
-	File << VTKFileWriter::normal;
-	File << "  </UnstructuredGrid>\n";
-	File << "</VTKFile>\n";
+	write_vtu_footer(File);
+	close_vtu_file(File, name);
 
 // 	detach help indices
 	grid.detach_from_vertices(aVrtIndex);
@@ -790,7 +748,7 @@ write_points(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(m_bBinary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	int n = 3*sizeof(float) * numVert;
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << n;
@@ -840,7 +798,7 @@ write_points(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(m_bBinary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	int n = 3*sizeof(float) * numVert;
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << n;
@@ -1041,7 +999,7 @@ write_cell_connectivity(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that connections will be written
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	int n = sizeof(int) * numConn;
 
 	if(m_bBinary)
@@ -1080,7 +1038,7 @@ write_cell_connectivity(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that connections will be written
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	int n = sizeof(int) * numConn;
 
 	if(m_bBinary)
@@ -1178,7 +1136,7 @@ write_cell_offsets(VTKFileWriter& File, const T& iterContainer, int si, int dim,
 	File << VTKFileWriter::normal;
 //	write opening tag indicating that offsets are going to be written
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	int n = sizeof(int) * numElem;
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << n;
@@ -1216,7 +1174,7 @@ write_cell_offsets(VTKFileWriter& File, const T& iterContainer, SubsetGroup& ssG
 	File << VTKFileWriter::normal;
 //	write opening tag indicating that offsets are going to be written
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	int n = sizeof(int) * numElem;
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << n;
@@ -1325,7 +1283,7 @@ write_cell_types(VTKFileWriter& File, const T& iterContainer, int si, int dim,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << numElem;
 
@@ -1362,7 +1320,7 @@ write_cell_types(VTKFileWriter& File, const T& iterContainer, SubsetGroup& ssGrp
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << numElem;
 
@@ -1509,7 +1467,7 @@ write_nodal_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numVert * numCmp;
 	if(m_bBinary)
@@ -1561,7 +1519,7 @@ write_nodal_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numVert * numCmp;
 	if(m_bBinary)
@@ -1678,7 +1636,7 @@ write_nodal_values(VTKFileWriter& File, TFunction& u,
 //	write opening tag
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numVert * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
@@ -1722,7 +1680,7 @@ write_nodal_values(VTKFileWriter& File, TFunction& u,
 //	write opening tag
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numVert * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
@@ -2071,7 +2029,7 @@ write_cell_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numElem * numCmp;
 	if(m_bBinary)
@@ -2112,7 +2070,7 @@ write_cell_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numElem * numCmp;
 	if(m_bBinary)
@@ -2248,7 +2206,7 @@ write_cell_values(VTKFileWriter& File, TFunction& u,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numElem * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
@@ -2285,7 +2243,7 @@ write_cell_values(VTKFileWriter& File, TFunction& u,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	data_array_format(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numElem * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
@@ -2532,6 +2490,9 @@ write_pvtu(TFunction& u, const std::string& filename,
 	int numProcs = pcl::NumProcs();
 	if(numProcs == 1) return;
 
+//	in single file mode, all pieces are contained in the *.vtu file
+	if(m_bSingleFile) return;
+
 //	check if this proc is output proc
 	bool isOutputProc = GetLogAssistant().is_output_process();
 
@@ -2745,7 +2706,7 @@ write_time_pvd(const char* filename, TFunction& u)
 			for(int step = 0; step < (int)vTimestep.size(); ++step)
 			{
 				vtu_filename(name, filename, 0, -1, 0, step);
-				if(numProcs > 1) pvtu_filename(name, filename, -1, 0, step);
+				if(numProcs > 1) parallel_filename(name, filename, -1, 0, step);
 
 				name = FilenameWithoutPath(name);
 				fprintf(file, "  <DataSet timestep=\"%g\" part=\"%d\" file=\"%s\"/>\n",
@@ -2758,7 +2719,7 @@ write_time_pvd(const char* filename, TFunction& u)
 				for(int si = 0; si < u.num_subsets(); ++si)
 				{
 					vtu_filename(name, filename, 0, si, u.num_subsets()-1, step);
-					if(numProcs > 1) pvtu_filename(name, filename, si, u.num_subsets()-1, step);
+					if(numProcs > 1) parallel_filename(name, filename, si, u.num_subsets()-1, step);
 
 					name = FilenameWithoutPath(name);
 					fprintf(file, "  <DataSet timestep=\"%g\" part=\"%d\" file=\"%s\"/>\n",
@@ -2829,7 +2790,7 @@ write_time_processwise_pvd(const char* filename, TFunction& u)
 				for(int si = 0; si < u.num_subsets(); ++si)
 				{
 					vtu_filename(name, filename, rank, si, u.num_subsets()-1, step);
-					if(numProcs > 1) pvtu_filename(name, filename, si, u.num_subsets()-1, step);
+					if(numProcs > 1) parallel_filename(name, filename, si, u.num_subsets()-1, step);
 
 					name = FilenameWithoutPath(name);
 					fprintf(file, "  <DataSet timestep=\"%g\" part=\"%d\" file=\"%s\"/>\n",
@@ -2896,7 +2857,7 @@ write_time_pvd_subset(const char* filename, TFunction& u, int si)
 		for(int step = 0; step < (int)vTimestep.size(); ++step)
 		{
 			vtu_filename(name, filename, 0, si, u.num_subsets()-1, step);
-			if(numProcs > 1) pvtu_filename(name, filename, si, u.num_subsets()-1, step);
+			if(numProcs > 1) parallel_filename(name, filename, si, u.num_subsets()-1, step);
 
 			name = FilenameWithoutPath(name);
 			fprintf(file, "  <DataSet timestep=\"%g\" part=\"%d\" file=\"%s\"/>\n",
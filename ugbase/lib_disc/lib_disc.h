@@ -80,6 +80,7 @@
 
 // Operator
 #include "operator/linear_operator/assembled_linear_operator.h"
+#include "operator/linear_operator/jacobian_free_operator.h"
 #include "operator/linear_operator/std_injection.h"
 #include "operator/linear_operator/std_transfer.h"
 #include "operator/linear_operator/multi_grid_solver/mg_solver.h"
@@ -131,5 +132,6 @@
 // Time discretization
 #include "time_disc/time_disc_interface.h"
 #include "time_disc/theta_time_step.h"
+#include "time_disc/adaptive_time_integrator.h"
 
 #endif /* __H__UG__LIB_DISC__LIB__DISC__ */
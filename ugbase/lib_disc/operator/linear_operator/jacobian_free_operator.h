@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__JACOBIAN_FREE_OPERATOR__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__JACOBIAN_FREE_OPERATOR__
+
+#include "assembled_linear_operator.h"
+#include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
+
+namespace ug{
+
+///	finite difference approximation of the action of a Jacobian
+/**
+ * This operator approximates the application of the Jacobian J(u) of an
+ * AssembledOperator N at the linearization point u by a finite difference of
+ * defects, i.e.
+ *
+ * 		J(u)*c ~ (N(u + h*c) - N(u)) / h,		h = eps * (1 + |u|) / |c|,
+ *
+ * so that only defects have to be assembled for the application of the
+ * operator (Jacobian-free Newton-Krylov).
+ *
+ * In addition, the operator is an AssembledLinearOperator: Invoking init(u)
+ * assembles the Jacobian of the (possibly different, e.g. lower order)
+ * discretization passed in the constructor into the matrix part. This matrix
+ * is only used by preconditioners, that are initialized with this operator,
+ * while apply and apply_sub always use the finite difference approximation.
+ * Thus, the matrix may be lagged (i.e. assembled at an older linearization
+ * point), while the action of the operator is always exact up to the finite
+ * difference error. Note, that this requires a Krylov method as linear solver,
+ * since direct solvers only use the matrix.
+ *
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TAlgebra>
+class JacobianFreeOperator : public AssembledLinearOperator<TAlgebra>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Type of Matrix
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Type of base class
+		typedef AssembledLinearOperator<TAlgebra> base_type;
+
+	public:
+	///	Constructor
+	/**
+	 * \param[in]	N			nonlinear operator, whose defects are used
+	 * \param[in]	precondAss	discretization used to assemble the matrix for
+	 * 							the preconditioner
+	 */
+		JacobianFreeOperator(SmartPtr<AssembledOperator<TAlgebra> > N,
+		                     SmartPtr<IAssemble<TAlgebra> > precondAss);
+
+	///	returns the nonlinear operator
+		SmartPtr<AssembledOperator<TAlgebra> > nonlinear_operator() {return m_spN;}
+
+	///	sets the relative size of the finite difference increment
+		void set_epsilon(number eps) {m_eps = eps;}
+
+	///	returns the relative size of the finite difference increment
+		number epsilon() const {return m_eps;}
+
+	///	sets the linearization point u and the defect N(u) at this point
+	/**
+	 * The defect must have been computed with the nonlinear operator of this
+	 * class, i.e. d = N(u). Both vectors are copied.
+	 */
+		void set_linearization_point(const vector_type& u, const vector_type& d);
+
+	///	compute d = J(u)*c (finite difference approximation)
+		virtual void apply(vector_type& d, const vector_type& c);
+
+	///	Compute d := d - J(u)*c (finite difference approximation)
+		virtual void apply_sub(vector_type& d, const vector_type& c);
+
+	///	applies the finite difference approximation to each function
+		virtual void multi_apply(MultiVector<vector_type>& vd, const MultiVector<vector_type>& vc)
+		{
+			ILinearOperator<vector_type>::multi_apply(vd, vc);
+		}
+
+	///	applies the finite difference approximation to each function and subtracts it
+		virtual void multi_apply_sub(MultiVector<vector_type>& vd, const MultiVector<vector_type>& vc)
+		{
+			ILinearOperator<vector_type>::multi_apply_sub(vd, vc);
+		}
+
+	///	Destructor
+		virtual ~JacobianFreeOperator() {};
+
+	protected:
+	///	nonlinear operator
+		SmartPtr<AssembledOperator<TAlgebra> > m_spN;
+
+	///	linearization point and defect at linearization point
+		SmartPtr<vector_type> m_spU;
+		SmartPtr<vector_type> m_spD;
+
+	///	help vectors
+		SmartPtr<vector_type> m_spUEps;
+		SmartPtr<vector_type> m_spTmp;
+
+	///	norm of linearization point
+		number m_uNorm;
+
+	///	relative size of the finite difference increment
+		number m_eps;
+};
+
+} // namespace ug
+
+// include implementation
+#include "jacobian_free_operator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__JACOBIAN_FREE_OPERATOR__ */
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__JACOBIAN_FREE_OPERATOR_IMPL__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__JACOBIAN_FREE_OPERATOR_IMPL__
+
+#include <cmath>
+#include <limits>
+
+#include "jacobian_free_operator.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+template <typename TAlgebra>
+JacobianFreeOperator<TAlgebra>::
+JacobianFreeOperator(SmartPtr<AssembledOperator<TAlgebra> > N,
+                     SmartPtr<IAssemble<TAlgebra> > precondAss)
+	: base_type(precondAss), m_spN(N), m_uNorm(0.0),
+	  m_eps(std::sqrt(std::numeric_limits<number>::epsilon()))
+{
+	if(m_spN.invalid())
+		UG_THROW("JacobianFreeOperator: Nonlinear operator not set.");
+}
+
+template <typename TAlgebra>
+void
+JacobianFreeOperator<TAlgebra>::
+set_linearization_point(const vector_type& u, const vector_type& d)
+{
+	PROFILE_BEGIN_GROUP(JacobianFreeOperator_set_linearization_point, "discretization");
+
+//	copy linearization point and defect, create help vectors
+	m_spU = u.clone();
+	m_spD = d.clone();
+	m_spUEps = u.clone_without_values();
+	m_spTmp = d.clone_without_values();
+
+//	compute norm on a copy (norm may change the parallel storage type)
+	*m_spUEps = u;
+	m_uNorm = m_spUEps->norm();
+}
+
+template <typename TAlgebra>
+void
+JacobianFreeOperator<TAlgebra>::apply(vector_type& d, const vector_type& c)
+{
+	PROFILE_BEGIN_GROUP(JacobianFreeOperator_apply, "discretization");
+
+	if(m_spU.invalid())
+		UG_THROW("JacobianFreeOperator::apply: Linearization point not set.");
+
+#ifdef UG_PARALLEL
+	if(!c.has_storage_type(PST_CONSISTENT))
+		UG_THROW("JacobianFreeOperator::apply: Inadequate storage format of Vector c.");
+#endif
+
+//	compute norm on a copy (norm may change the parallel storage type)
+	vector_type& uEps = *m_spUEps;
+	uEps = c;
+	const number cNorm = uEps.norm();
+
+//	J(u)*0 = 0
+	if(cNorm == 0.0){
+		d.set(0.0);
+	#ifdef UG_PARALLEL
+		d.set_storage_type(PST_ADDITIVE);
+	#endif
+		return;
+	}
+
+//	uEps = u + h*c
+	const number h = m_eps * (1.0 + m_uNorm) / cNorm;
+	uEps = c;
+	VecScaleAdd(uEps, 1.0, *m_spU, h, uEps);
+
+//	d = (N(u + h*c) - N(u)) / h
+	try{
+		m_spN->apply(d, uEps);
+	}
+	UG_CATCH_THROW("JacobianFreeOperator::apply: Cannot compute defect.");
+
+	VecScaleAdd(d, 1.0/h, d, -1.0/h, *m_spD);
+}
+
+template <typename TAlgebra>
+void
+JacobianFreeOperator<TAlgebra>::apply_sub(vector_type& d, const vector_type& c)
+{
+	if(m_spTmp.invalid())
+		UG_THROW("JacobianFreeOperator::apply_sub: Linearization point not set.");
+
+//	d := d - J(u)*c
+	apply(*m_spTmp, c);
+	VecScaleAdd(d, 1.0, d, -1.0, *m_spTmp);
+}
+
+} // namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__JACOBIAN_FREE_OPERATOR_IMPL__ */
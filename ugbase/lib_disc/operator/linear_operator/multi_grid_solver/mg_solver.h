@@ -73,6 +73,25 @@ namespace ug{
  * that is set from outside. In addition an Assembling routine must be
  * specified that is used to assemble the coarse grid matrices.
  *
+ * Besides the multiplicative V-, W- and F-cycles, an additive cycle ("A") is
+ * available: the surface defect is restricted to all levels first, the level
+ * corrections are then computed independently of each other (smoothing on the
+ * finer levels, base solver on the base level) and finally prolongated and
+ * summed up. Using symmetric smoothing (e.g. equal numbers of pre- and
+ * post-smoothing steps with adjoint smoothers) this results in a symmetric
+ * (BPX-like) preconditioner for cg. If the base problem is gathered to one
+ * process, the other processes smooth their levels while the base problem is
+ * solved, instead of waiting for the base correction. Each process still
+ * smoothes its levels one after another. Smoothing on the surface rim is not
+ * supported by the additive cycle.
+ *
+ * Several defects can be processed at once (multi_apply, used e.g. by
+ * CG::multi_apply). The V-, W- and F-cycles are then run for all defects in
+ * lockstep: each smoothing step applies the smoother and the level matrix to
+ * all defects at once (i.e. one pass over the level matrix), the transfers
+ * and the base solver are applied to each defect within the same sweep. The
+ * additive cycle is applied to each defect separately.
+ *
  * \tparam		TApproximationSpace		Type of Approximation Space
  * \tparam		TAlgebra				Type of Algebra
  */
@@ -142,11 +161,12 @@ class AssembledMultiGridCycle :
 	///	sets the cycle type (1 = V-cycle, 2 = W-cycle, ...)
 		void set_cycle_type(int type) {m_cycleType = type;}
 
-	///	sets the cycle type (1 = V-cycle, 2 = W-cycle, ...)
+	///	sets the cycle type ("V", "W", "F" or "A" for the additive cycle)
 		void set_cycle_type(const std::string& type) {
 			if(TrimString(type) == "V") {m_cycleType = _V_;}
 			else if(TrimString(type) == "W") {m_cycleType = _W_;}
 			else if(TrimString(type) == "F") {m_cycleType = _F_;}
+			else if(TrimString(type) == "A") {m_cycleType = _A_;}
 			else {UG_THROW("GMG::set_cycle_type: option '"<<type<<"' not supported.");}
 		}
 
@@ -242,6 +262,9 @@ class AssembledMultiGridCycle :
 	///	Compute new correction c = B*d and return new defect d := d - A*c
 		virtual bool apply_update_defect(vector_type& c, vector_type& d);
 
+	///	Compute new corrections c_k = B*d_k for several defects at once
+		virtual bool multi_apply(MultiVector<vector_type>& vc, const MultiVector<vector_type>& vd);
+
 	///	Clone
 		SmartPtr<ILinearIterator<vector_type> > clone();
 
@@ -252,22 +275,67 @@ class AssembledMultiGridCycle :
  	/// compute correction on level and update defect
 		void lmgc(int lev, int cycleType);
 
+	///	computes the correction on all levels using the additive cycle
+		void additive_mgc();
+
 	////////////////////////////////////////////////////////////////
 	//	The methods in this section rely on each other and should be called in sequence
 	///	performs presmoothing on the given level
-		void presmooth_and_restriction(int lev);
+		void presmooth(int lev);
+
+	///	restricts the defect from the given level to the level below
+		void restriction(int lev);
 
-	///	performs prolongation to the level above
-		void prolongation_and_postsmooth(int lev);
+	///	prolongates the correction from the level below and adds it
+		void prolongation(int lev);
+
+	///	performs postsmoothing on the given level
+		void postsmooth(int lev);
+
+	///	computes the smoothed correction of the additive cycle on a level
+		void additive_smooth(int lev);
 
 	///	compute base solver
 		void base_solve(int lev);
+
+	///	computes the base correction and starts its distribution (gathered base solver)
+		void base_solve_begin(int lev);
+
+	///	completes the distribution of the base correction and updates the defect
+		void base_solve_end(int lev);
+	//	end of section
+	////////////////////////////////////////////////////////////////
+
+	////////////////////////////////////////////////////////////////
+	//	Block versions of the cycle, processing all columns set up by init_block_memory
+	///	computes the corrections of all columns on the level and updates the defects
+		void multi_lmgc(int lev, int cycleType);
+
+	///	performs presmoothing for all columns on the given level
+		void multi_presmooth(int lev);
+
+	///	performs postsmoothing for all columns on the given level
+		void multi_postsmooth(int lev);
 	//	end of section
 	////////////////////////////////////////////////////////////////
 
 	///	allocates the memory
 		void init_level_memory(int baseLev, int topLev);
 
+	///	allocates the level vectors (c, d, t and t with ghosts) for a level
+		void init_level_vectors(int lev, SmartPtr<GF>& spC, SmartPtr<GF>& spD,
+		                        SmartPtr<GF>& spT, SmartPtr<GF>& spTGhost);
+
+	///	allocates the level vectors for a block of numCol columns
+		void init_block_memory(size_t numCol);
+
+	///	uses the level vectors (and surface correction) of a column in the cycle methods
+		void select_column(size_t col);
+
+	///	collects the level vectors of all columns in a block
+		void level_block(MultiVector<vector_type>& mv,
+		                 const std::vector<SmartPtr<GF> >& vGF) const;
+
 	///	initializes common part
 		void init();
 
@@ -319,6 +387,7 @@ class AssembledMultiGridCycle :
 		static const int _V_ = 1;
 		static const int _W_ = 2;
 		static const int _F_ = -1;
+		static const int _A_ = -2;
 
 	///	number of Presmooth steps
 		int m_numPreSmooth;
@@ -413,6 +482,10 @@ class AssembledMultiGridCycle :
 		///	vectors needed (sx = no-ghosts [for smoothing], t = for transfer)
 			SmartPtr<GF> sc, sd, st, t;
 
+		///	vectors of all columns of a block application (the first column
+		///	uses the vectors above)
+			std::vector<SmartPtr<GF> > vsc, vsd, vst, vt;
+
 		///	maps global indices (including ghosts) to patch indices (no ghosts included).
 			std::vector<size_t> vMapPatchToGlobal;
 
@@ -456,6 +529,9 @@ class AssembledMultiGridCycle :
 	///	current surface correction
 		GF* m_pC;
 
+	///	surface corrections of the columns of a block application
+		std::vector<GF*> m_vpC;
+
 	///	init mapping from noghost -> w/ ghost
 	/// \{
 		template <typename TElem>
@@ -483,6 +559,11 @@ class AssembledMultiGridCycle :
 #ifdef UG_PARALLEL
 	/// communicator
 		pcl::InterfaceCommunicator<IndexLayout> m_Com;
+
+	///	tag used to distribute the gathered base correction. It differs from
+	///	the default tag, since the additive cycle smoothes (and thus
+	///	communicates) while the distribution is pending.
+		static const int baseCorrTag = 749346;
 #endif
 
 	public:
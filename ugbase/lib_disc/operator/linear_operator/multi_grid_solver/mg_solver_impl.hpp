@@ -223,7 +223,8 @@ apply(vector_type& rC, const vector_type& rD)
 
 	//	start mg-cycle
 		GMG_PROFILE_BEGIN(GMG_Apply_lmgc);
-		lmgc(m_topLev, m_cycleType);
+		if(m_cycleType == _A_) additive_mgc();
+		else lmgc(m_topLev, m_cycleType);
 		GMG_PROFILE_END();
 
 	//	project top lev to surface
@@ -306,6 +307,103 @@ apply_update_defect(vector_type &c, vector_type& rD)
 	return true;
 }
 
+template <typename TDomain, typename TAlgebra>
+bool AssembledMultiGridCycle<TDomain, TAlgebra>::
+multi_apply(MultiVector<vector_type>& vc, const MultiVector<vector_type>& vd)
+{
+	GMG_PROFILE_FUNC();
+	UG_COND_THROW(vc.size() != vd.size(), "GMG::multi_apply: Number of "
+				"corrections and defects mismatch: "<<vc.size()<<" != "<<vd.size());
+
+//	the additive cycle is applied to each defect separately
+	if(m_cycleType == _A_)
+		return ILinearIterator<vector_type>::multi_apply(vc, vd);
+
+	const size_t numCol = vd.size();
+	if(numCol == 0) return true;
+
+	try{
+// 	Check if surface level has been chosen correctly
+	if(m_topLev >= (int)m_spApproxSpace->num_levels())
+		UG_THROW("GMG::multi_apply: SurfaceLevel "<<m_topLev<<" does not exist.");
+
+// 	Check if base level has been choose correctly
+	if(m_baseLev > m_topLev)
+		UG_THROW("GMG::multi_apply: Base level must be smaller or equal to surface Level.");
+
+//	allocate the level vectors of all columns
+	init_block_memory(numCol);
+	m_vpC.resize(numCol);
+
+//	project defects from surface to level and reset corrections
+	GMG_PROFILE_BEGIN(GMG_MultiApply_CopyDefectFromSurface);
+	try{
+		for(size_t k = 0; k < numCol; ++k)
+		{
+			GF* pC = dynamic_cast<GF*>(&vc[k]);
+			if(!pC) UG_THROW("GMG::multi_apply: Expect Correction to be grid based.")
+			const GF* pD = dynamic_cast<const GF*>(&vd[k]);
+			if(!pD) UG_THROW("GMG::multi_apply: Expect Defect to be grid based.")
+			const GF& d = *pD;
+			m_vpC[k] = pC;
+
+			for(int lev = m_baseLev; lev <= m_topLev; ++lev){
+				const std::vector<SurfLevelMap>& vMap = m_vLevData[lev]->vSurfLevelMap;
+				GF& sd = *m_vLevData[lev]->vsd[k];
+				for(size_t i = 0; i < vMap.size(); ++i){
+					sd[vMap[i].levIndex] = d[vMap[i].surfIndex];
+				}
+#ifdef UG_PARALLEL
+				sd.set_storage_type(d.get_storage_mask());
+#endif
+			}
+
+			pC->set(0.0);
+			m_vLevData[m_topLev]->vsc[k]->set(0.0);
+		}
+	}
+	UG_CATCH_THROW("GMG::multi_apply: Project d Surf -> Level failed.");
+	GMG_PROFILE_END();
+
+// 	Perform one multigrid cycle for all columns
+	GMG_PROFILE_BEGIN(GMG_MultiApply_lmgc);
+	try{
+		multi_lmgc(m_topLev, m_cycleType);
+	}
+	UG_CATCH_THROW("GMG: multi_lmgc failed.");
+	GMG_PROFILE_END();
+
+//	project top lev to surface and apply scaling
+	GMG_PROFILE_BEGIN(GMG_MultiApply_AddCorrectionToSurface);
+	try{
+		const std::vector<SurfLevelMap>& vMap = m_vLevData[m_topLev]->vSurfLevelMap;
+		for(size_t k = 0; k < numCol; ++k)
+		{
+			GF& c = *m_vpC[k];
+			const GF& sc = *m_vLevData[m_topLev]->vsc[k];
+			for(size_t i = 0; i < vMap.size(); ++i){
+				c[vMap[i].surfIndex] += sc[vMap[i].levIndex];
+			}
+			#ifdef UG_PARALLEL
+			c.set_storage_type(PST_CONSISTENT);
+			#endif
+
+			const number kappa = this->damping()->damping(c, vd[k], m_spSurfaceMat.template cast_dynamic<ILinearOperator<vector_type> >());
+			if(kappa != 1.0) c *= kappa;
+		}
+	}
+	UG_CATCH_THROW("GMG: Damping failed.")
+	GMG_PROFILE_END();
+
+	} UG_CATCH_THROW("GMG::multi_apply: Application failed.");
+
+//	the single application uses the vectors of the first column again
+	select_column(0);
+	m_vpC.clear();
+
+	return true;
+}
+
 template <typename TDomain, typename TAlgebra>
 bool AssembledMultiGridCycle<TDomain, TAlgebra>::
 init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
@@ -401,6 +499,13 @@ init()
 	if(m_spRestrictionPrototype.invalid())
 		UG_THROW("GMG::init: Restriction not set.");
 
+//	the coarse corrections of the additive cycle are computed before the fine
+//	corrections are known, thus the coupling of a fine correction on the
+//	surface rim to the coarse defect can't be taken into account
+	if(m_cycleType == _A_ && m_bSmoothOnSurfaceRim)
+		UG_THROW("GMG::init: The additive cycle does not support smoothing "
+				"on the surface rim. Use set_smooth_on_surface_rim(false).");
+
 //	get current toplevel
 	const GF* pSol = dynamic_cast<const GF*>(m_pSurfaceSol);
 	if(pSol){
@@ -1495,22 +1600,7 @@ init_level_memory(int baseLev, int topLev)
 		m_vLevData[lev] = SmartPtr<LevData>(new LevData);
 		LevData& ld = *m_vLevData[lev];
 
-		GridLevel gl = GridLevel(lev, m_GridLevelType, false);
-		ld.sc = SmartPtr<GF>(new GF(m_spApproxSpace, gl, false));
-		ld.sd = SmartPtr<GF>(new GF(m_spApproxSpace, gl, false));
-		ld.st = SmartPtr<GF>(new GF(m_spApproxSpace, gl, false));
-
-		// TODO: all procs must call this, since a MPI-Group is created.
-		//		 Think about optimizing this
-		#ifdef UG_PARALLEL
-		GridLevel glGhosts = GridLevel(lev, m_GridLevelType, true);
-		ld.t = SmartPtr<GF>(new GF(m_spApproxSpace, glGhosts, false));
-		if( ld.t->layouts()->vertical_slave().empty() &&
-			ld.t->layouts()->vertical_master().empty())
-		#endif
-		{
-			ld.t = ld.st;
-		}
+		init_level_vectors(lev, ld.sc, ld.sd, ld.st, ld.t);
 
 		ld.A = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
 				new MatrixOperator<matrix_type, vector_type>);
@@ -1613,6 +1703,76 @@ init_level_memory(int baseLev, int topLev)
 	}
 }
 
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+init_level_vectors(int lev, SmartPtr<GF>& spC, SmartPtr<GF>& spD,
+                   SmartPtr<GF>& spT, SmartPtr<GF>& spTGhost)
+{
+	GridLevel gl = GridLevel(lev, m_GridLevelType, false);
+	spC = SmartPtr<GF>(new GF(m_spApproxSpace, gl, false));
+	spD = SmartPtr<GF>(new GF(m_spApproxSpace, gl, false));
+	spT = SmartPtr<GF>(new GF(m_spApproxSpace, gl, false));
+
+	// TODO: all procs must call this, since a MPI-Group is created.
+	//		 Think about optimizing this
+	#ifdef UG_PARALLEL
+	GridLevel glGhosts = GridLevel(lev, m_GridLevelType, true);
+	spTGhost = SmartPtr<GF>(new GF(m_spApproxSpace, glGhosts, false));
+	if( spTGhost->layouts()->vertical_slave().empty() &&
+		spTGhost->layouts()->vertical_master().empty())
+	#endif
+	{
+		spTGhost = spT;
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+init_block_memory(size_t numCol)
+{
+	GMG_PROFILE_FUNC();
+
+//	the first column uses the level vectors of the single application, further
+//	columns are allocated on first use and kept until the levels are rebuilt
+	for(int lev = m_baseLev; lev <= m_topLev; ++lev)
+	{
+		LevData& ld = *m_vLevData[lev];
+		if(ld.vsc.empty()){
+			ld.vsc.push_back(ld.sc); ld.vsd.push_back(ld.sd);
+			ld.vst.push_back(ld.st); ld.vt.push_back(ld.t);
+		}
+
+		while(ld.vsc.size() < numCol){
+			SmartPtr<GF> sc, sd, st, t;
+			init_level_vectors(lev, sc, sd, st, t);
+			ld.vsc.push_back(sc); ld.vsd.push_back(sd);
+			ld.vst.push_back(st); ld.vt.push_back(t);
+		}
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+select_column(size_t col)
+{
+	for(int lev = m_baseLev; lev <= m_topLev; ++lev)
+	{
+		LevData& ld = *m_vLevData[lev];
+		ld.sc = ld.vsc[col]; ld.sd = ld.vsd[col];
+		ld.st = ld.vst[col]; ld.t = ld.vt[col];
+	}
+	if(col < m_vpC.size()) m_pC = m_vpC[col];
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+level_block(MultiVector<vector_type>& mv, const std::vector<SmartPtr<GF> >& vGF) const
+{
+	mv.clear();
+	for(size_t k = 0; k < m_vpC.size(); ++k)
+		mv.push_back(vGF[k]);
+}
+
 template <typename TDomain, typename TAlgebra>
 bool AssembledMultiGridCycle<TDomain, TAlgebra>::
 gathered_base_master() const
@@ -1635,7 +1795,7 @@ gathered_base_master() const
 
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
-presmooth_and_restriction(int lev)
+presmooth(int lev)
 {
 	GMG_PROFILE_FUNC();
 	LevData& lf = *m_vLevData[lev];
@@ -1683,6 +1843,15 @@ presmooth_and_restriction(int lev)
 
 	log_debug_data(lev, "AfterPreSmooth_BeforeCom");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - presmooth on level "<<lev<<"\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+restriction(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
 
 //	PARALLEL CASE:
 	SmartPtr<GF> spD = lf.sd;
@@ -1760,7 +1929,7 @@ presmooth_and_restriction(int lev)
 
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
-prolongation_and_postsmooth(int lev)
+prolongation(int lev)
 {
 	GMG_PROFILE_FUNC();
 	LevData& lf = *m_vLevData[lev];
@@ -1846,6 +2015,16 @@ prolongation_and_postsmooth(int lev)
 	GMG_PROFILE_END();
 
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - prolongation on level "<<lev<<"\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+postsmooth(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
+
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - postsmooth on level "<<lev<<"\n");
 	log_debug_data(lev, "BeforePostSmooth");
 
@@ -1899,6 +2078,22 @@ base_solve(int lev)
 {
 	GMG_PROFILE_FUNC();
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - base_solve on level "<<lev<<"\n");
+
+	try{
+		base_solve_begin(lev);
+		base_solve_end(lev);
+	}
+	UG_CATCH_THROW("GMG: Base Solver failed.");
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - base_solve on level "<<lev<<"\n");
+}
+
+// computes the base correction and starts its distribution
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+base_solve_begin(int lev)
+{
+	GMG_PROFILE_FUNC();
 	log_debug_data(lev, "BeforeBaseSolver");
 
 	try{
@@ -1968,25 +2163,53 @@ base_solve(int lev)
 
 			GMG_PROFILE_END();
 			UG_DLOG(LIB_DISC_MULTIGRID, 3, " GMG gathered base solver done.\n");
+
+		//	start sending the correction. The data is collected immediately,
+		//	the sends are completed in base_solve_end.
+			#ifdef UG_PARALLEL
+			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_Send);
+			ComPol_VecCopy<vector_type> cpVecCopy(spGatheredBaseCorr.get());
+			m_Com.send_data(spGatheredBaseCorr->layouts()->vertical_master(), cpVecCopy);
+			m_Com.communicate_and_resume(baseCorrTag);
+			GMG_PROFILE_END();
+			#endif
 		}
+	}
+	}
+	UG_CATCH_THROW("GMG: Base Solver failed.");
+}
+
+// receives the distributed base correction and updates the defect
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+base_solve_end(int lev)
+{
+	GMG_PROFILE_FUNC();
+
+	try{
+	LevData& ld = *m_vLevData[lev];
 
+//	CASE b): receive the correction from the gathering master
+	if(m_bGatheredBaseUsed)
+	{
 	//	broadcast the correction
 		#ifdef UG_PARALLEL
-		SmartPtr<GF> spC = ld.sc;
-		if(gathered_base_master()) spC = spGatheredBaseCorr;
-
-		GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_SendAndRecieve);
-		ComPol_VecCopy<vector_type> cpVecCopy(spC.get());
-		m_Com.send_data(spC->layouts()->vertical_master(), cpVecCopy);
-		m_Com.receive_data(spC->layouts()->vertical_slave(), cpVecCopy);
-		m_Com.communicate();
-		GMG_PROFILE_END();
 		if(gathered_base_master()){
+			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_SendWait);
+			m_Com.wait();
+			GMG_PROFILE_END();
+
 			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_CopyGhostToNoghost);
 			spGatheredBaseCorr->set_storage_type(PST_CONSISTENT);
 			copy_ghost_to_noghost(ld.sc, spGatheredBaseCorr, ld.vMapPatchToGlobal);
 			GMG_PROFILE_END();
 		} else {
+			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_Recieve);
+			ComPol_VecCopy<vector_type> cpVecCopy(ld.sc.get());
+			m_Com.receive_data(ld.sc->layouts()->vertical_slave(), cpVecCopy);
+			m_Com.communicate(baseCorrTag);
+			GMG_PROFILE_END();
+
 			ld.sc->set_storage_type(PST_CONSISTENT);
 		}
 		#endif
@@ -2003,7 +2226,6 @@ base_solve(int lev)
 	}
 
 	log_debug_data(lev, "AfterBaseSolver");
-	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - base_solve on level "<<lev<<"\n");
 	}
 	UG_CATCH_THROW("GMG: Base Solver failed.");
 }
@@ -2026,7 +2248,8 @@ lmgc(int lev, int cycleType)
 
 //	presmooth and restrict
 	try{
-		presmooth_and_restriction(lev);
+		presmooth(lev);
+		restriction(lev);
 	}
 	UG_CATCH_THROW("GMG::lmgc: presmooth-restriction failed on level "<<lev);
 
@@ -2051,13 +2274,286 @@ lmgc(int lev, int cycleType)
 
 //	prolongate, add coarse-grid correction and postsmooth
 	try{
-		prolongation_and_postsmooth(lev);
+		prolongation(lev);
+		postsmooth(lev);
 	}
 	UG_CATCH_THROW("GMG::lmgc: prolongation-postsmooth failed on level "<<lev);
 
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - lmgc on level "<<lev<<"\n");
 }
 
+// performs a multi grid cycle on the level for all columns of a block
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+multi_lmgc(int lev, int cycleType)
+{
+	GMG_PROFILE_FUNC();
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - multi_lmgc on level "<<lev<<"\n");
+	const size_t numCol = m_vpC.size();
+
+//	check if already base level
+	if(lev == m_baseLev) {
+		for(size_t k = 0; k < numCol; ++k){
+			select_column(k);
+			base_solve(m_topLev);
+		}
+		return;
+	} else if(lev < m_baseLev){
+		UG_THROW("GMG::multi_lmgc: call multi_lmgc only for lev > baseLev.");
+	}
+
+//	presmooth all columns at once and restrict each column
+	try{
+		multi_presmooth(lev);
+		for(size_t k = 0; k < numCol; ++k){
+			select_column(k);
+			restriction(lev);
+		}
+	}
+	UG_CATCH_THROW("GMG::multi_lmgc: presmooth-restriction failed on level "<<lev);
+
+	try{
+//	on base level, invert only once
+	if(lev-1 == m_baseLev) {
+		for(size_t k = 0; k < numCol; ++k){
+			select_column(k);
+			base_solve(lev-1);
+		}
+	}
+//	F-cycle: one F-cycle on lev-1, followed by a V-cycle
+	else if(cycleType == _F_){
+		multi_lmgc(lev-1, _F_);
+		multi_lmgc(lev-1, _V_);
+	}
+//	V- or W- cycle, or gamma > 2
+	else {
+		for(int i = 0; i < cycleType; ++i)
+			multi_lmgc(lev-1, cycleType);
+	}
+	}
+	UG_CATCH_THROW("GMG::multi_lmgc: Linear multi-grid cycle on level "<<lev-1<<
+				   " failed. (BaseLev="<<m_baseLev<<", TopLev="<<m_topLev<<").");
+
+//	prolongate and add coarse-grid correction for each column, postsmooth all
+	try{
+		for(size_t k = 0; k < numCol; ++k){
+			select_column(k);
+			prolongation(lev);
+		}
+		multi_postsmooth(lev);
+	}
+	UG_CATCH_THROW("GMG::multi_lmgc: prolongation-postsmooth failed on level "<<lev);
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - multi_lmgc on level "<<lev<<"\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+multi_presmooth(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
+	const size_t numCol = m_vpC.size();
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - multi_presmooth on level "<<lev<<"\n");
+
+	MultiVector<vector_type> vd, vt, vdCoarse;
+	level_block(vd, lf.vsd);
+	level_block(vt, lf.vst);
+	level_block(vdCoarse, lc.vsd);
+
+//	PRESMOOTH
+	GMG_PROFILE_BEGIN(GMG_MultiPreSmooth);
+	try{
+	//	smooth several times
+		for(int nu = 0; nu < m_numPreSmooth; ++nu)
+		{
+		//	a)  Compute t_k = B*d_k with some iterator B for all columns
+			if(!lf.PreSmoother->multi_apply(vt, vd))
+				UG_THROW("GMG: Smoothing step "<<nu+1<<" on level "<<lev<<" failed.");
+
+		//	b) handle patch rim.
+			if(!m_bSmoothOnSurfaceRim){
+				const std::vector<size_t>& vShadowing = lf.vShadowing;
+				for(size_t k = 0; k < numCol; ++k)
+					for(size_t i = 0; i < vShadowing.size(); ++i)
+						vt[k][ vShadowing[i] ] = 0.0;
+			} else {
+				if(lev > m_LocalFullRefLevel)
+					MatMultMultiSub(vdCoarse, lc.RimCpl_Coarse_Fine, vt);
+				// make sure each lc.sd has the same PST
+				// (if m_LocalFullRefLevel not equal on every proc)
+				#ifdef UG_PARALLEL
+				else
+					for(size_t k = 0; k < numCol; ++k)
+						vdCoarse[k].set_storage_type(PST_ADDITIVE);
+				#endif
+			}
+
+		//	c) update the defects with these corrections (one pass over A) ...
+			lf.A->multi_apply_sub(vd, vt);
+
+		//	d) ... and add the corrections to the overall corrections
+			for(size_t k = 0; k < numCol; ++k)
+				(*lf.vsc[k]) += (*lf.vst[k]);
+		}
+	}
+	UG_CATCH_THROW("GMG: Pre-Smoothing on level "<<lev<<" failed.");
+	GMG_PROFILE_END();
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - multi_presmooth on level "<<lev<<"\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+multi_postsmooth(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
+	const size_t numCol = m_vpC.size();
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - multi_postsmooth on level "<<lev<<"\n");
+
+	MultiVector<vector_type> vd, vt, vdCoarse;
+	level_block(vd, lf.vsd);
+	level_block(vt, lf.vst);
+	level_block(vdCoarse, lc.vsd);
+
+// 	POST-SMOOTH:
+	GMG_PROFILE_BEGIN(GMG_MultiPostSmooth);
+	try{
+	//	smooth several times
+		for(int nu = 0; nu < m_numPostSmooth; ++nu)
+		{
+		//	update defects (one pass over A)
+			lf.A->multi_apply_sub(vd, vt);
+
+		//	a)  Compute t_k = B*d_k with some iterator B for all columns
+			if(!lf.PostSmoother->multi_apply(vt, vd))
+				UG_THROW("GMG: Smoothing step "<<nu+1<<" on level "<<lev<<" failed.");
+
+		//	b) handle patch rim
+			if(!m_bSmoothOnSurfaceRim){
+				const std::vector<size_t>& vShadowing = lf.vShadowing;
+				for(size_t k = 0; k < numCol; ++k)
+					for(size_t i = 0; i < vShadowing.size(); ++i)
+						vt[k][ vShadowing[i] ] = 0.0;
+			} else {
+				if(lev > m_LocalFullRefLevel)
+					MatMultMultiSub(vdCoarse, lc.RimCpl_Coarse_Fine, vt);
+			}
+
+		//	d) ... and add the corrections to the overall corrections
+			for(size_t k = 0; k < numCol; ++k)
+				(*lf.vsc[k]) += (*lf.vst[k]);
+		}
+	}
+	UG_CATCH_THROW("GMG: Post-Smoothing on level "<<lev<<" failed. ")
+	GMG_PROFILE_END();
+
+//	update the defects if required (see postsmooth)
+	if(lev >= m_LocalFullRefLevel){
+		GMG_PROFILE_BEGIN(GMG_UpdateDefectAfterMultiPostSmooth);
+		lf.A->multi_apply_sub(vd, vt);
+		GMG_PROFILE_END();
+	}
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - multi_postsmooth on level "<<lev<<"\n");
+}
+
+// computes the smoothed correction of the additive cycle on a level
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+additive_smooth(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& ld = *m_vLevData[lev];
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - additive smooth on level "<<lev<<"\n");
+	log_debug_data(lev, "BeforeAdditiveSmooth");
+
+//	the pre-smoothing steps followed by the post-smoothing steps, each applied
+//	to the restricted defect, that is not needed for the other levels anymore
+	const int numSteps = m_numPreSmooth + m_numPostSmooth;
+	try{
+		for(int nu = 0; nu < numSteps; ++nu)
+		{
+		//	a)  Compute t = B*d with some iterator B
+			ILinearIterator<vector_type>& smoother =
+				(nu < m_numPreSmooth) ? *ld.PreSmoother : *ld.PostSmoother;
+			if(!smoother.apply(*ld.st, *ld.sd))
+				UG_THROW("GMG: Smoothing step "<<nu+1<<" on level "<<lev<<" failed.");
+
+		//	b) handle patch rim (smoothing on the rim is not supported, see init)
+			const std::vector<size_t>& vShadowing = ld.vShadowing;
+			for(size_t i = 0; i < vShadowing.size(); ++i)
+				(*ld.st)[ vShadowing[i] ] = 0.0;
+
+		//	c) update the defect if another step follows ...
+			if(nu < numSteps - 1)
+				ld.A->apply_sub(*ld.sd, *ld.st);
+
+		//	d) ... and add the correction to the overall correction
+			(*ld.sc) += (*ld.st);
+		}
+	}
+	UG_CATCH_THROW("GMG: Additive smoothing on level "<<lev<<" failed.");
+
+	log_debug_data(lev, "AfterAdditiveSmooth");
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - additive smooth on level "<<lev<<"\n");
+}
+
+// performs an additive multi grid cycle
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+additive_mgc()
+{
+	GMG_PROFILE_FUNC();
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - additive_mgc\n");
+
+//	restrict the unsmoothed defect to all levels
+	for(int lev = m_topLev; lev > m_baseLev; --lev){
+		try{
+			restriction(lev);
+		}
+		UG_CATCH_THROW("GMG::additive_mgc: restriction failed on level "<<lev);
+	}
+
+//	compute the level corrections. These only depend on the restricted
+//	defects and are thus independent of each other. The base solver is
+//	started first: If the base problem is gathered to one process, the other
+//	processes smooth their levels while it is solved and only then wait for
+//	the base correction.
+	try{
+		base_solve_begin(m_baseLev);
+	}
+	UG_CATCH_THROW("GMG::additive_mgc: base solver failed on level "<<m_baseLev);
+
+	for(int lev = m_topLev; lev > m_baseLev; --lev){
+		try{
+			additive_smooth(lev);
+		}
+		UG_CATCH_THROW("GMG::additive_mgc: smoothing failed on level "<<lev);
+	}
+
+	try{
+		base_solve_end(m_baseLev);
+	}
+	UG_CATCH_THROW("GMG::additive_mgc: base solver failed on level "<<m_baseLev);
+
+//	prolongate and sum up the corrections
+	for(int lev = m_baseLev + 1; lev <= m_topLev; ++lev){
+		try{
+			prolongation(lev);
+		}
+		UG_CATCH_THROW("GMG::additive_mgc: prolongation failed on level "<<lev);
+	}
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - additive_mgc\n");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Debug Methods
 ////////////////////////////////////////////////////////////////////////////////
@@ -2194,6 +2690,7 @@ config_string() const
 	if(m_cycleType == _V_) ss << "V-Cycle";
 	else if(m_cycleType == _W_) ss << "W-Cycle";
 	else if(m_cycleType == _F_) ss << "F-Cycle";
+	else if(m_cycleType == _A_) ss << "Additive-Cycle";
 	else ss << " " << m_cycleType << "-Cycle";
 	ss << ")\n";
 
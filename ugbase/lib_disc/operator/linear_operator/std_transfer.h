@@ -114,6 +114,24 @@ class StdTransfer :
 	///	sets if restriction and prolongation are transposed
 		void set_use_transposed(bool bTransposed) {m_bUseTransposed = bTransposed;}
 
+	///	enables/disables the matrix-free application for p1-lagrange elements
+	/**	If enabled, no transfer matrices are assembled and stored. Instead,
+	 * prolongation and restriction are applied directly by walking the
+	 * parent-child relations of the fine vertices. This is only possible for
+	 * p1-lagrange (and q1) functions and, as the p1-lagrange optimization,
+	 * requires that all elements have been refined with their standard
+	 * refinement rule. Constraints are then taken into account through their
+	 * vector-based adjust_prolongation/adjust_restriction, which are applied
+	 * before damping, as in the assembled matrices. The vector-based
+	 * adjustments are only used in this mode. As in the assembled case, the
+	 * hanging-node constraints set the prolongated values at constrained
+	 * vertices to zero and those vertices do not contribute to the
+	 * restriction. If the restriction
+	 * is not the transposed of the prolongation (cf. set_use_transposed), the
+	 * restriction matrix is assembled and used nevertheless.*/
+		void enable_matrix_free(bool enable)	{bCached = !enable;}
+		bool matrix_free_enabled() const		{return !bCached;}
+
 	public:
 	///	Set levels
 		virtual void set_levels(GridLevel coarseLevel, GridLevel fineLevel) {}
@@ -190,6 +208,20 @@ class StdTransfer :
 		                             const DoFDistribution& fineDD,
 		                             const DoFDistribution& coarseDD);
 
+	///	matrix-free prolongation for p1-lagrange elements (undamped)
+		void prolongate_p1(GF& uFine, const GF& uCoarse);
+
+	///	matrix-free restriction for p1-lagrange elements (undamped)
+	/**	Only coarse entries receiving fine contributions are written. Those
+	 * are marked in m_vTouched. Constrained fine vertices are skipped if
+	 * bSkipConstrained is true.*/
+		void restrict_p1(GF& uCoarse, const GF& uFine, bool bSkipConstrained);
+
+	///	returns the coarse p1-dofs (and their common weight) a fine vertex is interpolated from
+		void p1_parent_dofs(std::vector<DoFIndex>& vParentDoF, number& weight,
+		                    GridObject* parent, size_t fct,
+		                    const DoFDistribution& coarseDD);
+
 	protected:
 	///	struct to distinguish already assembled operators
 		struct TransferKey{
@@ -240,6 +272,9 @@ class StdTransfer :
 	///	flag if transposed is used
 		bool m_bUseTransposed;
 
+	///	coarse entries written by the last matrix-free restriction
+		std::vector<bool> m_vTouched;
+
 	///	debug writer
 		SmartPtr<IDebugWriter<TAlgebra> > m_spDebugWriter;
 };
@@ -164,6 +164,222 @@ assemble_prolongation_p1(matrix_type& P,
 		}
 	}
 }
+
+template <typename TDomain, typename TAlgebra>
+void StdTransfer<TDomain, TAlgebra>::
+p1_parent_dofs(std::vector<DoFIndex>& vParentDoF, number& weight,
+               GridObject* parent, size_t fct,
+               const DoFDistribution& coarseDD)
+{
+	vParentDoF.clear();
+
+	Vertex* const* vrts = NULL;
+	size_t numVrts = 0;
+	switch(parent->reference_object_id())
+	{
+		case ROID_VERTEX:
+			coarseDD.inner_dof_indices(static_cast<Vertex*>(parent), fct, vParentDoF);
+			weight = 1.0;
+			return;
+		case ROID_EDGE:
+			vrts = static_cast<Edge*>(parent)->vertices();
+			numVrts = 2;
+			break;
+		case ROID_QUADRILATERAL:
+			vrts = static_cast<Face*>(parent)->vertices();
+			numVrts = 4;
+			break;
+		case ROID_HEXAHEDRON:
+			vrts = static_cast<Volume*>(parent)->vertices();
+			numVrts = 8;
+			break;
+		default: UG_THROW("StdTransfer: Element father is of unsupported type "
+		                  << parent->reference_object_id() << " for matrix-free "
+		                  "p1-lagrange transfer.");
+	}
+
+	for(size_t i = 0; i < numVrts; ++i)
+		coarseDD.inner_dof_indices(vrts[i], fct, vParentDoF, false);
+	weight = 1.0 / numVrts;
+}
+
+template <typename TDomain, typename TAlgebra>
+void StdTransfer<TDomain, TAlgebra>::
+prolongate_p1(GF& uFine, const GF& uCoarse)
+{
+	PROFILE_FUNC_GROUP("gmg");
+	const DoFDistribution& fineDD = *uFine.dd();
+	const DoFDistribution& coarseDD = *uCoarse.dd();
+
+// 	allow only lagrange P1 functions
+	for(size_t fct = 0; fct < fineDD.num_fct(); ++fct)
+		if(fineDD.lfeid(fct).type() != LFEID::LAGRANGE ||
+			fineDD.lfeid(fct).order() != 1)
+			UG_THROW("StdTransfer: Matrix-free transfer only implemented for "
+					"Lagrange P1 functions.");
+
+//  iterators
+	const MultiGrid& mg = *coarseDD.multi_grid();
+	typedef DoFDistribution::traits<Vertex>::const_iterator const_iterator;
+	const_iterator iter, iterBegin, iterEnd;
+
+//  loop subsets on fine level
+	std::vector<size_t> vParentIndex, vChildIndex;
+	std::vector<DoFIndex> vParentDoF, vChildDoF;
+	number weight;
+	for(int si = 0; si < fineDD.num_subsets(); ++si)
+	{
+		iterBegin = fineDD.template begin<Vertex>(si);
+		iterEnd = fineDD.template end<Vertex>(si);
+
+	//  loop vertices for fine level subset
+		for(iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get element
+			Vertex* child = *iter;
+
+		//	child contained in coarseDD (cf. assemble_prolongation_p1): copy
+			if(coarseDD.is_contained(child)){
+				coarseDD.inner_algebra_indices(child, vParentIndex);
+				fineDD.inner_algebra_indices(child, vChildIndex);
+				UG_ASSERT(vParentIndex.size() == vChildIndex.size(), "Size mismatch");
+
+				for(size_t i = 0; i < vParentIndex.size(); ++i)
+					uFine[vChildIndex[i]] = uCoarse[vParentIndex[i]];
+				continue;
+			}
+
+		//  get father (may be missing for v-slaves)
+			GridObject* parent = mg.get_parent(child);
+			if(!parent) continue;
+
+			if(!coarseDD.is_contained(parent)){
+				UG_THROW("StdTransfer: A parent element is not contained in "
+						" coarse-dd nor the child element in the coarse-dd. "
+						"This should not happen.")
+			}
+
+		//	interpolate all components
+			for(size_t fct = 0; fct < fineDD.num_fct(); fct++)
+			{
+				if(!fineDD.is_def_in_subset(fct, si)) continue;
+
+				fineDD.inner_dof_indices(child, fct, vChildDoF);
+				p1_parent_dofs(vParentDoF, weight, parent, fct, coarseDD);
+
+				number val = 0.0;
+				for(size_t i = 0; i < vParentDoF.size(); ++i)
+					val += DoFRef(uCoarse, vParentDoF[i]);
+
+				DoFRef(uFine, vChildDoF[0]) = weight * val;
+			}
+		}
+	}
+
+#ifdef UG_PARALLEL
+	if(uCoarse.has_storage_type(PST_CONSISTENT))
+		uFine.set_storage_type(PST_CONSISTENT);
+	else if(uCoarse.has_storage_type(PST_ADDITIVE))
+		uFine.set_storage_type(PST_ADDITIVE);
+	else
+		UG_THROW("StdTransfer: Coarse vector must be additive or consistent "
+				"for matrix-free prolongation.");
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+void StdTransfer<TDomain, TAlgebra>::
+restrict_p1(GF& uCoarse, const GF& uFine, bool bSkipConstrained)
+{
+	PROFILE_FUNC_GROUP("gmg");
+	const DoFDistribution& fineDD = *uFine.dd();
+	const DoFDistribution& coarseDD = *uCoarse.dd();
+
+// 	allow only lagrange P1 functions
+	for(size_t fct = 0; fct < fineDD.num_fct(); ++fct)
+		if(fineDD.lfeid(fct).type() != LFEID::LAGRANGE ||
+			fineDD.lfeid(fct).order() != 1)
+			UG_THROW("StdTransfer: Matrix-free transfer only implemented for "
+					"Lagrange P1 functions.");
+
+//	As for the restriction matrix (applied ignoring zero rows), only those
+//	coarse entries are overwritten, that receive a contribution from the fine
+//	level. They are reset on first touch.
+	std::vector<bool>& vTouched = m_vTouched;
+	vTouched.assign(uCoarse.size(), false);
+
+//  iterators
+	const MultiGrid& mg = *coarseDD.multi_grid();
+	typedef DoFDistribution::traits<Vertex>::const_iterator const_iterator;
+	const_iterator iter, iterBegin, iterEnd;
+
+//  loop subsets on fine level
+	std::vector<size_t> vParentIndex, vChildIndex;
+	std::vector<DoFIndex> vParentDoF, vChildDoF;
+	number weight;
+	for(int si = 0; si < fineDD.num_subsets(); ++si)
+	{
+		iterBegin = fineDD.template begin<Vertex>(si);
+		iterEnd = fineDD.template end<Vertex>(si);
+
+	//  loop vertices for fine level subset
+		for(iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get element
+			Vertex* child = *iter;
+
+		//	constrained vertices have zero rows in the prolongation
+			if(bSkipConstrained && child->is_constrained()) continue;
+
+		//	child contained in coarseDD (cf. assemble_prolongation_p1): copy
+			if(coarseDD.is_contained(child)){
+				coarseDD.inner_algebra_indices(child, vParentIndex);
+				fineDD.inner_algebra_indices(child, vChildIndex);
+				UG_ASSERT(vParentIndex.size() == vChildIndex.size(), "Size mismatch");
+
+				for(size_t i = 0; i < vParentIndex.size(); ++i){
+					const size_t ind = vParentIndex[i];
+					if(!vTouched[ind]){
+						uCoarse[ind] = 0.0;
+						vTouched[ind] = true;
+					}
+					uCoarse[ind] += uFine[vChildIndex[i]];
+				}
+				continue;
+			}
+
+		//  get father (may be missing for v-slaves)
+			GridObject* parent = mg.get_parent(child);
+			if(!parent) continue;
+
+			if(!coarseDD.is_contained(parent)){
+				UG_THROW("StdTransfer: A parent element is not contained in "
+						" coarse-dd nor the child element in the coarse-dd. "
+						"This should not happen.")
+			}
+
+		//	distribute all components to the parents
+			for(size_t fct = 0; fct < fineDD.num_fct(); fct++)
+			{
+				if(!fineDD.is_def_in_subset(fct, si)) continue;
+
+				fineDD.inner_dof_indices(child, fct, vChildDoF);
+				p1_parent_dofs(vParentDoF, weight, parent, fct, coarseDD);
+
+				const number val = weight * DoFRef(uFine, vChildDoF[0]);
+				for(size_t i = 0; i < vParentDoF.size(); ++i){
+					const size_t ind = vParentDoF[i][0];
+					if(!vTouched[ind]){
+						uCoarse[ind] = 0.0;
+						vTouched[ind] = true;
+					}
+					DoFRef(uCoarse, vParentDoF[i]) += val;
+				}
+			}
+		}
+	}
+}
+
 /*
 template <typename TDomain>
 void ProjectGlobalPositionToElem(std::vector<MathVector<TDomain::dim> >& vGlobPos,
@@ -720,9 +936,6 @@ prolongate(GF& uFine, const GF& uCoarse)
 {
 	PROFILE_FUNC_GROUP("gmg");
 
-	if(!bCached)
-		UG_THROW("StdTransfer: currently only cached implemented.");
-
 	const GridLevel& coarseGL = uCoarse.grid_level();
 	const GridLevel& fineGL = uFine.grid_level();
 	ConstSmartPtr<ApproximationSpace<TDomain> > spApproxSpace = uFine.approx_space();
@@ -731,21 +944,30 @@ prolongate(GF& uFine, const GF& uCoarse)
 				"different approximation spaces.");
 
 	try{
+		if(!bCached){
+			prolongate_p1(uFine, uCoarse);
+
+		// 	adjust using constraints (the assembled matrices are adjusted
+		//	instead). As the matrix, the adjustment is applied undamped.
+			for (int type = 1; type < CT_ALL; type = type << 1)
+			{
+				for (size_t i = 0; i < m_vConstraint.size(); ++i)
+				{
+					if (m_vConstraint[i]->type() & type)
+						m_vConstraint[i]->adjust_prolongation(uFine, fineGL, uCoarse, coarseGL, type);
+				}
+			}
+
+			if(m_dampProl != 1.0)
+				uFine *= m_dampProl;
+		}
+		else{
 		//prolongation(fineGL, coarseGL, spApproxSpace)->apply(uFine, uCoarse);
 #ifdef UG_PARALLEL
 		MatMultDirect(uFine, m_dampProl, *prolongation(fineGL, coarseGL, spApproxSpace), uCoarse);
 #else
 		prolongation(fineGL, coarseGL, spApproxSpace)->axpy(uFine, 0.0, uFine, m_dampProl, uCoarse);
 #endif
-
-	// 	adjust using constraints
-		for (int type = 1; type < CT_ALL; type = type << 1)
-		{
-			for (size_t i = 0; i < m_vConstraint.size(); ++i)
-			{
-				if (m_vConstraint[i]->type() & type)
-					m_vConstraint[i]->adjust_prolongation(uFine, fineGL, uCoarse, coarseGL, type);
-			}
 		}
 
 	}
@@ -775,9 +997,6 @@ do_restrict(GF& uCoarse, const GF& uFine)
 {
 	PROFILE_FUNC_GROUP("gmg");
 
-	if(!bCached)
-		UG_THROW("StdTransfer: currently only cached implemented.");
-
 	const GridLevel& coarseGL = uCoarse.grid_level();
 	const GridLevel& fineGL = uFine.grid_level();
 	ConstSmartPtr<ApproximationSpace<TDomain> > spApproxSpace = uFine.approx_space();
@@ -786,18 +1005,37 @@ do_restrict(GF& uCoarse, const GF& uFine)
 				"different approximation spaces.");
 	try{
 
-		restriction(coarseGL, fineGL, spApproxSpace)->
-				apply_ignore_zero_rows(uCoarse, m_dampRes, uFine);
-
-	// 	adjust using constraints
-		for (int type = 1; type < CT_ALL; type = type << 1)
-		{
+		if(!bCached && m_bUseTransposed){
+		//	the restriction is the transposed of the prolongation. Hanging-node
+		//	constraints zero the rows of constrained fine dofs in the
+		//	prolongation, thus those dofs must not contribute to the restriction.
+			bool bHanging = false;
 			for (size_t i = 0; i < m_vConstraint.size(); ++i)
+				if (m_vConstraint[i]->type() & CT_HANGING)
+					bHanging = true;
+
+			restrict_p1(uCoarse, uFine, bHanging);
+
+		// 	adjust using constraints (the assembled matrices are adjusted
+		//	instead). As the matrix, the adjustment is applied undamped.
+			for (int type = 1; type < CT_ALL; type = type << 1)
 			{
-				if (m_vConstraint[i]->type() & type)
-					m_vConstraint[i]->adjust_restriction(uCoarse, coarseGL, uFine, fineGL, type);
+				for (size_t i = 0; i < m_vConstraint.size(); ++i)
+				{
+					if (m_vConstraint[i]->type() & type)
+						m_vConstraint[i]->adjust_restriction(uCoarse, coarseGL, uFine, fineGL, type);
+				}
 			}
+
+		//	damp the entries written by the restriction
+			if(m_dampRes != 1.0)
+				for(size_t i = 0; i < m_vTouched.size(); ++i)
+					if(m_vTouched[i])
+						uCoarse[i] *= m_dampRes;
 		}
+		else
+			restriction(coarseGL, fineGL, spApproxSpace)->
+					apply_ignore_zero_rows(uCoarse, m_dampRes, uFine);
 
 	} UG_CATCH_THROW("StdTransfer:do_restrict: Failed for fine = "<<fineGL<<" and "
 	                 " coarse = "<<coarseGL);
@@ -815,6 +1053,7 @@ StdTransfer<TDomain, TAlgebra>::clone()
 	op->set_debug(m_spDebugWriter);
 	op->enable_p1_lagrange_optimization(p1_lagrange_optimization_enabled());
 	op->set_use_transposed(m_bUseTransposed);
+	op->enable_matrix_free(matrix_free_enabled());
 	return op;
 }
 
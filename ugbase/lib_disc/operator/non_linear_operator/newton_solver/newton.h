@@ -43,6 +43,8 @@
 #include "lib_disc/assemble_interface.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/jacobian_free_operator.h"
+#include "lib_disc/time_disc/time_disc_interface.h"
 #include "../line_search.h"
 #include "newton_update_interface.h"
 #include "lib_algebra/operator/debug_writer.h"
@@ -90,6 +92,63 @@ class NewtonSolver
 		void set_line_search(SmartPtr<ILineSearch<vector_type> > spLineSearch) {m_spLineSearch = spLineSearch;}
 		void disable_line_search() {m_spLineSearch = SPNULL;}
 
+	///	enables the Jacobian-free Newton-Krylov mode
+	/**
+	 * In the Jacobian-free mode, the linear solver is applied to a finite
+	 * difference approximation of the Jacobian, that only requires the assembling
+	 * of defects (see JacobianFreeOperator). The assembled Jacobian is only
+	 * used for the preconditioner of the linear solver, that must be a Krylov
+	 * method. It is assembled in the first Newton step and then only every
+	 * n-th step (see set_jacobian_free_precond_update).
+	 */
+		void set_jacobian_free(bool bJacobianFree) {m_bJacobianFree = bJacobianFree;}
+
+	///	returns if the Jacobian-free Newton-Krylov mode is enabled
+		bool jacobian_free() const {return m_bJacobianFree;}
+
+	///	sets the relative size of the finite difference increment in the Jacobian-free mode
+		void set_jacobian_free_epsilon(number eps) {m_jfEpsilon = eps;}
+
+	///	sets after how many Newton steps the preconditioner matrix is reassembled (0 = only in first step)
+		void set_jacobian_free_precond_update(int numSteps) {m_jfPrecondUpdate = numSteps;}
+
+	///	sets a discretization (e.g. lower order) used to assemble the preconditioner matrix
+		void set_jacobian_free_precond_discretization(SmartPtr<IAssemble<TAlgebra> > spAss)
+			{m_spJFPrecondAss = spAss;}
+
+	///	enables the reuse of the Jacobian and the linear solver setup
+	/**
+	 * If enabled, the Jacobian is not reassembled (and the linear solver, i.e.
+	 * the preconditioner, is not re-initialized) in every Newton step, but
+	 * kept across Newton steps and calls of apply (e.g. time steps), until
+	 * - the linear solver needs more than factor times the number of steps of
+	 *   the first solve with the current Jacobian (see set_reuse_lin_steps_factor),
+	 * - the nonlinear defect reduction of a step is worse than the given
+	 *   contraction (see set_reuse_max_contraction),
+	 * - the linear solver fails (the step is then repeated with a new Jacobian),
+	 * - the size of the system changes,
+	 * - or, for a time discretization, the scaling of the stiffness part
+	 *   changes (e.g. a new time step size or stage).
+	 * Without the Jacobian-free mode, the Newton method becomes a modified
+	 * Newton method with lagged Jacobian.
+	 */
+		void set_reuse_jacobian(bool bReuse) {m_bReuseJacobian = bReuse;}
+
+	///	sets the factor of linear steps (w.r.t. the first solve) that triggers a new Jacobian
+		void set_reuse_lin_steps_factor(number factor) {m_reuseLinStepsFactor = factor;}
+
+	///	sets the nonlinear contraction rate that triggers a new Jacobian
+		void set_reuse_max_contraction(number rate) {m_reuseMaxContraction = rate;}
+
+	///	forces the assembling of the Jacobian in the next Newton step
+		void force_jacobian_update() {m_bJacobianOutdated = true;}
+
+	///	statistics of the reuse policy
+	/// \{
+		int num_jacobian_assemblies() const {return m_numJacobianAssemblies;}
+		int num_jacobian_reuses() const {return m_numJacobianReuses;}
+	/// \}
+
 	/// This operator inverts the Operator N: Y -> X
 		virtual bool init(SmartPtr<IOperator<vector_type> > N);
 
@@ -142,6 +201,10 @@ class NewtonSolver
 		void clear_step_update(SmartPtr<INewtonUpdate > NU)
 			{m_stepUpdate.clear();}
 
+	private:
+	///	assembles the Jacobian at u and initializes the linear solver
+		bool assemble_jacobian_and_init_solver(const vector_type& u, const char* ext);
+
 	private:
 	///	help functions for debug output
 	///	\{
@@ -170,6 +233,27 @@ class NewtonSolver
 	///	assembling
 		SmartPtr<IAssemble<TAlgebra> > m_spAss;
 
+	///	Jacobian-free Newton-Krylov mode
+	/// \{
+		bool m_bJacobianFree;
+		number m_jfEpsilon;
+		int m_jfPrecondUpdate;
+		SmartPtr<IAssemble<TAlgebra> > m_spJFPrecondAss;
+		SmartPtr<JacobianFreeOperator<algebra_type> > m_spJFOp;
+	/// \}
+
+	///	reuse policy for the Jacobian
+	/// \{
+		bool m_bReuseJacobian;
+		number m_reuseLinStepsFactor;
+		number m_reuseMaxContraction;
+		bool m_bJacobianOutdated;
+		number m_jacobianStiffScaling;	///< time disc scaling of the kept Jacobian
+		int m_reuseRefLinSteps;
+		int m_numJacobianAssemblies;
+		int m_numJacobianReuses;
+	/// \}
+
 	/// line search parameters
 	/// \{
 		int m_maxLineSearch;
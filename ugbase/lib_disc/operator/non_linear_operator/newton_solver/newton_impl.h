@@ -35,6 +35,8 @@
 
 #include <iostream>
 #include <sstream>
+#include <limits>
+#include <algorithm>
 
 #include "newton.h"
 #include "lib_disc/function_spaces/grid_function_util.h"
@@ -64,6 +66,17 @@ NewtonSolver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver,
 			m_N(NULL),
 			m_J(NULL),
 			m_spAss(NULL),
+			m_bJacobianFree(false),
+			m_jfEpsilon(std::sqrt(std::numeric_limits<number>::epsilon())),
+			m_jfPrecondUpdate(0),
+			m_bReuseJacobian(false),
+			m_reuseLinStepsFactor(2.0),
+			m_reuseMaxContraction(0.5),
+			m_bJacobianOutdated(true),
+			m_jacobianStiffScaling(0.0),
+			m_reuseRefLinSteps(0),
+			m_numJacobianAssemblies(0),
+			m_numJacobianReuses(0),
 			m_dgbCall(0)
 {};
 
@@ -76,6 +89,17 @@ NewtonSolver() :
 	m_N(NULL),
 	m_J(NULL),
 	m_spAss(NULL),
+	m_bJacobianFree(false),
+	m_jfEpsilon(std::sqrt(std::numeric_limits<number>::epsilon())),
+	m_jfPrecondUpdate(0),
+	m_bReuseJacobian(false),
+	m_reuseLinStepsFactor(2.0),
+	m_reuseMaxContraction(0.5),
+	m_bJacobianOutdated(true),
+	m_jacobianStiffScaling(0.0),
+	m_reuseRefLinSteps(0),
+	m_numJacobianAssemblies(0),
+	m_numJacobianReuses(0),
 	m_dgbCall(0)
 {};
 
@@ -88,6 +112,17 @@ NewtonSolver(SmartPtr<IOperator<vector_type> > N) :
 	m_N(NULL),
 	m_J(NULL),
 	m_spAss(NULL),
+	m_bJacobianFree(false),
+	m_jfEpsilon(std::sqrt(std::numeric_limits<number>::epsilon())),
+	m_jfPrecondUpdate(0),
+	m_bReuseJacobian(false),
+	m_reuseLinStepsFactor(2.0),
+	m_reuseMaxContraction(0.5),
+	m_bJacobianOutdated(true),
+	m_jacobianStiffScaling(0.0),
+	m_reuseRefLinSteps(0),
+	m_numJacobianAssemblies(0),
+	m_numJacobianReuses(0),
 	m_dgbCall(0)
 {
 	init(N);
@@ -102,6 +137,17 @@ NewtonSolver(SmartPtr<IAssemble<TAlgebra> > spAss) :
 	m_N(NULL),
 	m_J(NULL),
 	m_spAss(NULL),
+	m_bJacobianFree(false),
+	m_jfEpsilon(std::sqrt(std::numeric_limits<number>::epsilon())),
+	m_jfPrecondUpdate(0),
+	m_bReuseJacobian(false),
+	m_reuseLinStepsFactor(2.0),
+	m_reuseMaxContraction(0.5),
+	m_bJacobianOutdated(true),
+	m_jacobianStiffScaling(0.0),
+	m_reuseRefLinSteps(0),
+	m_numJacobianAssemblies(0),
+	m_numJacobianReuses(0),
 	m_dgbCall(0)
 {
 	m_spAss = spAss;
@@ -148,12 +194,40 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	if(m_spLinearSolver.invalid())
 		UG_THROW("NewtonSolver::apply: Linear Solver not set.");
 
-//	Jacobian
-	if(m_J.invalid() || m_J->discretization() != m_spAss) {
+//	Jacobian (in the Jacobian-free mode the finite difference operator, whose
+//	matrix is assembled for the preconditioner only)
+	if(m_bJacobianFree) {
+		SmartPtr<IAssemble<TAlgebra> > spPrecondAss = m_spAss;
+		if(m_spJFPrecondAss.valid()) spPrecondAss = m_spJFPrecondAss;
+
+		if(m_spJFOp.invalid() || m_spJFOp->nonlinear_operator() != m_N
+			|| m_spJFOp->discretization() != spPrecondAss) {
+			m_spJFOp = make_sp(new JacobianFreeOperator<TAlgebra>(m_N, spPrecondAss));
+			m_bJacobianOutdated = true;
+		}
+		if(m_J.get() != m_spJFOp.get()) m_bJacobianOutdated = true;
+		m_spJFOp->set_epsilon(m_jfEpsilon);
+		m_J = m_spJFOp;
+	}
+	else if(m_J.invalid() || m_J->discretization() != m_spAss
+			|| m_J.template cast_dynamic<JacobianFreeOperator<TAlgebra> >().valid()) {
 		m_J = make_sp(new AssembledLinearOperator<TAlgebra>(m_spAss));
+		m_bJacobianOutdated = true;
 	}
 	m_J->set_level(m_N->level());
 
+//	the Jacobian of a time discretization depends on the time step size and
+//	the stage. A kept Jacobian is outdated if those changed.
+	if(m_bReuseJacobian && !m_bJacobianOutdated){
+		SmartPtr<ITimeDiscretization<TAlgebra> > spTimeDisc =
+			m_J->discretization().template cast_dynamic<ITimeDiscretization<TAlgebra> >();
+		number scale = 0.0;
+		if(spTimeDisc.valid()
+			&& (!spTimeDisc->jacobian_stiffness_scaling(scale)
+				|| scale != m_jacobianStiffScaling))
+			m_bJacobianOutdated = true;
+	}
+
 //	create tmp vectors
 	SmartPtr<vector_type> spD = u.clone_without_values();
 	SmartPtr<vector_type> spC = u.clone_without_values();
@@ -204,41 +278,58 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		for(size_t i = 0; i < m_innerStepUpdate.size(); ++i)
 			m_innerStepUpdate[i]->update();
 
-	// 	Compute Jacobian
-		try{
-		NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
-		m_J->init(u);
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
+	//	in the Jacobian-free mode, the Jacobian is only assembled for the
+	//	preconditioner in the first and then in every m_jfPrecondUpdate-th step
+		bool bAssembleJacobian = true;
+		if(m_bJacobianFree)
+		{
+			m_spJFOp->set_linearization_point(u, *spD);
+			bAssembleJacobian = (loopCnt == 0)
+						|| (m_jfPrecondUpdate > 0 && loopCnt % m_jfPrecondUpdate == 0);
+		}
 
-	//	Write Jacobian for debug
-		std::string matname("NEWTON_Jacobian");
-		matname.append(ext);
-		write_debug(m_J->get_matrix(), matname.c_str());
+	//	with the reuse policy, the Jacobian (and the setup of the linear solver)
+	//	is kept, until the convergence deteriorates
+		if(m_bReuseJacobian)
+			bAssembleJacobian = m_bJacobianOutdated
+								|| m_J->num_rows() != u.size();
 
-	// 	Init Jacobi Inverse
-		try{
-		NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
-		if(!m_spLinearSolver->init(m_J, u))
-		{
-			UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
-					"Operator for Jacobi-Operator.\n");
-			return false;
+		if(bAssembleJacobian){
+			if(!assemble_jacobian_and_init_solver(u, ext)) return false;
 		}
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
+		else
+			m_numJacobianReuses++;
 
 	// 	Solve Linearized System
+		bool bSolved = false;
 		try{
 		NEWTON_PROFILE_BEGIN(NewtonApplyLinSolver);
-		if(!m_spLinearSolver->apply(*spC, *spD))
+		bSolved = m_spLinearSolver->apply(*spC, *spD);
+		NEWTON_PROFILE_END();
+		}UG_CATCH_THROW("NewtonSolver::apply: Application of Linear Solver failed.");
+
+	//	if the linear solver failed with a reused Jacobian, retry with a new one
+		if(!bSolved && !bAssembleJacobian)
+		{
+			UG_LOG("   #  Linear solver failed with reused Jacobian. "
+					"Reassembling Jacobian.\n");
+			bAssembleJacobian = true;
+			if(!assemble_jacobian_and_init_solver(u, ext)) return false;
+
+			spC->set(0.0);
+			try{
+			NEWTON_PROFILE_BEGIN(NewtonApplyLinSolver);
+			bSolved = m_spLinearSolver->apply(*spC, *spD);
+			NEWTON_PROFILE_END();
+			}UG_CATCH_THROW("NewtonSolver::apply: Application of Linear Solver failed.");
+		}
+
+		if(!bSolved)
 		{
 			UG_LOG("ERROR in 'NewtonSolver::apply': Cannot apply Inverse Linear "
 					"Operator for Jacobi-Operator.\n");
 			return false;
 		}
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Application of Linear Solver failed.");
 
 	//	store convergence history
 		const int numSteps = m_spLinearSolver->step();
@@ -249,6 +340,15 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		m_vLinSolverCalls[loopCnt] += 1;
 		m_vLinSolverRates[loopCnt] += m_spLinearSolver->convergence_check()->avg_rate();
 
+	//	reuse policy: a new Jacobian is needed, if the linear solver needs
+	//	significantly more steps than directly after the last assembling
+		if(m_bReuseJacobian)
+		{
+			if(bAssembleJacobian) m_reuseRefLinSteps = numSteps;
+			else if(numSteps > m_reuseLinStepsFactor * std::max(m_reuseRefLinSteps, 1))
+				m_bJacobianOutdated = true;
+		}
+
 	// 	Line Search
 		try{
 		if(m_spLineSearch.valid())
@@ -287,6 +387,11 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		if(loopCnt-1 >= (int)m_vNonLinSolverRates.size()) m_vNonLinSolverRates.resize(loopCnt, 0);
 		m_vNonLinSolverRates[loopCnt-1] += m_spConvCheck->rate();
 
+	//	reuse policy: a new Jacobian is needed, if the nonlinear contraction
+	//	is worse than requested
+		if(m_bReuseJacobian && m_spConvCheck->rate() > m_reuseMaxContraction)
+			m_bJacobianOutdated = true;
+
 	//	write defect for debug
 		std::string name("NEWTON_Defect"); name.append(ext);
 		write_debug(*spD, name.c_str());
@@ -302,6 +407,44 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	return m_spConvCheck->post();
 }
 
+template <typename TAlgebra>
+bool NewtonSolver<TAlgebra>::assemble_jacobian_and_init_solver(const vector_type& u, const char* ext)
+{
+// 	Compute Jacobian
+	try{
+	NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
+	m_J->init(u);
+	NEWTON_PROFILE_END();
+	}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
+
+//	Write Jacobian for debug
+	std::string matname("NEWTON_Jacobian");
+	matname.append(ext);
+	write_debug(m_J->get_matrix(), matname.c_str());
+
+// 	Init Jacobi Inverse
+	try{
+	NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
+	if(!m_spLinearSolver->init(m_J, u))
+	{
+		UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
+				"Operator for Jacobi-Operator.\n");
+		return false;
+	}
+	NEWTON_PROFILE_END();
+	}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
+
+//	remember the time disc scaling the Jacobian was assembled for
+	SmartPtr<ITimeDiscretization<TAlgebra> > spTimeDisc =
+		m_J->discretization().template cast_dynamic<ITimeDiscretization<TAlgebra> >();
+	if(spTimeDisc.valid())
+		spTimeDisc->jacobian_stiffness_scaling(m_jacobianStiffScaling);
+
+	m_bJacobianOutdated = false;
+	m_numJacobianAssemblies++;
+	return true;
+}
+
 template <typename TAlgebra>
 void NewtonSolver<TAlgebra>::print_average_convergence() const
 {
@@ -330,6 +473,8 @@ void NewtonSolver<TAlgebra>::print_average_convergence() const
 	UG_LOG(std::setw(16) << std::setprecision(6) << std::scientific << std::pow((number)allNonLinRatesProduct,(number)1.0/(number)allCalls) << " | ");
 	UG_LOG(std::setw(13) << std::setprecision(6) << std::scientific << std::pow((number)allLinRatesProduct,(number)1.0/(number)allLinSteps));
 	UG_LOG("\n");
+	UG_LOG("Jacobian assemblies: " << m_numJacobianAssemblies
+	       << ", reuses: " << m_numJacobianReuses << "\n");
 }
 
 template <typename TAlgebra>
@@ -388,6 +533,8 @@ void NewtonSolver<TAlgebra>::clear_average_convergence()
 	m_vNonLinSolverRates.clear();
 	m_vLinSolverCalls.clear();
 	m_vTotalLinSolverSteps.clear();
+	m_numJacobianAssemblies = 0;
+	m_numJacobianReuses = 0;
 }
 
 template <typename TAlgebra>
@@ -430,6 +577,14 @@ std::string NewtonSolver<TAlgebra>::config_string() const
 	ss << " LineSearch: ";
 	if(m_spLineSearch.valid())		ss << ConfigShift(m_spLineSearch->config_string()) << "\n";
 	else							ss << " not set.\n";
+	if(m_bReuseJacobian)
+		ss << " Jacobian reuse: max. linear steps factor = " << m_reuseLinStepsFactor
+		   << ", max. contraction = " << m_reuseMaxContraction << "\n";
+	if(m_bJacobianFree){
+		ss << " Jacobian-free: epsilon = " << m_jfEpsilon << ", preconditioner update = ";
+		if(m_jfPrecondUpdate > 0)	ss << "every " << m_jfPrecondUpdate << " steps\n";
+		else						ss << "first step only\n";
+	}
 	return ss.str();
 }
 
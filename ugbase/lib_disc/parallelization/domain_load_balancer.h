@@ -50,22 +50,19 @@ CreateProcessHierarchy(TDomain& dom, size_t minNumElemsPerProcPerLvl,
 						maxLevelsWithoutRedist, NULL);
 }
 
+///	Collects the number of elements on each level, including elements marked for refinement by the optional refiner.
 template <class TDomain>
-SPProcessHierarchy
-CreateProcessHierarchy(TDomain& dom, size_t minNumElemsPerProcPerLvl,
-					   size_t maxNumRedistProcs, size_t maxNumProcs,
-					   int minDistLvl, int maxLevelsWithoutRedist,
-					   IRefiner* refiner)
+void CollectNumElementsOnLevels(std::vector<size_t>& numElemsOnLvl,
+								TDomain& dom, IRefiner* refiner)
 {
 	const DomainInfo& domInf = dom.domain_info();
-	std::vector<size_t> numElemsOnLvl;
+	numElemsOnLvl.clear();
 	numElemsOnLvl.reserve(domInf.num_levels());
 	for(size_t i = 0; i < domInf.num_levels(); ++i)
 		numElemsOnLvl.push_back(domInf.num_elements_on_level(i));
 
-	if(numElemsOnLvl.empty()){
-		return ProcessHierarchy::create();
-	}
+	if(numElemsOnLvl.empty())
+		return;
 
 	if(refiner){
 		std::vector<int>	numMarked;
@@ -95,12 +92,57 @@ CreateProcessHierarchy(TDomain& dom, size_t minNumElemsPerProcPerLvl,
 			}
 		}
 	}
+}
+
+template <class TDomain>
+SPProcessHierarchy
+CreateProcessHierarchy(TDomain& dom, size_t minNumElemsPerProcPerLvl,
+					   size_t maxNumRedistProcs, size_t maxNumProcs,
+					   int minDistLvl, int maxLevelsWithoutRedist,
+					   IRefiner* refiner)
+{
+	std::vector<size_t> numElemsOnLvl;
+	CollectNumElementsOnLevels(numElemsOnLvl, dom, refiner);
+
+	if(numElemsOnLvl.empty()){
+		return ProcessHierarchy::create();
+	}
 
 	return CreateProcessHierarchy(&numElemsOnLvl.front(), numElemsOnLvl.size(),
 								  minNumElemsPerProcPerLvl, maxNumRedistProcs,
 								  maxNumProcs, minDistLvl, maxLevelsWithoutRedist);
 }
 
+///	Creates a process-hierarchy which agglomerates coarse levels onto fewer processes.
+/**	\sa CreateAgglomeratingProcessHierarchy(size_t*, size_t, size_t, size_t, int)*/
+template <class TDomain>
+SPProcessHierarchy
+CreateAgglomeratingProcessHierarchy(TDomain& dom, size_t minNumElemsPerProc,
+									size_t maxNumProcs, int minDistLvl,
+									IRefiner* refiner)
+{
+	std::vector<size_t> numElemsOnLvl;
+	CollectNumElementsOnLevels(numElemsOnLvl, dom, refiner);
+
+	if(numElemsOnLvl.empty()){
+		return ProcessHierarchy::create();
+	}
+
+	return CreateAgglomeratingProcessHierarchy(&numElemsOnLvl.front(),
+											   numElemsOnLvl.size(),
+											   minNumElemsPerProc, maxNumProcs,
+											   minDistLvl);
+}
+
+template <class TDomain>
+SPProcessHierarchy
+CreateAgglomeratingProcessHierarchy(TDomain& dom, size_t minNumElemsPerProc,
+									size_t maxNumProcs, int minDistLvl)
+{
+	return CreateAgglomeratingProcessHierarchy(dom, minNumElemsPerProc,
+											   maxNumProcs, minDistLvl, NULL);
+}
+
 ///	A small wrapper for LoadBalancer which adds comfort methods to balance and distribute domains.
 template <class TDomain>
 class DomainLoadBalancer : public LoadBalancer
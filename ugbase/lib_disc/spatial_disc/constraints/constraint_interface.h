@@ -126,12 +126,16 @@ class IConstraint
 										int type,
 		                                number time = 0.0) {};
 
-	///	sets the constraints in a solution vector
+	///	sets the constraints in a restricted vector
+	/**	Used instead of the matrix-based version by transfer operators which
+	 * don't assemble a restriction matrix (matrix-free transfer).*/
 		virtual void adjust_restriction(vector_type& uCoarse, GridLevel coarseLvl,
 										const vector_type& uFine, GridLevel fineLvl,
 										int type) {};
 
-	///	sets the constraints in a solution vector
+	///	sets the constraints in a prolongated vector
+	/**	Used instead of the matrix-based version by transfer operators which
+	 * don't assemble a prolongation matrix (matrix-free transfer).*/
 		virtual void adjust_prolongation(vector_type& uFine, GridLevel fineLvl,
 										const vector_type& uCoarse, GridLevel coarseLvl,
 										int type) {};
@@ -98,6 +98,13 @@ class SymP1Constraints
 								int type,
 								number time = 0.0);
 
+	///	sets zero values for the constrained dofs of a prolongated vector
+	/**	This is the vector counterpart of the matrix-based adjust_prolongation,
+	 * used when the prolongation is applied without assembled matrix.*/
+		void adjust_prolongation(vector_type& uFine, GridLevel fineLvl,
+		                         const vector_type& uCoarse, GridLevel coarseLvl,
+		                         int type);
+
 		virtual void adjust_correction
 		(	vector_type& u,
 			ConstSmartPtr<DoFDistribution> dd,
@@ -166,6 +173,13 @@ class OneSideP1Constraints
 								int type,
 								number time = 0.0);
 
+	///	sets zero values for the constrained dofs of a prolongated vector
+	/**	This is the vector counterpart of the matrix-based adjust_prolongation,
+	 * used when the prolongation is applied without assembled matrix.*/
+		void adjust_prolongation(vector_type& uFine, GridLevel fineLvl,
+		                         const vector_type& uCoarse, GridLevel coarseLvl,
+		                         int type);
+
 		virtual void adjust_correction
 		(	vector_type& u,
 			ConstSmartPtr<DoFDistribution> dd,
@@ -579,6 +579,54 @@ adjust_prolongation
 }
 
 
+template <typename TDomain, typename TAlgebra>
+void
+SymP1Constraints<TDomain,TAlgebra>::
+adjust_prolongation
+(
+	vector_type& uFine,
+	GridLevel fineLvl,
+	const vector_type& uCoarse,
+	GridLevel coarseLvl,
+	int type
+)
+{
+	if (m_bAssembleLinearProblem) return;
+
+	if (this->m_spAssTuner->single_index_assembling_enabled())
+			UG_THROW("index-wise assemble routine is not "
+					"implemented for SymP1Constraints \n");
+
+	ConstSmartPtr<DoFDistribution> ddFine =
+			this->approximation_space()->dof_distribution(fineLvl);
+
+//	storage for indices and vertices
+	std::vector<std::vector<size_t> > vConstrainingInd;
+	std::vector<size_t>  constrainedInd;
+	std::vector<Vertex*> vConstrainingVrt;
+
+//	get begin end of hanging vertices
+	DoFDistribution::traits<ConstrainedVertex>::const_iterator iter, iterEnd;
+	iter = ddFine->begin<ConstrainedVertex>();
+	iterEnd = ddFine->end<ConstrainedVertex>();
+
+//	loop constrained vertices
+	for(; iter != iterEnd; ++iter)
+	{
+	//	get hanging vert
+		ConstrainedVertex* hgVrt = *iter;
+
+	// get algebra indices for constrained and constraining vertices
+		get_algebra_indices(ddFine, hgVrt, vConstrainingVrt, constrainedInd, vConstrainingInd);
+
+	//	set zero value (as the zero row in the prolongation matrix)
+		size_t sz = constrainedInd.size();
+		for (size_t i = 0; i < sz; ++i)
+			uFine[constrainedInd[i]] = 0.0;
+	}
+}
+
+
 template <typename TDomain, typename TAlgebra>
 void
 SymP1Constraints<TDomain,TAlgebra>::
@@ -1018,6 +1066,54 @@ adjust_prolongation
 }
 
 
+template <typename TDomain, typename TAlgebra>
+void
+OneSideP1Constraints<TDomain,TAlgebra>::
+adjust_prolongation
+(
+	vector_type& uFine,
+	GridLevel fineLvl,
+	const vector_type& uCoarse,
+	GridLevel coarseLvl,
+	int type
+)
+{
+	if (m_bAssembleLinearProblem) return;
+
+	if (this->m_spAssTuner->single_index_assembling_enabled())
+			UG_THROW("index-wise assemble routine is not "
+					"implemented for OneSideP1Constraints \n");
+
+	ConstSmartPtr<DoFDistribution> ddFine =
+			this->approximation_space()->dof_distribution(fineLvl);
+
+//	storage for indices and vertices
+	std::vector<std::vector<size_t> > vConstrainingInd;
+	std::vector<size_t>  constrainedInd;
+	std::vector<Vertex*> vConstrainingVrt;
+
+//	get begin end of hanging vertices
+	DoFDistribution::traits<ConstrainedVertex>::const_iterator iter, iterEnd;
+	iter = ddFine->begin<ConstrainedVertex>();
+	iterEnd = ddFine->end<ConstrainedVertex>();
+
+//	loop constrained vertices
+	for(; iter != iterEnd; ++iter)
+	{
+	//	get hanging vert
+		ConstrainedVertex* hgVrt = *iter;
+
+	// get algebra indices for constrained and constraining vertices
+		get_algebra_indices(ddFine, hgVrt, vConstrainingVrt, constrainedInd, vConstrainingInd);
+
+	//	set zero value (as the zero row in the prolongation matrix)
+		size_t sz = constrainedInd.size();
+		for (size_t i = 0; i < sz; ++i)
+			uFine[constrainedInd[i]] = 0.0;
+	}
+}
+
+
 template <typename TDomain, typename TAlgebra>
 void
 OneSideP1Constraints<TDomain,TAlgebra>::
@@ -193,6 +193,16 @@ class DirichletBoundary
 										int type,
 										number time = 0.0);
 
+	///	sets constraints in a prolongated vector (as adjust_prolongation does for the matrix)
+		virtual void adjust_prolongation(vector_type& uFine, GridLevel fineLvl,
+										 const vector_type& uCoarse, GridLevel coarseLvl,
+										 int type);
+
+	///	sets constraints in a restricted vector (as adjust_restriction does for the matrix)
+		virtual void adjust_restriction(vector_type& uCoarse, GridLevel coarseLvl,
+										const vector_type& uFine, GridLevel fineLvl,
+										int type);
+
 	///	returns the type of the constraints
 		virtual int type() const {return CT_DIRICHLET;}
 
@@ -298,6 +308,38 @@ class DirichletBoundary
 							   ConstSmartPtr<DoFDistribution> ddFine,
 							   number time);
 
+		template <typename TUserData>
+		void adjust_prolongation(const std::map<int, std::vector<TUserData*> >& mvUserData,
+		                         vector_type& uFine,
+		                         ConstSmartPtr<DoFDistribution> ddFine,
+		                         const vector_type& uCoarse,
+		                         ConstSmartPtr<DoFDistribution> ddCoarse,
+		                         number time);
+
+		template <typename TBaseElem, typename TUserData>
+		void adjust_prolongation(const std::vector<TUserData*>& vUserData, int si,
+		                         vector_type& uFine,
+		                         ConstSmartPtr<DoFDistribution> ddFine,
+		                         const vector_type& uCoarse,
+		                         ConstSmartPtr<DoFDistribution> ddCoarse,
+		                         number time);
+
+		template <typename TUserData>
+		void adjust_restriction(const std::map<int, std::vector<TUserData*> >& mvUserData,
+		                        vector_type& uCoarse,
+		                        ConstSmartPtr<DoFDistribution> ddCoarse,
+		                        const vector_type& uFine,
+		                        ConstSmartPtr<DoFDistribution> ddFine,
+		                        number time);
+
+		template <typename TBaseElem, typename TUserData>
+		void adjust_restriction(const std::vector<TUserData*>& vUserData, int si,
+		                        vector_type& uCoarse,
+		                        ConstSmartPtr<DoFDistribution> ddCoarse,
+		                        const vector_type& uFine,
+		                        ConstSmartPtr<DoFDistribution> ddFine,
+		                        number time);
+
 	protected:
 	///	grouping for subset and non-conditional data
 		struct NumberData
@@ -694,6 +694,255 @@ adjust_restriction(const std::vector<TUserData*>& vUserData, int si,
 	}
 }
 
+template <typename TDomain, typename TAlgebra>
+void DirichletBoundary<TDomain, TAlgebra>::
+adjust_prolongation(vector_type& uFine, GridLevel fineLvl,
+                    const vector_type& uCoarse, GridLevel coarseLvl,
+                    int type)
+{
+	extract_data();
+
+	ConstSmartPtr<DoFDistribution> ddFine = m_spApproxSpace->dof_distribution(fineLvl);
+	ConstSmartPtr<DoFDistribution> ddCoarse = m_spApproxSpace->dof_distribution(coarseLvl);
+
+	adjust_prolongation<CondNumberData>(m_mBNDNumberBndSegment, uFine, ddFine, uCoarse, ddCoarse, 0.0);
+	adjust_prolongation<NumberData>(m_mNumberBndSegment, uFine, ddFine, uCoarse, ddCoarse, 0.0);
+	adjust_prolongation<ConstNumberData>(m_mConstNumberBndSegment, uFine, ddFine, uCoarse, ddCoarse, 0.0);
+
+	adjust_prolongation<VectorData>(m_mVectorBndSegment, uFine, ddFine, uCoarse, ddCoarse, 0.0);
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TUserData>
+void DirichletBoundary<TDomain, TAlgebra>::
+adjust_prolongation(const std::map<int, std::vector<TUserData*> >& mvUserData,
+                    vector_type& uFine,
+                    ConstSmartPtr<DoFDistribution> ddFine,
+                    const vector_type& uCoarse,
+                    ConstSmartPtr<DoFDistribution> ddCoarse,
+                    number time)
+{
+//	loop boundary subsets
+	typename std::map<int, std::vector<TUserData*> >::const_iterator iter;
+	for(iter = mvUserData.begin(); iter != mvUserData.end(); ++iter)
+	{
+	//	get subset index
+		const int si = (*iter).first;
+
+	//	get vector of scheduled dirichlet data on this subset
+		const std::vector<TUserData*>& vUserData = (*iter).second;
+
+	//	adapt prolongated vector for dofs in each base element type
+		try
+		{
+		if(ddFine->max_dofs(VERTEX)) adjust_prolongation<RegularVertex, TUserData>(vUserData, si, uFine, ddFine, uCoarse, ddCoarse, time);
+		if(ddFine->max_dofs(EDGE))   adjust_prolongation<Edge, TUserData>(vUserData, si, uFine, ddFine, uCoarse, ddCoarse, time);
+		if(ddFine->max_dofs(FACE))   adjust_prolongation<Face, TUserData>(vUserData, si, uFine, ddFine, uCoarse, ddCoarse, time);
+		if(ddFine->max_dofs(VOLUME)) adjust_prolongation<Volume, TUserData>(vUserData, si, uFine, ddFine, uCoarse, ddCoarse, time);
+		}
+		UG_CATCH_THROW("DirichletBoundary::adjust_prolongation:"
+						" While calling 'adjust_prolongation' for TUserData, aborting.");
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TBaseElem, typename TUserData>
+void DirichletBoundary<TDomain, TAlgebra>::
+adjust_prolongation(const std::vector<TUserData*>& vUserData, int si,
+                    vector_type& uFine,
+                    ConstSmartPtr<DoFDistribution> ddFine,
+                    const vector_type& uCoarse,
+                    ConstSmartPtr<DoFDistribution> ddCoarse,
+                    number time)
+{
+//	create Multiindex
+	std::vector<DoFIndex> vFineDoF, vCoarseDoF;
+
+//	dummy for readin
+	typename TUserData::value_type val;
+
+//	position of dofs
+	std::vector<position_type> vPos;
+
+//	iterators
+	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
+	iter = ddFine->begin<TBaseElem>(si);
+	iterEnd = ddFine->end<TBaseElem>(si);
+
+//	loop elements
+	for( ; iter != iterEnd; iter++)
+	{
+	//	get vertex
+		TBaseElem* elem = *iter;
+		GridObject* parent = m_spDomain->grid()->get_parent(elem);
+		if(!parent) continue;
+		if(!ddCoarse->is_contained(parent)) continue;
+
+	//	loop dirichlet functions on this segment
+		for(size_t i = 0; i < vUserData.size(); ++i)
+		{
+			for(size_t f = 0; f < TUserData::numFct; ++f)
+			{
+			//	get function index
+				const size_t fct = vUserData[i]->fct[f];
+
+			//	get local finite element id
+				const LFEID& lfeID = ddFine->local_finite_element_id(fct);
+
+			//	get multi indices
+				ddFine->inner_dof_indices(elem, fct, vFineDoF);
+				ddCoarse->inner_dof_indices(parent, fct, vCoarseDoF);
+
+			//	get dof position
+				if(TUserData::isConditional){
+					InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
+					UG_ASSERT(vFineDoF.size() == vPos.size(), "Size mismatch");
+				}
+
+			//	loop dofs on element
+				for(size_t j = 0; j < vFineDoF.size(); ++j)
+				{
+				// 	check if function is dirichlet
+					if(TUserData::isConditional){
+						if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
+					}
+
+				//	the first dof is coupled to the inner dofs of the parent
+					number& uF = DoFRef(uFine, vFineDoF[j]);
+					uF = 0.0;
+					if(j == 0)
+						for(size_t k = 0; k < vCoarseDoF.size(); ++k)
+							uF += DoFRef(uCoarse, vCoarseDoF[k]);
+				}
+			}
+		}
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+void DirichletBoundary<TDomain, TAlgebra>::
+adjust_restriction(vector_type& uCoarse, GridLevel coarseLvl,
+                   const vector_type& uFine, GridLevel fineLvl,
+                   int type)
+{
+	extract_data();
+
+	ConstSmartPtr<DoFDistribution> ddCoarse = m_spApproxSpace->dof_distribution(coarseLvl);
+	ConstSmartPtr<DoFDistribution> ddFine = m_spApproxSpace->dof_distribution(fineLvl);
+
+	adjust_restriction<CondNumberData>(m_mBNDNumberBndSegment, uCoarse, ddCoarse, uFine, ddFine, 0.0);
+	adjust_restriction<NumberData>(m_mNumberBndSegment, uCoarse, ddCoarse, uFine, ddFine, 0.0);
+	adjust_restriction<ConstNumberData>(m_mConstNumberBndSegment, uCoarse, ddCoarse, uFine, ddFine, 0.0);
+
+	adjust_restriction<VectorData>(m_mVectorBndSegment, uCoarse, ddCoarse, uFine, ddFine, 0.0);
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TUserData>
+void DirichletBoundary<TDomain, TAlgebra>::
+adjust_restriction(const std::map<int, std::vector<TUserData*> >& mvUserData,
+                   vector_type& uCoarse,
+                   ConstSmartPtr<DoFDistribution> ddCoarse,
+                   const vector_type& uFine,
+                   ConstSmartPtr<DoFDistribution> ddFine,
+                   number time)
+{
+//	loop boundary subsets
+	typename std::map<int, std::vector<TUserData*> >::const_iterator iter;
+	for(iter = mvUserData.begin(); iter != mvUserData.end(); ++iter)
+	{
+	//	get subset index
+		const int si = (*iter).first;
+
+	//	get vector of scheduled dirichlet data on this subset
+		const std::vector<TUserData*>& vUserData = (*iter).second;
+
+	//	adapt restricted vector for dofs in each base element type
+		try
+		{
+		if(ddFine->max_dofs(VERTEX)) adjust_restriction<RegularVertex, TUserData>(vUserData, si, uCoarse, ddCoarse, uFine, ddFine, time);
+		if(ddFine->max_dofs(EDGE))   adjust_restriction<Edge, TUserData>(vUserData, si, uCoarse, ddCoarse, uFine, ddFine, time);
+		if(ddFine->max_dofs(FACE))   adjust_restriction<Face, TUserData>(vUserData, si, uCoarse, ddCoarse, uFine, ddFine, time);
+		if(ddFine->max_dofs(VOLUME)) adjust_restriction<Volume, TUserData>(vUserData, si, uCoarse, ddCoarse, uFine, ddFine, time);
+		}
+		UG_CATCH_THROW("DirichletBoundary::adjust_restriction:"
+						" While calling 'adjust_restriction' for TUserData, aborting.");
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TBaseElem, typename TUserData>
+void DirichletBoundary<TDomain, TAlgebra>::
+adjust_restriction(const std::vector<TUserData*>& vUserData, int si,
+                   vector_type& uCoarse,
+                   ConstSmartPtr<DoFDistribution> ddCoarse,
+                   const vector_type& uFine,
+                   ConstSmartPtr<DoFDistribution> ddFine,
+                   number time)
+{
+//	create Multiindex
+	std::vector<DoFIndex> vFineDoF, vCoarseDoF;
+
+//	dummy for readin
+	typename TUserData::value_type val;
+
+//	position of dofs
+	std::vector<position_type> vPos;
+
+//	iterators
+	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
+	iter = ddFine->begin<TBaseElem>(si);
+	iterEnd = ddFine->end<TBaseElem>(si);
+
+//	loop elements
+	for( ; iter != iterEnd; iter++)
+	{
+	//	get vertex
+		TBaseElem* elem = *iter;
+		GridObject* parent = m_spDomain->grid()->get_parent(elem);
+		if(!parent) continue;
+		if(!ddCoarse->is_contained(parent)) continue;
+
+	//	loop dirichlet functions on this segment
+		for(size_t i = 0; i < vUserData.size(); ++i)
+		{
+			for(size_t f = 0; f < TUserData::numFct; ++f)
+			{
+			//	get function index
+				const size_t fct = vUserData[i]->fct[f];
+
+			//	get local finite element id
+				const LFEID& lfeID = ddFine->local_finite_element_id(fct);
+
+			//	get multi indices
+				ddFine->inner_dof_indices(elem, fct, vFineDoF);
+				ddCoarse->inner_dof_indices(parent, fct, vCoarseDoF);
+
+			//	get dof position
+				if(TUserData::isConditional){
+					InnerDoFPosition<TDomain>(vPos, parent, *m_spDomain, lfeID);
+					UG_ASSERT(vCoarseDoF.size() == vPos.size(), "Size mismatch");
+				}
+
+			//	loop dofs on element
+				for(size_t j = 0; j < vCoarseDoF.size(); ++j)
+				{
+				// 	check if function is dirichlet
+					if(TUserData::isConditional){
+						if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
+					}
+
+				//	the coarse dof is coupled to the first inner dof of the child
+					if(vFineDoF.size() > 0)
+						DoFRef(uCoarse, vCoarseDoF[j]) = DoFRef(uFine, vFineDoF[0]);
+					else
+						DoFRef(uCoarse, vCoarseDoF[j]) = 0.0;
+				}
+			}
+		}
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //	adjust JACOBIAN
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_TIME_INTEGRATOR__
+#define __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_TIME_INTEGRATOR__
+
+#include <string>
+
+#include "common/common.h"
+#include "lib_algebra/operator/interface/operator_inverse.h"
+#include "lib_disc/time_disc/time_disc_interface.h"
+#include "lib_disc/time_disc/solution_time_series.h"
+#include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
+
+namespace ug{
+
+/// \ingroup lib_disc_time_assemble
+/// @{
+
+///	time integration with adaptive step size control
+/**
+ * This class integrates a time dependent problem, discretized by an
+ * ITimeDiscretization (e.g. ThetaTimeStep, BDF, SDIRK), up to a given end
+ * time, choosing the step sizes automatically.
+ *
+ * The local error of a step of size dt is estimated by extrapolation (step
+ * doubling): the step is computed once with dt and once with two steps of
+ * size dt/2. For a scheme of order p, the error of the finer solution is
+ * estimated by
+ *
+ * 		e = (u_{dt/2} - u_{dt}) / (2^p - 1),
+ *
+ * and measured in the weighted rms norm
+ *
+ * 		E = sqrt( 1/N * sum_i (e_i / (absTol + relTol * |u_i|))^2 ),
+ *
+ * where u = u_{dt/2} and N is the (global) number of unknowns. A
+ * step is accepted if E <= 1. The next step size is chosen by a PI controller,
+ *
+ * 		dt_new = dt * safety * E^{-(kI+kP)/(p+1)} * E_old^{kP/(p+1)},
+ *
+ * restricted by the minimal and maximal factor and step size. After a
+ * rejected step or a failure of the nonlinear solver, the step is repeated
+ * from the stored time series with a smaller step size (rollback).
+ *
+ * Multi-stage schemes are handled by computing all stages of a step, each
+ * stage solution being pushed to the time series. Multi-step schemes (BDF)
+ * use the passed time series as history, that must contain enough previous
+ * solutions for the chosen order.
+ *
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TAlgebra>
+class AdaptiveTimeIntegrator
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Time series type
+		typedef VectorTimeSeries<vector_type> time_series_type;
+
+	public:
+	///	constructor
+	/**
+	 * \param[in]	spTimeDisc		time discretization
+	 * \param[in]	spSolver		nonlinear solver (e.g. NewtonSolver)
+	 */
+		AdaptiveTimeIntegrator(SmartPtr<ITimeDiscretization<TAlgebra> > spTimeDisc,
+		                       SmartPtr<IOperatorInverse<vector_type> > spSolver);
+
+	///	sets the grid level used for assembling
+		void set_level(const GridLevel& gl) {m_gridLevel = gl;}
+
+	///	sets the order of the time discretization (used for the error estimate)
+		void set_order(int order) {m_order = order;}
+
+	///	sets the absolute and relative tolerance of the local error
+		void set_tolerance(number absTol, number relTol) {m_absTol = absTol; m_relTol = relTol;}
+
+	///	sets the (initial) time step size
+		void set_time_step(number dt) {m_dt = dt;}
+
+	///	returns the time step size proposed for the next step
+		number time_step() const {return m_dt;}
+
+	///	sets the minimal and maximal time step size
+		void set_time_step_bounds(number minDt, number maxDt) {m_minDt = minDt; m_maxDt = maxDt;}
+
+	///	sets the safety factor of the step size control
+		void set_safety_factor(number safety) {m_safety = safety;}
+
+	///	sets the minimal and maximal factor the step size is changed by
+		void set_factor_bounds(number minFac, number maxFac) {m_minFac = minFac; m_maxFac = maxFac;}
+
+	///	sets the integral and proportional gain of the PI controller (kP = 0: I controller)
+		void set_pi_gains(number kI, number kP) {m_kI = kI; m_kP = kP;}
+
+	///	sets the step size reduction factor used if the nonlinear solver fails
+		void set_reduction_factor(number red) {m_reductionFactor = red;}
+
+	///	enables the use of the extrapolated solution as new solution
+		void set_extrapolation(bool bExtrapolate) {m_bExtrapolate = bExtrapolate;}
+
+	///	enables calling finish_step_elem of the time discretization after accepted steps
+		void set_finish_time_step(bool bFinish) {m_bFinishTimeStep = bFinish;}
+
+	///	integrates from the latest solution of the time series up to the end time
+	/**
+	 * The latest solution of the time series is the start value at the start
+	 * time. On exit, the time series contains the accepted solutions and u
+	 * the solution at the end time. The proposed step size is kept for
+	 * subsequent calls.
+	 *
+	 * \param[in,out]	spSolTimeSeries		time series of previous solutions
+	 * \param[out]		u					solution at end time
+	 * \param[in]		endTime				end time
+	 * \returns			bool				success flag
+	 */
+		bool apply(SmartPtr<time_series_type> spSolTimeSeries, vector_type& u, number endTime);
+
+	///	statistics
+	/// \{
+		int num_accepted_steps() const {return m_numAccepted;}
+		int num_rejected_steps() const {return m_numRejected;}
+		number last_error_estimate() const {return m_lastError;}
+	/// \}
+
+	///	returns information about configuration parameters
+		std::string config_string() const;
+
+	protected:
+	///	computes one time step (all stages) starting from the latest solution of the series
+		bool do_step(SmartPtr<time_series_type> spSolTimeSeries, vector_type& u, number dt);
+
+	///	returns the weighted rms norm of e (scales e in place)
+		number weighted_rms_norm(vector_type& e, const vector_type& u, number numDoFs) const;
+
+	///	returns the new step size for a scaled error E
+		number new_step_size(number dt, number E, bool bAfterReject) const;
+
+	protected:
+	///	time discretization and nonlinear solver
+		SmartPtr<ITimeDiscretization<TAlgebra> > m_spTimeDisc;
+		SmartPtr<IOperatorInverse<vector_type> > m_spSolver;
+
+	///	grid level used for assembling
+		GridLevel m_gridLevel;
+
+	///	order of the scheme
+		int m_order;
+
+	///	tolerances
+		number m_absTol, m_relTol;
+
+	///	step size and bounds
+		number m_dt, m_minDt, m_maxDt;
+
+	///	controller parameters
+		number m_safety, m_minFac, m_maxFac, m_kI, m_kP, m_reductionFactor;
+
+	///	flags
+		bool m_bExtrapolate, m_bFinishTimeStep;
+
+	///	scaled error of the last accepted step (for the PI controller)
+		number m_lastAcceptedE;
+
+	///	statistics
+		int m_numAccepted, m_numRejected;
+		number m_lastError;
+};
+
+/// @}
+
+} // end namespace ug
+
+#include "adaptive_time_integrator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_TIME_INTEGRATOR__ */
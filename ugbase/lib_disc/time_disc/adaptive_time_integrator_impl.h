@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_TIME_INTEGRATOR_IMPL__
+#define __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_TIME_INTEGRATOR_IMPL__
+
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "adaptive_time_integrator.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+template <typename TAlgebra>
+AdaptiveTimeIntegrator<TAlgebra>::
+AdaptiveTimeIntegrator(SmartPtr<ITimeDiscretization<TAlgebra> > spTimeDisc,
+                       SmartPtr<IOperatorInverse<vector_type> > spSolver)
+	: m_spTimeDisc(spTimeDisc), m_spSolver(spSolver), m_gridLevel(),
+	  m_order(1), m_absTol(1e-6), m_relTol(1e-6),
+	  m_dt(1e-3), m_minDt(1e-10), m_maxDt(1e10),
+	  m_safety(0.9), m_minFac(0.2), m_maxFac(2.0), m_kI(0.3), m_kP(0.4),
+	  m_reductionFactor(0.5), m_bExtrapolate(false), m_bFinishTimeStep(false),
+	  m_lastAcceptedE(1.0), m_numAccepted(0), m_numRejected(0), m_lastError(0.0)
+{
+	if(m_spTimeDisc.invalid())
+		UG_THROW("AdaptiveTimeIntegrator: Time discretization not set.");
+	if(m_spSolver.invalid())
+		UG_THROW("AdaptiveTimeIntegrator: Nonlinear solver not set.");
+}
+
+template <typename TAlgebra>
+bool AdaptiveTimeIntegrator<TAlgebra>::
+do_step(SmartPtr<time_series_type> spSolTimeSeries, vector_type& u, number dt)
+{
+	for(size_t stage = 1; stage <= m_spTimeDisc->num_stages(); ++stage)
+	{
+	//	setup time disc for old solutions and time step size
+		m_spTimeDisc->set_stage(stage);
+		m_spTimeDisc->prepare_step(spSolTimeSeries, dt);
+
+	//	solve nonlinear problem
+		try{
+			if(!m_spSolver->prepare(u)) return false;
+			if(!m_spSolver->apply(u)) return false;
+		}
+		catch(UGError& err){
+			UG_LOG("AdaptiveTimeIntegrator: Nonlinear solver failed: "
+					<< err.get_msg() << "\n");
+			return false;
+		}
+
+	//	push solution of the stage (the oldest solution is only kept, if the
+	//	time disc needs more previous solutions than present)
+		const number time = m_spTimeDisc->future_time();
+		if(spSolTimeSeries->size() < m_spTimeDisc->num_prev_steps())
+			spSolTimeSeries->push(u.clone(), time);
+		else
+			spSolTimeSeries->push_discard_oldest(u.clone(), time);
+	}
+	return true;
+}
+
+template <typename TAlgebra>
+number AdaptiveTimeIntegrator<TAlgebra>::
+new_step_size(number dt, number E, bool bAfterReject) const
+{
+	const number k = m_order + 1;
+	E = std::max(E, (number)1e-10);
+
+//	PI controller, plain I controller after a rejected step
+	number fac;
+	if(bAfterReject)
+		fac = m_safety * std::pow(E, -1.0/k);
+	else
+		fac = m_safety * std::pow(E, -(m_kI + m_kP)/k)
+					   * std::pow(m_lastAcceptedE, m_kP/k);
+
+	fac = std::min(m_maxFac, std::max(m_minFac, fac));
+
+//	do not increase the step size directly after a rejection
+	if(bAfterReject) fac = std::min(fac, (number)1.0);
+
+	return std::min(m_maxDt, fac * dt);
+}
+
+template <typename TAlgebra>
+bool AdaptiveTimeIntegrator<TAlgebra>::
+apply(SmartPtr<time_series_type> spSolTimeSeries, vector_type& u, number endTime)
+{
+	PROFILE_BEGIN_GROUP(AdaptiveTimeIntegrator_apply, "discretization");
+
+	if(spSolTimeSeries.invalid() || spSolTimeSeries->size() == 0)
+		UG_THROW("AdaptiveTimeIntegrator::apply: Time series must contain "
+				"the start value.");
+	if(m_order < 1)
+		UG_THROW("AdaptiveTimeIntegrator::apply: Order must be positive.");
+
+//	init nonlinear solver with the time discretization
+	m_spSolver->init(make_sp(new AssembledOperator<TAlgebra>(m_spTimeDisc, m_gridLevel)));
+
+//	error amplification of the step doubling
+	const number errScale = 1.0 / (std::pow(2.0, (number)m_order) - 1.0);
+
+//	help vectors
+	SmartPtr<vector_type> spUFull = spSolTimeSeries->latest()->clone();
+	SmartPtr<vector_type> spUHalf = spSolTimeSeries->latest()->clone();
+	SmartPtr<vector_type> spTmp = spSolTimeSeries->latest()->clone_without_values();
+
+//	global number of unknowns (the norm of a vector of ones counts each
+//	unknown once, also in parallel)
+	spTmp->set(1.0);
+	const number numDoFs = std::max(spTmp->norm() * spTmp->norm(), (number)1.0);
+
+	number time = spSolTimeSeries->time(0);
+	const number relPrecisionBound = 1e-12;
+	bool bAfterReject = false;
+
+	while((endTime - time) > relPrecisionBound * std::max(m_dt, std::fabs(endTime)))
+	{
+	//	do not step beyond end time
+		number dt = std::min(m_dt, endTime - time);
+		const bool bLastStep = (dt == endTime - time);
+
+		UG_LOG("++++++ Adaptive time step: t = " << time << ", dt = " << dt << "\n");
+
+	//	full step, started from copy of time series (for rollback)
+		SmartPtr<time_series_type> spFull = spSolTimeSeries->clone();
+		*spUFull = *spSolTimeSeries->latest();
+		bool bSuccess = do_step(spFull, *spUFull, dt);
+
+	//	two half steps
+		SmartPtr<time_series_type> spHalf;
+		if(bSuccess){
+			spHalf = spSolTimeSeries->clone();
+			*spUHalf = *spSolTimeSeries->latest();
+			bSuccess = do_step(spHalf, *spUHalf, 0.5*dt)
+						&& do_step(spHalf, *spUHalf, 0.5*dt);
+		}
+
+	//	nonlinear solver failed: reduce step size
+		if(!bSuccess)
+		{
+			m_numRejected++;
+			m_dt = m_reductionFactor * dt;
+			bAfterReject = true;
+			UG_LOG("++++++ Nonlinear solver failed. Trying decreased step size "
+					<< m_dt << ".\n");
+			if(m_dt < m_minDt){
+				UG_LOG("ERROR in 'AdaptiveTimeIntegrator::apply': Time step size "
+						<< m_dt << " below minimal step size " << m_minDt << ".\n");
+				return false;
+			}
+			continue;
+		}
+
+	//	error estimate e = (u_half - u_full) / (2^p - 1), measured in the
+	//	weighted rms norm (scaled in place, since the vector is a copy)
+#ifdef UG_PARALLEL
+		spUFull->change_storage_type(PST_CONSISTENT);
+		spUHalf->change_storage_type(PST_CONSISTENT);
+#endif
+		VecScaleAdd(*spTmp, errScale, *spUHalf, -errScale, *spUFull);
+		const number E = weighted_rms_norm(*spTmp, *spUHalf, numDoFs);
+		m_lastError = E;
+
+		const number dtNew = new_step_size(dt, E, bAfterReject);
+
+	//	reject: repeat step from stored time series
+		if(E > 1.0)
+		{
+			m_numRejected++;
+			UG_LOG("++++++ Rejecting step: scaled error estimate " << E
+					<< ", new dt = " << dtNew << ".\n");
+			m_dt = dtNew;
+			bAfterReject = true;
+			if(m_dt < m_minDt){
+				UG_LOG("ERROR in 'AdaptiveTimeIntegrator::apply': Time step size "
+						<< m_dt << " below minimal step size " << m_minDt << ".\n");
+				return false;
+			}
+			continue;
+		}
+
+	//	accept: use finer (or extrapolated) solution
+		m_numAccepted++;
+		if(m_bExtrapolate)
+			VecScaleAdd(*spHalf->latest(), 1.0 + errScale, *spUHalf, -errScale, *spUFull);
+
+		spSolTimeSeries->clear();
+		for(int i = spHalf->size()-1; i >= 0; --i)
+			spSolTimeSeries->push(spHalf->solution(i), spHalf->time(i));
+		time = spSolTimeSeries->time(0);
+
+		UG_LOG("++++++ Accepting step: scaled error estimate " << E
+				<< ", new dt = " << dtNew << ".\n");
+
+		if(m_bFinishTimeStep)
+			m_spTimeDisc->finish_step_elem(spSolTimeSeries, m_gridLevel);
+
+	//	keep the proposed step size, if the last step was shortened to the end time
+		if(!bLastStep || dtNew < m_dt) m_dt = dtNew;
+		m_lastAcceptedE = std::max(E, (number)1e-10);
+		bAfterReject = false;
+	}
+
+//	copy solution
+	u = *spSolTimeSeries->latest();
+	return true;
+}
+
+template <typename TAlgebra>
+number AdaptiveTimeIntegrator<TAlgebra>::
+weighted_rms_norm(vector_type& e, const vector_type& u, number numDoFs) const
+{
+//	scale each entry by its tolerance (e and u have to be consistent)
+	for(size_t i = 0; i < e.size(); ++i)
+		for(size_t j = 0; j < GetSize(e[i]); ++j)
+			BlockRef(e[i], j) /= m_absTol + m_relTol * std::fabs(BlockRef(u[i], j));
+
+	return e.norm() / std::sqrt(numDoFs);
+}
+
+template <typename TAlgebra>
+std::string AdaptiveTimeIntegrator<TAlgebra>::config_string() const
+{
+	std::stringstream ss;
+	ss << "AdaptiveTimeIntegrator (step doubling, PI control)\n";
+	ss << " order = " << m_order << ", absTol = " << m_absTol
+	   << ", relTol = " << m_relTol << "\n";
+	ss << " dt = " << m_dt << ", min dt = " << m_minDt << ", max dt = " << m_maxDt << "\n";
+	ss << " safety = " << m_safety << ", factor bounds = [" << m_minFac
+	   << ", " << m_maxFac << "], kI = " << m_kI << ", kP = " << m_kP << "\n";
+	ss << " extrapolation: " << (m_bExtrapolate ? "yes" : "no") << "\n";
+	return ss.str();
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_TIME_INTEGRATOR_IMPL__ */
@@ -96,6 +96,14 @@ class MultiStepTimeDiscretization
 
 		virtual number future_time() const {return m_futureTime;}
 
+	///	\copydoc ITimeDiscretization::jacobian_stiffness_scaling()
+		virtual bool jacobian_stiffness_scaling(number& scaleOut) const
+		{
+			if(m_vScaleStiff.empty()) return false;
+			scaleOut = m_vScaleStiff[0];
+			return true;
+		}
+
 	public:
 		void assemble_jacobian(matrix_type& J, const vector_type& u, const GridLevel& gl);
 
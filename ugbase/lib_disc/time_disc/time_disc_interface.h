@@ -153,6 +153,13 @@ class ITimeDiscretization : public IAssemble<TAlgebra>
 	///	sets the stage
 		virtual void set_stage(size_t stage) = 0;
 
+	///	returns the scaling of the stiffness part in the Jacobian of the current step
+	/**	The Jacobian of a step is the mass part plus this factor times the
+	 * stiffness part. The factor depends e.g. on the time step size and the
+	 * stage, so a Jacobian can only be reused for steps with the same factor.
+	 * \return false if the scaling is not known*/
+		virtual bool jacobian_stiffness_scaling(number& scaleOut) const {return false;}
+
 	///	returns the number of constraint
 		virtual size_t num_constraints() const
 		{
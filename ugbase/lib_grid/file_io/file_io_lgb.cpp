@@ -62,7 +62,7 @@ bool SaveGridToLGB(Grid& grid, const char* filename,
 	byte endianess = 1;
 	byte intSize = (byte)sizeof(int);
 	byte numberSize = (byte)sizeof(number);
-	int versionNumber = 4;
+	int versionNumber = 5;
 	
 	tbuf.write((char*)&endianess, sizeof(byte));
 	tbuf.write((char*)&intSize, sizeof(byte));
@@ -87,8 +87,16 @@ bool SaveGridToLGB(Grid& grid, const char* filename,
 	if(numSHs > 0){
 	//	write the number of subset handlers which shall be serialized
 		tbuf.write((char*)&numSHs, sizeof(int));
-		for(int i = 0; i< numSHs; ++i)
-			SerializeSubsetHandler(grid, *ppSH[i], tbuf);
+
+	//	starting from version 5, the size of each subset handler is written
+	//	in front of it, so that readers can skip unrequested subset handlers.
+		for(int i = 0; i< numSHs; ++i){
+			BinaryBuffer shBuf;
+			SerializeSubsetHandler(grid, *ppSH[i], shBuf);
+			uint64 shSize = shBuf.write_pos();
+			tbuf.write((char*)&shSize, sizeof(uint64));
+			tbuf.write(shBuf.buffer(), shBuf.write_pos());
+		}
 	}
 
 //	write a magic-number that allows us to check during read
@@ -162,9 +170,9 @@ bool LoadGridFromLGB(Grid& grid, const char* filename,
 		LOG("ERROR in LoadGridFromLGB: bad number-size\n");
 		return false;
 	}
-	if((versionNumber < 2) || (versionNumber > 4))
+	if((versionNumber < 2) || (versionNumber > 5))
 	{
-		LOG("ERROR in LoadGridFromLGB: bad file-version: " << versionNumber << ". Expected 2 or 3.\n");
+		LOG("ERROR in LoadGridFromLGB: bad file-version: " << versionNumber << ". Expected 2 to 5.\n");
 		return false;
 	}
 
@@ -196,16 +204,31 @@ bool LoadGridFromLGB(Grid& grid, const char* filename,
 	//	starting from version 4, subset-infos contain a property-map
 		bool readPropertyMap = (versionNumber >= 4);
 
+	//	starting from version 5, each subset handler is preceded by its size
+		bool readSizes = (versionNumber >= 5);
+
 		int i;
 		for(i = 0; i < min(numSrcSHs, numSHs); ++i){
+			if(readSizes){
+				uint64 shSize;
+				tbuf.read((char*)&shSize, sizeof(uint64));
+			}
 			DeserializeSubsetHandler(grid, *ppSH[i], tbuf, readPropertyMap);
 		}
 		
-	//	read the rest
+	//	skip the rest. Older files don't store the sizes, so the remaining
+	//	subset handlers have to be read.
 		for(; i < numSrcSHs; ++i)
 		{
-			SubsetHandler sh(grid);
-			DeserializeSubsetHandler(grid, sh, tbuf, readPropertyMap);
+			if(readSizes){
+				uint64 shSize;
+				tbuf.read((char*)&shSize, sizeof(uint64));
+				tbuf.set_read_pos(tbuf.read_pos() + shSize);
+			}
+			else{
+				SubsetHandler sh(grid);
+				DeserializeSubsetHandler(grid, sh, tbuf, readPropertyMap);
+			}
 		}
 	}
 
@@ -54,7 +54,8 @@ bool SaveGridToLGB(Grid& grid, const char* filename,
  * Awaits a list of subset-handler-pointers and the number
  * of subset-handlers that shall be read.
  * Make sure that all passed subset-handlers are already registered
- * at the grid.
+ * at the grid. Additional subset-handlers stored in the file are skipped
+ * without being deserialized (files of version 5 and later).
  */
 bool LoadGridFromLGB(Grid& grid, const char* filename,
 				   ISubsetHandler** ppSH, int numSHs,
@@ -0,0 +1,986 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include "file_io_ugb.h"
+#include "common/boost_serialization_routines.h"
+#include "common/util/archivar.h"
+#include "common/util/factory.h"
+#include "lib_grid/refinement/projectors/projection_handler.h"
+#include "lib_grid/refinement/projectors/projectors.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_base.h"
+#endif
+
+using namespace std;
+
+namespace ug
+{
+
+static const char	UGB_MAGIC[8] = {'U', 'G', 'B', 'G', 'R', 'I', 'D', '\0'};
+static const uint32	UGB_VERSION = 2;
+static const uint32	UGB_BYTE_ORDER_TAG = 0x01020304;
+static const byte	UGB_NO_PARENT = 255;
+
+///	number of corners of the element types stored for each base object
+static const uint32 UGB_NUM_CORNERS[4][5] = {{1, 0, 0, 0, 0},
+											 {2, 0, 0, 0, 0},
+											 {3, 4, 0, 0, 0},
+											 {4, 5, 6, 8, 6}};
+static const byte UGB_NUM_TYPES[4] = {1, 1, 2, 5};
+
+///	writes zeros, so that numBytes written bytes become a multiple of 8
+static void WritePadding(ostream& out, size_t numBytes)
+{
+	static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	if(numBytes % 8)
+		out.write(zeros, 8 - numBytes % 8);
+}
+
+template <class T>
+static void WriteArray(ostream& out, const T* data, size_t num)
+{
+	if(num > 0)
+		out.write(reinterpret_cast<const char*>(data), num * sizeof(T));
+	WritePadding(out, num * sizeof(T));
+}
+
+template <class T>
+static void WriteVector(ostream& out, const vector<T>& vec)
+{
+	WriteArray(out, vec.empty() ? NULL : &vec.front(), vec.size());
+}
+
+template <class T>
+static void WriteValue(ostream& out, const T& val)
+{
+	WriteArray(out, &val, 1);
+}
+
+static void WriteString(ostream& out, const string& str)
+{
+	WriteValue(out, (uint32)str.size());
+	WriteArray(out, str.c_str(), str.size());
+}
+
+///	writes a padded array whose entries are pushed one by one
+template <class T>
+class ArrayWriter{
+	public:
+		ArrayWriter(ostream& out) : m_out(out), m_numWritten(0)	{m_buf.reserve(BLOCK_SIZE);}
+		~ArrayWriter()	{finish();}
+
+		void push_back(const T& val)
+		{
+			m_buf.push_back(val);
+			if(m_buf.size() == BLOCK_SIZE)
+				flush();
+		}
+
+		void finish()
+		{
+			flush();
+			WritePadding(m_out, m_numWritten * sizeof(T));
+			m_numWritten = 0;
+		}
+
+	private:
+		void flush()
+		{
+			if(m_buf.empty())
+				return;
+			m_out.write(reinterpret_cast<const char*>(&m_buf.front()),
+						m_buf.size() * sizeof(T));
+			m_numWritten += m_buf.size();
+			m_buf.clear();
+		}
+
+		static const size_t BLOCK_SIZE = 16384;
+		ostream&	m_out;
+		vector<T>	m_buf;
+		size_t		m_numWritten;
+};
+
+
+////////////////////////////////////////////////////////////////////////
+//	GridWriterUGB
+GridWriterUGB::GridWriterUGB() :
+	m_pGrid(NULL),
+	m_pMG(NULL)
+#ifdef UG_PARALLEL
+	, m_pLayoutMap(NULL)
+#endif
+{
+}
+
+GridWriterUGB::~GridWriterUGB()
+{
+}
+
+void GridWriterUGB::
+add_subset_handler(ISubsetHandler& sh, const char* name)
+{
+	m_vSH.push_back(make_pair(&sh, string(name)));
+}
+
+void GridWriterUGB::
+add_selector(ISelector& sel, const char* name)
+{
+	m_vSel.push_back(make_pair(&sel, string(name)));
+}
+
+void GridWriterUGB::
+add_projection_handler(ProjectionHandler& ph, const char* name)
+{
+	m_vPH.push_back(make_pair(&ph, string(name)));
+}
+
+#ifdef UG_PARALLEL
+void GridWriterUGB::
+add_layout_map(GridLayoutMap& glm)
+{
+	m_pLayoutMap = &glm;
+}
+#endif
+
+template <class TElem>
+void GridWriterUGB::
+collect(vector<GridObject*>& elems, vector<byte>& types, int level, byte typeId)
+{
+	typedef typename geometry_traits<TElem>::iterator iter_t;
+	iter_t iterBegin, iterEnd;
+	if(level >= 0){
+		iterBegin = m_pMG->begin<TElem>(level);
+		iterEnd = m_pMG->end<TElem>(level);
+	}
+	else{
+		iterBegin = m_pGrid->begin<TElem>();
+		iterEnd = m_pGrid->end<TElem>();
+	}
+
+	for(iter_t iter = iterBegin; iter != iterEnd; ++iter){
+		elems.push_back(*iter);
+		types.push_back(typeId);
+	}
+}
+
+void GridWriterUGB::
+collect_elements()
+{
+	const int numLevels = m_pMG ? max<int>(1, (int)m_pMG->num_levels()) : 1;
+
+	for(int k = 0; k < 4; ++k){
+		m_vElems[k].clear();
+		m_vTypes[k].clear();
+		m_vLevelOffsets[k].assign(1, 0);
+	}
+
+//	the type ids have to match UGB_NUM_CORNERS
+	for(int lvl = 0; lvl < numLevels; ++lvl){
+		const int l = m_pMG ? lvl : -1;
+		collect<RegularVertex>(m_vElems[0], m_vTypes[0], l, 0);
+		collect<RegularEdge>(m_vElems[1], m_vTypes[1], l, 0);
+		collect<Triangle>(m_vElems[2], m_vTypes[2], l, 0);
+		collect<Quadrilateral>(m_vElems[2], m_vTypes[2], l, 1);
+		collect<Tetrahedron>(m_vElems[3], m_vTypes[3], l, 0);
+		collect<Pyramid>(m_vElems[3], m_vTypes[3], l, 1);
+		collect<Prism>(m_vElems[3], m_vTypes[3], l, 2);
+		collect<Hexahedron>(m_vElems[3], m_vTypes[3], l, 3);
+		collect<Octahedron>(m_vElems[3], m_vTypes[3], l, 4);
+
+		for(int k = 0; k < 4; ++k)
+			m_vLevelOffsets[k].push_back(m_vElems[k].size());
+	}
+
+	UG_COND_THROW(m_vElems[0].size() != m_pGrid->num<Vertex>()
+				  || m_vElems[1].size() != m_pGrid->num<Edge>()
+				  || m_vElems[2].size() != m_pGrid->num<Face>()
+				  || m_vElems[3].size() != m_pGrid->num<Volume>(),
+				  "GridWriterUGB: The grid contains constrained or constraining "
+				  "elements, which are not supported by the ugb format.");
+}
+
+void GridWriterUGB::
+write_to_file(const char* filename)
+{
+	UG_COND_THROW(!m_pGrid, "GridWriterUGB::write_to_file: no grid specified.");
+
+	ofstream out(filename, ios::out | ios::binary | ios::trunc);
+	UG_COND_THROW(!out, "GridWriterUGB: Couldn't open file " << filename);
+
+	collect_elements();
+
+//	assign indices to all elements
+	Grid& grid = *m_pGrid;
+	grid.attach_to_all(m_aIndex);
+	Grid::AttachmentAccessor<Vertex, AInt> aaIndVRT(grid, m_aIndex);
+	Grid::AttachmentAccessor<Edge, AInt> aaIndEDGE(grid, m_aIndex);
+	Grid::AttachmentAccessor<Face, AInt> aaIndFACE(grid, m_aIndex);
+	Grid::AttachmentAccessor<Volume, AInt> aaIndVOL(grid, m_aIndex);
+	for(size_t i = 0; i < m_vElems[0].size(); ++i)
+		aaIndVRT[static_cast<Vertex*>(m_vElems[0][i])] = (int)i;
+	for(size_t i = 0; i < m_vElems[1].size(); ++i)
+		aaIndEDGE[static_cast<Edge*>(m_vElems[1][i])] = (int)i;
+	for(size_t i = 0; i < m_vElems[2].size(); ++i)
+		aaIndFACE[static_cast<Face*>(m_vElems[2][i])] = (int)i;
+	for(size_t i = 0; i < m_vElems[3].size(); ++i)
+		aaIndVOL[static_cast<Volume*>(m_vElems[3][i])] = (int)i;
+
+//	header
+	uint64 numElems[4], numCorners[4];
+	for(int k = 0; k < 4; ++k){
+		numElems[k] = m_vElems[k].size();
+		numCorners[k] = 0;
+		if(k > 0){
+			for(size_t i = 0; i < m_vTypes[k].size(); ++i)
+				numCorners[k] += UGB_NUM_CORNERS[k][m_vTypes[k][i]];
+		}
+	}
+
+	uint32 numLayoutMaps = 0;
+	#ifdef UG_PARALLEL
+		if(m_pLayoutMap)
+			numLayoutMaps = 1;
+	#endif
+
+	uint32 info[10] = {UGB_VERSION, UGB_BYTE_ORDER_TAG,
+					   (uint32)m_spPosWriter->dim(),
+					   (uint32)m_vLevelOffsets[0].size() - 1,
+					   (uint32)m_vSH.size(), (uint32)m_vSel.size(),
+					   (uint32)m_vPH.size(), m_pMG ? 1u : 0u,
+					   numLayoutMaps, 0};
+
+	WriteArray(out, UGB_MAGIC, 8);
+	WriteArray(out, info, 10);
+	WriteArray(out, numElems, 4);
+	WriteArray(out, numCorners, 4);
+
+//	the section offsets are written once all sections are written
+	vector<uint64> vOffsets(m_vSH.size() + m_vSel.size() + m_vPH.size()
+							+ numLayoutMaps, 0);
+	const streampos offsetPos = out.tellp();
+	WriteVector(out, vOffsets);
+
+	write_grid_section(out);
+
+	size_t curOffset = 0;
+	for(size_t i = 0; i < m_vSH.size(); ++i){
+		vOffsets[curOffset++] = (uint64)out.tellp();
+		write_subset_handler_section(out, i);
+	}
+	for(size_t i = 0; i < m_vSel.size(); ++i){
+		vOffsets[curOffset++] = (uint64)out.tellp();
+		write_selector_section(out, i);
+	}
+	for(size_t i = 0; i < m_vPH.size(); ++i){
+		vOffsets[curOffset++] = (uint64)out.tellp();
+		write_projection_handler_section(out, i);
+	}
+	#ifdef UG_PARALLEL
+		if(m_pLayoutMap){
+			vOffsets[curOffset++] = (uint64)out.tellp();
+			write_layout_map_section(out);
+		}
+	#endif
+
+	if(!vOffsets.empty()){
+		out.seekp(offsetPos);
+		WriteVector(out, vOffsets);
+	}
+
+	grid.detach_from_all(m_aIndex);
+
+	UG_COND_THROW(!out, "GridWriterUGB: Couldn't write file " << filename);
+}
+
+void GridWriterUGB::
+write_grid_section(ostream& out)
+{
+	Grid& grid = *m_pGrid;
+	Grid::AttachmentAccessor<Vertex, AInt> aaIndVRT(grid, m_aIndex);
+	Grid::AttachmentAccessor<Edge, AInt> aaIndEDGE(grid, m_aIndex);
+	Grid::AttachmentAccessor<Face, AInt> aaIndFACE(grid, m_aIndex);
+	Grid::AttachmentAccessor<Volume, AInt> aaIndVOL(grid, m_aIndex);
+
+	for(int k = 0; k < 4; ++k){
+		const vector<GridObject*>& elems = m_vElems[k];
+
+		WriteVector(out, m_vLevelOffsets[k]);
+		WriteVector(out, m_vTypes[k]);
+
+	//	corners
+		if(k > 0){
+			ArrayWriter<uint32> corners(out);
+			Grid::vertex_traits::secure_container vrts;
+			for(size_t i = 0; i < elems.size(); ++i){
+				grid.associated_elements(vrts, elems[i]);
+				for(size_t j = 0; j < vrts.size(); ++j)
+					corners.push_back((uint32)aaIndVRT[vrts[j]]);
+			}
+		}
+
+	//	parents
+		if(m_pMG){
+			ArrayWriter<byte> parentKinds(out);
+			for(size_t i = 0; i < elems.size(); ++i){
+				GridObject* parent = m_pMG->get_parent(elems[i]);
+				parentKinds.push_back(parent ? (byte)parent->base_object_id()
+											 : UGB_NO_PARENT);
+			}
+			parentKinds.finish();
+
+			ArrayWriter<uint32> parentInds(out);
+			for(size_t i = 0; i < elems.size(); ++i){
+				GridObject* parent = m_pMG->get_parent(elems[i]);
+				int ind = 0;
+				if(parent){
+					switch(parent->base_object_id()){
+						case VERTEX:	ind = aaIndVRT[static_cast<Vertex*>(parent)]; break;
+						case EDGE:		ind = aaIndEDGE[static_cast<Edge*>(parent)]; break;
+						case FACE:		ind = aaIndFACE[static_cast<Face*>(parent)]; break;
+						case VOLUME:	ind = aaIndVOL[static_cast<Volume*>(parent)]; break;
+					}
+				}
+				parentInds.push_back((uint32)ind);
+			}
+		}
+	}
+
+//	positions (numVrts * dim doubles are always a multiple of 8 bytes)
+	m_spPosWriter->write(out, m_vElems[0]);
+}
+
+void GridWriterUGB::
+write_subset_handler_section(ostream& out, size_t shIndex)
+{
+	ISubsetHandler& sh = *m_vSH[shIndex].first;
+	WriteString(out, m_vSH[shIndex].second);
+
+	WriteValue(out, (uint32)sh.num_subsets());
+	for(int i = 0; i < sh.num_subsets(); ++i){
+		const SubsetInfo& si = sh.subset_info(i);
+		WriteString(out, si.name);
+		double color[4] = {si.color.x(), si.color.y(), si.color.z(), si.color.w()};
+		WriteArray(out, color, 4);
+	}
+
+	for(int k = 0; k < 4; ++k){
+		ArrayWriter<int> inds(out);
+		const vector<GridObject*>& elems = m_vElems[k];
+		for(size_t i = 0; i < elems.size(); ++i)
+			inds.push_back(sh.get_subset_index(elems[i]));
+	}
+}
+
+void GridWriterUGB::
+write_selector_section(ostream& out, size_t selIndex)
+{
+	ISelector& sel = *m_vSel[selIndex].first;
+	WriteString(out, m_vSel[selIndex].second);
+
+	for(int k = 0; k < 4; ++k){
+		ArrayWriter<byte> status(out);
+		const vector<GridObject*>& elems = m_vElems[k];
+		for(size_t i = 0; i < elems.size(); ++i)
+			status.push_back(sel.get_selection_status(elems[i]));
+	}
+}
+
+void GridWriterUGB::
+write_projection_handler_section(ostream& out, size_t phIndex)
+{
+	static Factory<RefinementProjector, ProjectorTypes>	projFac;
+	static Archivar<boost::archive::text_oarchive, RefinementProjector, ProjectorTypes>	archivar;
+
+	ProjectionHandler& ph = *m_vPH[phIndex].first;
+	WriteString(out, m_vPH[phIndex].second);
+
+//	find the index of the associated subset handler
+	size_t shIndex = 0;
+	for(; shIndex < m_vSH.size(); ++shIndex)
+		if(m_vSH[shIndex].first == ph.subset_handler())
+			break;
+
+	UG_COND_THROW(shIndex == m_vSH.size(), "GridWriterUGB: No matching "
+				  "SubsetHandler could be found for projection handler '"
+				  << m_vPH[phIndex].second << "'. Please make sure to add the "
+				  "associated SubsetHandler before writing the file.");
+	WriteValue(out, (uint32)shIndex);
+
+//	collect projectors (the first one being the default projector)
+	vector<pair<int, RefinementProjector*> > vProjs;
+	if(ph.default_projector().valid())
+		vProjs.push_back(make_pair(-2, ph.default_projector().get()));
+	for(int i = -1; i < (int)ph.num_projectors(); ++i){
+		if(ph.projector(i).valid())
+			vProjs.push_back(make_pair(i, ph.projector(i).get()));
+	}
+
+	WriteValue(out, (uint32)vProjs.size());
+	for(size_t i = 0; i < vProjs.size(); ++i){
+		RefinementProjector& proj = *vProjs[i].second;
+		stringstream ss;
+		boost::archive::text_oarchive ar(ss, boost::archive::no_header);
+		archivar.archive(ar, proj);
+
+		int info[2] = {vProjs[i].first == -2 ? 1 : 0, vProjs[i].first};
+		WriteArray(out, info, 2);
+		WriteString(out, projFac.class_name(proj));
+		WriteString(out, ss.str());
+	}
+}
+
+
+#ifdef UG_PARALLEL
+template <class TElem>
+void GridWriterUGB::
+write_layouts(ostream& out)
+{
+	typedef typename GridLayoutMap::Types<TElem>::Map		layout_map_t;
+	typedef typename GridLayoutMap::Types<TElem>::Layout	layout_t;
+	typedef typename GridLayoutMap::Types<TElem>::Interface	interface_t;
+
+	Grid::AttachmentAccessor<TElem, AInt> aaInd(*m_pGrid, m_aIndex);
+	const GridLayoutMap& glm = *m_pLayoutMap;
+
+	WriteValue(out, (uint32)distance(glm.layouts_begin<TElem>(),
+									 glm.layouts_end<TElem>()));
+	for(typename layout_map_t::const_iterator lIter = glm.layouts_begin<TElem>();
+		lIter != glm.layouts_end<TElem>(); ++lIter)
+	{
+		const layout_t& layout = lIter->second;
+
+	//	level, target process and size of each interface
+		vector<int> ifcInfos;
+		for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+			for(typename layout_t::const_iterator iter = layout.begin(lvl);
+				iter != layout.end(lvl); ++iter)
+			{
+				ifcInfos.push_back((int)lvl);
+				ifcInfos.push_back(layout.proc_id(iter));
+				ifcInfos.push_back((int)layout.interface(iter).size());
+			}
+		}
+
+		int layoutInfo[2] = {lIter->first, (int)ifcInfos.size() / 3};
+		WriteArray(out, layoutInfo, 2);
+		WriteVector(out, ifcInfos);
+
+	//	the interface elements are written in the order of their interfaces
+		ArrayWriter<uint32> inds(out);
+		for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+			for(typename layout_t::const_iterator iter = layout.begin(lvl);
+				iter != layout.end(lvl); ++iter)
+			{
+				const interface_t& intfc = layout.interface(iter);
+				for(typename interface_t::const_iterator eIter = intfc.begin();
+					eIter != intfc.end(); ++eIter)
+				{
+					inds.push_back((uint32)aaInd[intfc.get_element(eIter)]);
+				}
+			}
+		}
+	}
+}
+
+void GridWriterUGB::
+write_layout_map_section(ostream& out)
+{
+	int procInfo[2] = {pcl::ProcRank(), pcl::NumProcs()};
+	WriteArray(out, procInfo, 2);
+
+	write_layouts<Vertex>(out);
+	write_layouts<Edge>(out);
+	write_layouts<Face>(out);
+	write_layouts<Volume>(out);
+}
+#endif
+
+
+////////////////////////////////////////////////////////////////////////
+//	GridReaderUGB
+std::string GridReaderUGB::Cursor::
+string()
+{
+	const uint32 len = value<uint32>();
+	const char* str = array<char>(len);
+	return std::string(str, len);
+}
+
+GridReaderUGB::GridReaderUGB() :
+	m_posDim(0),
+	m_numLevels(0),
+	m_bHierarchy(false),
+	m_gridOffset(0),
+	m_positionOffset(0),
+	m_layoutMapOffset(0)
+{
+	for(int k = 0; k < 4; ++k){
+		m_numElems[k] = 0;
+		m_numCorners[k] = 0;
+	}
+}
+
+GridReaderUGB::~GridReaderUGB()
+{
+}
+
+GridReaderUGB::Cursor GridReaderUGB::
+cursor(size_t pos) const
+{
+	return Cursor(m_file.data(), m_file.size(), pos);
+}
+
+void GridReaderUGB::
+open(const char* filename)
+{
+	m_file.open(filename);
+
+	Cursor cur = cursor(0);
+	UG_COND_THROW(m_file.size() < 8 || memcmp(cur.array<char>(8), UGB_MAGIC, 8) != 0,
+				  "GridReaderUGB: " << filename << " is not a ugb file.");
+
+	const uint32* info = cur.array<uint32>(8);
+	UG_COND_THROW(info[1] != UGB_BYTE_ORDER_TAG, "GridReaderUGB: " << filename
+				  << " was written on a system with a different byte order.");
+	UG_COND_THROW(info[0] < 1 || info[0] > UGB_VERSION, "GridReaderUGB: "
+				  "Unsupported version " << info[0] << " of file " << filename
+				  << " (supported: 1 - " << UGB_VERSION << ").");
+
+//	layout maps were introduced in version 2
+	uint32 numLayoutMaps = 0;
+	if(info[0] >= 2)
+		numLayoutMaps = cur.array<uint32>(2)[0];
+
+	m_posDim = (int)info[2];
+	m_numLevels = info[3];
+	m_bHierarchy = (info[7] != 0);
+
+	const uint64* numElems = cur.array<uint64>(4);
+	const uint64* numCorners = cur.array<uint64>(4);
+	for(int k = 0; k < 4; ++k){
+		m_numElems[k] = numElems[k];
+		m_numCorners[k] = numCorners[k];
+	}
+
+	const uint64* offsets = cur.array<uint64>(info[4] + info[5] + info[6]
+											  + numLayoutMaps);
+	m_vSHOffsets.assign(offsets, offsets + info[4]);
+	m_vSelOffsets.assign(offsets + info[4], offsets + info[4] + info[5]);
+	m_vPHOffsets.assign(offsets + info[4] + info[5],
+						offsets + info[4] + info[5] + info[6]);
+	m_layoutMapOffset = 0;
+	if(numLayoutMaps > 0)
+		m_layoutMapOffset = offsets[info[4] + info[5] + info[6]];
+
+//	skip the element arrays to find the positions
+	m_gridOffset = cur.pos();
+	for(int k = 0; k < 4; ++k){
+		cur.array<uint64>(m_numLevels + 1);
+		cur.array<byte>(m_numElems[k]);
+		if(k > 0)
+			cur.array<uint32>(m_numCorners[k]);
+		if(m_bHierarchy){
+			cur.array<byte>(m_numElems[k]);
+			cur.array<uint32>(m_numElems[k]);
+		}
+	}
+	m_positionOffset = cur.pos();
+	cur.array<double>(m_numElems[0] * m_posDim);
+}
+
+size_t GridReaderUGB::
+num_levels() const
+{
+	return m_numLevels;
+}
+
+GridObject* GridReaderUGB::
+element(byte kind, uint32 index) const
+{
+	switch(kind){
+		case VERTEX:
+			UG_COND_THROW(index >= m_vVrts.size(), "GridReaderUGB: bad vertex index.");
+			return m_vVrts[index];
+		case EDGE:
+			UG_COND_THROW(index >= m_vEdges.size(), "GridReaderUGB: bad edge index.");
+			return m_vEdges[index];
+		case FACE:
+			UG_COND_THROW(index >= m_vFaces.size(), "GridReaderUGB: bad face index.");
+			return m_vFaces[index];
+		case VOLUME:
+			UG_COND_THROW(index >= m_vVols.size(), "GridReaderUGB: bad volume index.");
+			return m_vVols[index];
+	}
+	UG_THROW("GridReaderUGB: bad element kind " << (int)kind);
+}
+
+///	creates an element with the given parent or (if there's no parent) on the given level
+template <class TElem>
+static TElem* CreateElement(Grid& grid, MultiGrid* mg,
+							const typename geometry_traits<TElem>::Descriptor& desc,
+							GridObject* parent, size_t lvl)
+{
+	if(mg){
+		if(parent)
+			return *mg->create<TElem>(desc, parent);
+		return *mg->create<TElem>(desc, lvl);
+	}
+	return *grid.create<TElem>(desc);
+}
+
+void GridReaderUGB::
+create_elements(Grid& g)
+{
+	MultiGrid* mg = dynamic_cast<MultiGrid*>(&g);
+
+	m_vVrts.clear();
+	m_vEdges.clear();
+	m_vFaces.clear();
+	m_vVols.clear();
+	m_vVrts.reserve(m_numElems[0]);
+	m_vEdges.reserve(m_numElems[1]);
+	m_vFaces.reserve(m_numElems[2]);
+	m_vVols.reserve(m_numElems[3]);
+
+	g.reserve<Vertex>(g.num<Vertex>() + m_numElems[0]);
+	g.reserve<Edge>(g.num<Edge>() + m_numElems[1]);
+	g.reserve<Face>(g.num<Face>() + m_numElems[2]);
+	g.reserve<Volume>(g.num<Volume>() + m_numElems[3]);
+
+//	access the arrays of the mapped file
+	const uint64* levelOffsets[4];
+	const byte* types[4];
+	const uint32* corners[4];
+	const byte* parentKinds[4];
+	const uint32* parentInds[4];
+
+	Cursor cur = cursor(m_gridOffset);
+	for(int k = 0; k < 4; ++k){
+		levelOffsets[k] = cur.array<uint64>(m_numLevels + 1);
+		types[k] = cur.array<byte>(m_numElems[k]);
+		corners[k] = (k > 0) ? cur.array<uint32>(m_numCorners[k]) : NULL;
+		parentKinds[k] = NULL;
+		parentInds[k] = NULL;
+		if(m_bHierarchy){
+			parentKinds[k] = cur.array<byte>(m_numElems[k]);
+			parentInds[k] = cur.array<uint32>(m_numElems[k]);
+		}
+	}
+
+	size_t cornerPos[4] = {0, 0, 0, 0};
+	Vertex* v[8];
+
+	for(size_t lvl = 0; lvl < m_numLevels; ++lvl){
+		for(int k = 0; k < 4; ++k){
+			UG_COND_THROW(levelOffsets[k][lvl + 1] > m_numElems[k]
+						  || levelOffsets[k][lvl] > levelOffsets[k][lvl + 1],
+						  "GridReaderUGB: bad level offsets.");
+
+			for(uint64 i = levelOffsets[k][lvl]; i < levelOffsets[k][lvl + 1]; ++i){
+				GridObject* parent = NULL;
+				if(mg && m_bHierarchy && parentKinds[k][i] != UGB_NO_PARENT)
+					parent = element(parentKinds[k][i], parentInds[k][i]);
+
+				const byte type = types[k][i];
+				UG_COND_THROW(type >= UGB_NUM_TYPES[k], "GridReaderUGB: bad element type.");
+
+				if(k == VERTEX){
+					if(mg){
+						if(parent)
+							m_vVrts.push_back(*mg->create<RegularVertex>(parent));
+						else
+							m_vVrts.push_back(*mg->create<RegularVertex>(lvl));
+					}
+					else
+						m_vVrts.push_back(*g.create<RegularVertex>());
+					continue;
+				}
+
+				const uint32 numCorners = UGB_NUM_CORNERS[k][type];
+				UG_COND_THROW(cornerPos[k] + numCorners > m_numCorners[k],
+							  "GridReaderUGB: bad number of corners.");
+				const uint32* c = corners[k] + cornerPos[k];
+				cornerPos[k] += numCorners;
+				for(uint32 j = 0; j < numCorners; ++j){
+					UG_COND_THROW(c[j] >= m_vVrts.size(), "GridReaderUGB: bad vertex index.");
+					v[j] = m_vVrts[c[j]];
+				}
+
+				switch(k){
+					case EDGE:
+						m_vEdges.push_back(CreateElement<RegularEdge>(
+								g, mg, EdgeDescriptor(v[0], v[1]), parent, lvl));
+						break;
+					case FACE:
+						if(type == 0)
+							m_vFaces.push_back(CreateElement<Triangle>(
+									g, mg, TriangleDescriptor(v[0], v[1], v[2]),
+									parent, lvl));
+						else
+							m_vFaces.push_back(CreateElement<Quadrilateral>(
+									g, mg, QuadrilateralDescriptor(v[0], v[1], v[2], v[3]),
+									parent, lvl));
+						break;
+					case VOLUME:
+						switch(type){
+							case 0:	m_vVols.push_back(CreateElement<Tetrahedron>(
+										g, mg, TetrahedronDescriptor(v[0], v[1], v[2], v[3]),
+										parent, lvl));
+									break;
+							case 1:	m_vVols.push_back(CreateElement<Pyramid>(
+										g, mg, PyramidDescriptor(v[0], v[1], v[2], v[3], v[4]),
+										parent, lvl));
+									break;
+							case 2:	m_vVols.push_back(CreateElement<Prism>(
+										g, mg, PrismDescriptor(v[0], v[1], v[2], v[3], v[4], v[5]),
+										parent, lvl));
+									break;
+							case 3:	m_vVols.push_back(CreateElement<Hexahedron>(
+										g, mg, HexahedronDescriptor(v[0], v[1], v[2], v[3],
+																	v[4], v[5], v[6], v[7]),
+										parent, lvl));
+									break;
+							case 4:	m_vVols.push_back(CreateElement<Octahedron>(
+										g, mg, OctahedronDescriptor(v[0], v[1], v[2], v[3], v[4], v[5]),
+										parent, lvl));
+									break;
+						}
+						break;
+				}
+			}
+		}
+	}
+}
+
+std::string GridReaderUGB::
+get_subset_handler_name(size_t i) const
+{
+	UG_COND_THROW(i >= m_vSHOffsets.size(), "Bad subset-handler-index: " << i);
+	return cursor(m_vSHOffsets[i]).string();
+}
+
+void GridReaderUGB::
+subset_handler(ISubsetHandler& shOut, size_t shIndex)
+{
+	UG_COND_THROW(shIndex >= m_vSHOffsets.size(),
+				  "Bad subset-handler-index: " << shIndex);
+	UG_COND_THROW(m_vVrts.size() != m_numElems[0],
+				  "GridReaderUGB::subset_handler: Call grid first.");
+
+	Cursor cur = cursor(m_vSHOffsets[shIndex]);
+	cur.string();
+
+	const uint32 numSubsets = cur.value<uint32>();
+	for(uint32 i = 0; i < numSubsets; ++i){
+		SubsetInfo& si = shOut.subset_info(i);
+		si.name = cur.string();
+		const double* color = cur.array<double>(4);
+		for(int j = 0; j < 4; ++j)
+			si.color[j] = color[j];
+	}
+
+	const int* inds = cur.array<int>(m_numElems[0]);
+	for(size_t i = 0; i < m_vVrts.size(); ++i)
+		if(inds[i] >= 0) shOut.assign_subset(m_vVrts[i], inds[i]);
+
+	inds = cur.array<int>(m_numElems[1]);
+	for(size_t i = 0; i < m_vEdges.size(); ++i)
+		if(inds[i] >= 0) shOut.assign_subset(m_vEdges[i], inds[i]);
+
+	inds = cur.array<int>(m_numElems[2]);
+	for(size_t i = 0; i < m_vFaces.size(); ++i)
+		if(inds[i] >= 0) shOut.assign_subset(m_vFaces[i], inds[i]);
+
+	inds = cur.array<int>(m_numElems[3]);
+	for(size_t i = 0; i < m_vVols.size(); ++i)
+		if(inds[i] >= 0) shOut.assign_subset(m_vVols[i], inds[i]);
+}
+
+std::string GridReaderUGB::
+get_selector_name(size_t i) const
+{
+	UG_COND_THROW(i >= m_vSelOffsets.size(), "Bad selector-index: " << i);
+	return cursor(m_vSelOffsets[i]).string();
+}
+
+void GridReaderUGB::
+selector(ISelector& selOut, size_t selIndex)
+{
+	UG_COND_THROW(selIndex >= m_vSelOffsets.size(),
+				  "Bad selector-index: " << selIndex);
+	UG_COND_THROW(m_vVrts.size() != m_numElems[0],
+				  "GridReaderUGB::selector: Call grid first.");
+
+	Cursor cur = cursor(m_vSelOffsets[selIndex]);
+	cur.string();
+
+	const byte* status = cur.array<byte>(m_numElems[0]);
+	for(size_t i = 0; i < m_vVrts.size(); ++i)
+		if(status[i]) selOut.select(m_vVrts[i], status[i]);
+
+	status = cur.array<byte>(m_numElems[1]);
+	for(size_t i = 0; i < m_vEdges.size(); ++i)
+		if(status[i]) selOut.select(m_vEdges[i], status[i]);
+
+	status = cur.array<byte>(m_numElems[2]);
+	for(size_t i = 0; i < m_vFaces.size(); ++i)
+		if(status[i]) selOut.select(m_vFaces[i], status[i]);
+
+	status = cur.array<byte>(m_numElems[3]);
+	for(size_t i = 0; i < m_vVols.size(); ++i)
+		if(status[i]) selOut.select(m_vVols[i], status[i]);
+}
+
+std::string GridReaderUGB::
+get_projection_handler_name(size_t i) const
+{
+	UG_COND_THROW(i >= m_vPHOffsets.size(), "Bad projection-handler-index: " << i);
+	return cursor(m_vPHOffsets[i]).string();
+}
+
+size_t GridReaderUGB::
+get_projection_handler_subset_handler_index(size_t i) const
+{
+	UG_COND_THROW(i >= m_vPHOffsets.size(), "Bad projection-handler-index: " << i);
+	Cursor cur = cursor(m_vPHOffsets[i]);
+	cur.string();
+	return cur.value<uint32>();
+}
+
+void GridReaderUGB::
+projection_handler(ProjectionHandler& phOut, size_t phIndex)
+{
+	static Factory<RefinementProjector, ProjectorTypes>	projFac;
+	static Archivar<boost::archive::text_iarchive, RefinementProjector, ProjectorTypes>	archivar;
+
+	UG_COND_THROW(phIndex >= m_vPHOffsets.size(),
+				  "Bad projection-handler-index: " << phIndex);
+
+	Cursor cur = cursor(m_vPHOffsets[phIndex]);
+	cur.string();
+	cur.value<uint32>();
+
+	const uint32 numProjs = cur.value<uint32>();
+	for(uint32 i = 0; i < numProjs; ++i){
+		const int* info = cur.array<int>(2);
+		const std::string type = cur.string();
+		const std::string data = cur.string();
+
+		try {
+			SPRefinementProjector proj = projFac.create(type);
+
+			stringstream ss(data, ios_base::in);
+			boost::archive::text_iarchive ar(ss, boost::archive::no_header);
+			archivar.archive(ar, *proj);
+
+			if(info[0])
+				phOut.set_default_projector(proj);
+			else
+				phOut.set_projector(info[1], proj);
+		}
+		catch(boost::archive::archive_exception e){
+			UG_LOG("WARNING: Couldn't read projector of type '" << type << "'.\n");
+		}
+	}
+}
+
+int GridReaderUGB::
+layout_map_rank() const
+{
+	if(!has_layout_map())
+		return -1;
+	return cursor(m_layoutMapOffset).array<int>(2)[0];
+}
+
+int GridReaderUGB::
+layout_map_num_procs() const
+{
+	if(!has_layout_map())
+		return -1;
+	return cursor(m_layoutMapOffset).array<int>(2)[1];
+}
+
+#ifdef UG_PARALLEL
+template <class TElem>
+void GridReaderUGB::
+read_layouts(Cursor& cur, GridLayoutMap& glmOut, const vector<TElem*>& elems)
+{
+	typedef typename GridLayoutMap::Types<TElem>::Layout	layout_t;
+	typedef typename GridLayoutMap::Types<TElem>::Interface	interface_t;
+
+	const uint32 numLayouts = cur.value<uint32>();
+	for(uint32 i_layout = 0; i_layout < numLayouts; ++i_layout){
+		const int* layoutInfo = cur.array<int>(2);
+		const int* ifcInfos = cur.array<int>(3 * layoutInfo[1]);
+
+		size_t numInds = 0;
+		for(int i = 0; i < layoutInfo[1]; ++i)
+			numInds += ifcInfos[3 * i + 2];
+		const uint32* inds = cur.array<uint32>(numInds);
+
+		layout_t& layout = glmOut.get_layout<TElem>(layoutInfo[0]);
+		for(int i = 0; i < layoutInfo[1]; ++i){
+			interface_t& intfc = layout.interface(ifcInfos[3 * i + 1],
+												  ifcInfos[3 * i]);
+			for(int j = 0; j < ifcInfos[3 * i + 2]; ++j, ++inds){
+				UG_COND_THROW(*inds >= elems.size(),
+							  "GridReaderUGB: bad interface element index.");
+				intfc.push_back(elems[*inds]);
+			}
+		}
+	}
+}
+
+void GridReaderUGB::
+layout_map(GridLayoutMap& glmOut)
+{
+	UG_COND_THROW(!has_layout_map(), "GridReaderUGB::layout_map: "
+				  "The file doesn't contain a layout map.");
+	UG_COND_THROW(m_vVrts.size() != m_numElems[0],
+				  "GridReaderUGB::layout_map: Call grid first.");
+
+	Cursor cur = cursor(m_layoutMapOffset);
+	cur.array<int>(2);
+	read_layouts<Vertex>(cur, glmOut, m_vVrts);
+	read_layouts<Edge>(cur, glmOut, m_vEdges);
+	read_layouts<Face>(cur, glmOut, m_vFaces);
+	read_layouts<Volume>(cur, glmOut, m_vVols);
+}
+#endif
+
+}//	end of namespace
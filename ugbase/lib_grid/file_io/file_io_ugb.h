@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__FILE_IO_UGB__
+#define __H__LIB_GRID__FILE_IO_UGB__
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "common/types.h"
+#include "common/util/mapped_file.h"
+#include "common/util/smart_pointer.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+#include "lib_grid/tools/selector_interface.h"
+#include "lib_grid/common_attachments.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_grid/parallelization/parallel_grid_layout.h"
+#endif
+
+namespace ug
+{
+
+class ProjectionHandler;
+
+/**	\page pageUGB UGB - the binary ug grid format
+ *
+ * UGB files contain a grid (optionally with its multigrid hierarchy), an
+ * arbitrary number of subset handlers, selectors and projection handlers in a
+ * binary layout, which can be used in place after mapping the file to memory.
+ * All arrays are stored in native byte order and are aligned to 8 bytes:
+ *
+ * - header (magic "UGBGRID\0", version, byte order tag, sizes)
+ * - offsets of the subset handler, selector and projection handler sections
+ * - for vertices, edges, faces and volumes:
+ *   level ranges (uint64[numLevels+1]), element types (byte[num]),
+ *   corner indices (uint32[]), parent kinds (byte[num]) and
+ *   parent indices (uint32[num])
+ * - vertex coordinates (double[numVertices * posDim])
+ * - subset handler sections: name, subset names and colors and subset
+ *   indices (int32[num]) of vertices, edges, faces and volumes
+ * - selector sections: name and selection status (byte[num]) of all elements
+ * - projection handler sections: name, subset handler index and the
+ *   projectors, serialized through boost text archives (as in ugx files)
+ * - optional layout map section (since version 2): rank and number of
+ *   processes of the writing process and for vertices, edges, faces and
+ *   volumes all layouts of a GridLayoutMap, given by their key, the level,
+ *   target process and size of each interface (int32[3*numInterfaces]) and
+ *   the indices of the interface elements (uint32[]). Together with the
+ *   files of all other processes, this allows to restore a distributed grid
+ *   without any redistribution.
+ *
+ * Elements are stored level by level, so that parents always precede their
+ * children. Only regular (i.e. unconstrained) grid elements are supported.
+ */
+
+///	Writes a grid to a ugb file. internally uses GridWriterUGB.
+template <class TAPosition>
+bool SaveGridToUGB(Grid& grid, ISubsetHandler& sh,
+				   const char* filename, TAPosition& aPos);
+
+///	Reads a grid from a ugb file. internally uses GridReaderUGB.
+template <class TAPosition>
+bool LoadGridFromUGB(Grid& grid, ISubsetHandler& sh,
+					 const char* filename, TAPosition& aPos);
+
+
+////////////////////////////////////////////////////////////////////////
+///	Writes grids, subset handlers, selectors and projection handlers to ugb files
+/**	Make sure that all elements added via one of the add_* methods
+ *	exist until write_to_file was called.
+ */
+class GridWriterUGB
+{
+	public:
+		GridWriterUGB();
+		~GridWriterUGB();
+
+	/**	TPositionAttachments value type has to be compatible with MathVector.
+	 *	Make sure that aPos is attached to the vertices of the grid.
+	 *	Only one grid can be written to a ugb file.*/
+		template <class TPositionAttachment>
+		void add_grid(Grid& grid, TPositionAttachment& aPos);
+
+		void add_subset_handler(ISubsetHandler& sh, const char* name);
+
+		void add_selector(ISelector& sel, const char* name);
+
+	///	the subset handler of the projection handler has to be added before.
+		void add_projection_handler(ProjectionHandler& ph, const char* name);
+
+	#ifdef UG_PARALLEL
+	///	writes the layouts of the local process, together with its rank
+	/**	The layout map has to belong to the grid, which was added through add_grid.*/
+		void add_layout_map(GridLayoutMap& glm);
+	#endif
+
+	/**	\throws UGError if the grid contains unsupported elements or if the
+	 *	file can't be written.*/
+		void write_to_file(const char* filename);
+
+	protected:
+	///	writes the positions of the given vertices as doubles
+		class PositionWriterBase{
+			public:
+				virtual ~PositionWriterBase()	{}
+				virtual int dim() const = 0;
+				virtual void write(std::ostream& out,
+								   const std::vector<GridObject*>& vrts) const = 0;
+		};
+
+		template <class TAPos>
+		class PositionWriter;
+
+		void collect_elements();
+		void write_grid_section(std::ostream& out);
+		void write_subset_handler_section(std::ostream& out, size_t i);
+		void write_selector_section(std::ostream& out, size_t i);
+		void write_projection_handler_section(std::ostream& out, size_t i);
+	#ifdef UG_PARALLEL
+		void write_layout_map_section(std::ostream& out);
+
+		template <class TElem>
+		void write_layouts(std::ostream& out);
+	#endif
+
+		template <class TElem>
+		void collect(std::vector<GridObject*>& elems, std::vector<byte>& types,
+					 int level, byte typeId);
+
+	protected:
+		Grid*								m_pGrid;
+		MultiGrid*							m_pMG;
+		SmartPtr<PositionWriterBase>		m_spPosWriter;
+
+		std::vector<std::pair<ISubsetHandler*, std::string> >		m_vSH;
+		std::vector<std::pair<ISelector*, std::string> >			m_vSel;
+		std::vector<std::pair<ProjectionHandler*, std::string> >	m_vPH;
+
+	#ifdef UG_PARALLEL
+		GridLayoutMap*			m_pLayoutMap;
+	#endif
+
+	//	elements and their types, ordered by level, for vertices, edges, faces and volumes
+		std::vector<GridObject*>	m_vElems[4];
+		std::vector<byte>			m_vTypes[4];
+		std::vector<uint64>			m_vLevelOffsets[4];
+		AInt						m_aIndex;
+};
+
+
+////////////////////////////////////////////////////////////////////////
+///	Reads ugb files through a memory mapping
+/**	The file is mapped by open. All arrays are used directly from the mapped
+ *	memory. Call grid before any of subset_handler, selector or
+ *	projection_handler.
+ */
+class GridReaderUGB
+{
+	public:
+		GridReaderUGB();
+		~GridReaderUGB();
+
+	/**	\throws UGError if the file can't be mapped or isn't a valid ugb file.*/
+		void open(const char* filename);
+
+	///	number of levels of the stored grid hierarchy
+		size_t num_levels() const;
+
+	///	creates the stored elements in the given grid and assigns their positions
+	/**	If gridOut is a MultiGrid, the stored hierarchy is restored.
+	 *	Otherwise the elements of all levels are created in gridOut.*/
+		template <class TPositionAttachment>
+		void grid(Grid& gridOut, TPositionAttachment& aPos);
+
+		size_t num_subset_handlers() const		{return m_vSHOffsets.size();}
+		std::string get_subset_handler_name(size_t i) const;
+		void subset_handler(ISubsetHandler& shOut, size_t i);
+
+		size_t num_selectors() const			{return m_vSelOffsets.size();}
+		std::string get_selector_name(size_t i) const;
+		void selector(ISelector& selOut, size_t i);
+
+		size_t num_projection_handlers() const	{return m_vPHOffsets.size();}
+		std::string get_projection_handler_name(size_t i) const;
+		size_t get_projection_handler_subset_handler_index(size_t i) const;
+		void projection_handler(ProjectionHandler& phOut, size_t i);
+
+	///	returns true if the file contains the layouts of a distributed grid
+		bool has_layout_map() const				{return m_layoutMapOffset != 0;}
+
+	///	rank of the process which wrote the file (-1 if there is no layout map)
+		int layout_map_rank() const;
+
+	///	number of processes of the distribution (-1 if there is no layout map)
+		int layout_map_num_procs() const;
+
+	#ifdef UG_PARALLEL
+	///	adds the stored layouts of the elements created by grid to glmOut
+		void layout_map(GridLayoutMap& glmOut);
+	#endif
+
+	protected:
+	///	reads consecutive arrays from the mapped file
+		class Cursor{
+			public:
+				Cursor(const char* data, size_t size, size_t pos) :
+					m_data(data), m_size(size), m_pos(pos)	{}
+
+				template <class T>
+				const T* array(size_t num);
+
+				template <class T>
+				T value()	{return *array<T>(1);}
+
+				std::string string();
+
+				size_t pos() const	{return m_pos;}
+
+			private:
+				const char*	m_data;
+				size_t		m_size;
+				size_t		m_pos;
+		};
+
+		Cursor cursor(size_t pos) const;
+
+		void create_elements(Grid& gridOut);
+
+	#ifdef UG_PARALLEL
+		template <class TElem>
+		void read_layouts(Cursor& cur, GridLayoutMap& glmOut,
+						  const std::vector<TElem*>& elems);
+	#endif
+
+		template <class TAPos>
+		void assign_positions(Grid& gridOut, TAPos& aPos);
+
+		GridObject* element(byte kind, uint32 index) const;
+
+	protected:
+		MappedFile				m_file;
+		int						m_posDim;
+		size_t					m_numLevels;
+		bool					m_bHierarchy;
+		uint64					m_numElems[4];
+		uint64					m_numCorners[4];
+		size_t					m_gridOffset;
+		size_t					m_positionOffset;
+		std::vector<uint64>		m_vSHOffsets;
+		std::vector<uint64>		m_vSelOffsets;
+		std::vector<uint64>		m_vPHOffsets;
+		uint64					m_layoutMapOffset;
+
+		std::vector<Vertex*>	m_vVrts;
+		std::vector<Edge*>		m_vEdges;
+		std::vector<Face*>		m_vFaces;
+		std::vector<Volume*>	m_vVols;
+};
+
+}//	end of namespace
+
+#include "file_io_ugb_impl.hpp"
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__FILE_IO_UGB_IMPL__
+#define __H__LIB_GRID__FILE_IO_UGB_IMPL__
+
+#include <algorithm>
+#include "common/error.h"
+#include "common/log.h"
+
+namespace ug
+{
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPosition>
+bool SaveGridToUGB(Grid& grid, ISubsetHandler& sh, const char* filename,
+				   TAPosition& aPos)
+{
+	try{
+		GridWriterUGB ugbWriter;
+		ugbWriter.add_grid(grid, aPos);
+		ugbWriter.add_subset_handler(sh, "defSH");
+		ugbWriter.write_to_file(filename);
+	}
+	catch(UGError& err){
+		UG_LOG("ERROR in SaveGridToUGB: " << err.get_msg() << std::endl);
+		return false;
+	}
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPosition>
+bool LoadGridFromUGB(Grid& grid, ISubsetHandler& sh, const char* filename,
+					 TAPosition& aPos)
+{
+	try{
+		GridReaderUGB ugbReader;
+		ugbReader.open(filename);
+		ugbReader.grid(grid, aPos);
+
+		if(ugbReader.num_subset_handlers() > 0)
+			ugbReader.subset_handler(sh, 0);
+	}
+	catch(UGError& err){
+		UG_LOG("ERROR in LoadGridFromUGB: " << err.get_msg() << std::endl);
+		return false;
+	}
+	return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPos>
+class GridWriterUGB::PositionWriter : public GridWriterUGB::PositionWriterBase
+{
+	public:
+		typedef typename TAPos::ValueType	vector_t;
+
+		PositionWriter(Grid& grid, TAPos& aPos) : m_aaPos(grid, aPos)	{}
+
+		virtual int dim() const		{return vector_t::Size;}
+
+		virtual void write(std::ostream& out, const std::vector<GridObject*>& vrts) const
+		{
+		//	write in blocks, to avoid large temporary buffers
+			const size_t blockSize = 4096;
+			std::vector<double> buf;
+			buf.reserve(blockSize * vector_t::Size);
+			for(size_t i = 0; i < vrts.size(); i += blockSize){
+				buf.clear();
+				const size_t iEnd = std::min(vrts.size(), i + blockSize);
+				for(size_t j = i; j < iEnd; ++j){
+					const vector_t& v = m_aaPos[static_cast<Vertex*>(vrts[j])];
+					for(size_t k = 0; k < vector_t::Size; ++k)
+						buf.push_back((double)v[k]);
+				}
+				out.write(reinterpret_cast<const char*>(&buf.front()),
+						  buf.size() * sizeof(double));
+			}
+		}
+
+	private:
+		mutable Grid::VertexAttachmentAccessor<TAPos>	m_aaPos;
+};
+
+template <class TPositionAttachment>
+void GridWriterUGB::
+add_grid(Grid& grid, TPositionAttachment& aPos)
+{
+	UG_COND_THROW(m_pGrid, "GridWriterUGB::add_grid: only one grid can be "
+				  "written to a ugb file.");
+	UG_COND_THROW(!grid.has_vertex_attachment(aPos),
+				  "GridWriterUGB::add_grid: position attachment missing.");
+
+	m_pGrid = &grid;
+	m_pMG = dynamic_cast<MultiGrid*>(&grid);
+	m_spPosWriter = make_sp(new PositionWriter<TPositionAttachment>(grid, aPos));
+}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class T>
+const T* GridReaderUGB::Cursor::
+array(size_t num)
+{
+	const size_t numBytes = num * sizeof(T);
+	UG_COND_THROW(m_pos + numBytes > m_size,
+				  "GridReaderUGB: unexpected end of file.");
+	const T* p = reinterpret_cast<const T*>(m_data + m_pos);
+//	all arrays are aligned to 8 bytes
+	m_pos += (numBytes + 7) & ~(size_t)7;
+	return p;
+}
+
+template <class TPositionAttachment>
+void GridReaderUGB::
+grid(Grid& gridOut, TPositionAttachment& aPos)
+{
+	UG_COND_THROW(!m_file.is_open(), "GridReaderUGB::grid: no file opened.");
+
+	if(!gridOut.has_vertex_attachment(aPos))
+		gridOut.attach_to_vertices(aPos);
+
+	create_elements(gridOut);
+	assign_positions(gridOut, aPos);
+}
+
+template <class TAPos>
+void GridReaderUGB::
+assign_positions(Grid& gridOut, TAPos& aPos)
+{
+	typedef typename TAPos::ValueType	vector_t;
+	Grid::VertexAttachmentAccessor<TAPos> aaPos(gridOut, aPos);
+
+	Cursor cur = cursor(m_positionOffset);
+	const double* coords = cur.array<double>(m_vVrts.size() * m_posDim);
+
+	const int numComps = std::min<int>(m_posDim, vector_t::Size);
+	for(size_t i = 0; i < m_vVrts.size(); ++i){
+		vector_t& v = aaPos[m_vVrts[i]];
+		const double* c = coords + i * m_posDim;
+		int k = 0;
+		for(; k < numComps; ++k)
+			v[k] = c[k];
+		for(; k < (int)vector_t::Size; ++k)
+			v[k] = 0;
+	}
+}
+
+}//	end of namespace
+
+#endif
@@ -30,6 +30,7 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <algorithm>
 #include <sstream>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
@@ -922,7 +923,8 @@ create_octahedron_node(OctahedronIterator octsBegin,
 ////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////
 //	implementation of GridReaderUGX
-GridReaderUGX::GridReaderUGX()
+GridReaderUGX::GridReaderUGX() :
+	m_loadAllAttachments(true)
 {
 }
 
@@ -1053,7 +1055,8 @@ read_subset_handler_elements(ISubsetHandler& shOut,
 	while(elemNode)
 	{
 	//	read the indices
-		stringstream ss(elemNode->value(), ios_base::in);
+		UGXValueReader ss;
+		ss.init(elemNode, m_deferredValues);
 
 		size_t index;
 		while(!ss.eof()){
@@ -1159,7 +1162,8 @@ read_selector_elements(ISelector& selOut, const char* elemNodeName,
 	while(elemNode)
 	{
 	//	read the indices
-		stringstream ss(elemNode->value(), ios_base::in);
+		UGXValueReader ss;
+		ss.init(elemNode, m_deferredValues);
 
 		size_t index;
 		int state;
@@ -1246,7 +1250,7 @@ read_projector(xml_node<>* projNode)
 		try {
 			SPRefinementProjector proj = projFac.create(attribType->value());
 
-			string str(projNode->value(), projNode->value_size());
+			string str = UGXNodeValue(projNode, m_deferredValues);
 			stringstream ss(str, ios_base::in);
 			boost::archive::text_iarchive ar(ss, boost::archive::no_header);
 			archivar.archive(ar, *proj);
@@ -1298,30 +1302,123 @@ projection_handler(ProjectionHandler& phOut, size_t phIndex, size_t refGridIndex
 }
 
 
+void GridReaderUGX::
+set_attachments_to_load(const std::vector<std::string>& names)
+{
+	m_loadAllAttachments = false;
+	m_attachmentsToLoad = names;
+}
+
+void GridReaderUGX::
+load_all_attachments()
+{
+	m_loadAllAttachments = true;
+	m_attachmentsToLoad.clear();
+}
+
+size_t GridReaderUGX::
+num_attachments(size_t refGridIndex) const
+{
+	if(refGridIndex >= m_entries.size()){
+		UG_LOG("GridReaderUGX::num_attachments: bad refGridIndex. Aborting.\n");
+		return 0;
+	}
+
+	return m_entries[refGridIndex].attachmentEntries.size();
+}
+
+const char* GridReaderUGX::
+get_attachment_name(size_t refGridIndex, size_t attachmentIndex) const
+{
+	assert(refGridIndex < num_grids() && "Bad refGridIndex!");
+	const GridEntry& ge = m_entries[refGridIndex];
+	assert(attachmentIndex < ge.attachmentEntries.size() && "Bad attachmentIndex!");
+
+	xml_attribute<>* attrib = ge.attachmentEntries[attachmentIndex].node->first_attribute("name");
+	if(attrib)
+		return attrib->value();
+	return "";
+}
+
 bool GridReaderUGX::
-parse_file(const char* filename)
+attachment_loaded(size_t refGridIndex, size_t attachmentIndex) const
 {
-	ifstream in(filename, ios::binary);
-	if(!in)
+	assert(refGridIndex < num_grids() && "Bad refGridIndex!");
+	const GridEntry& ge = m_entries[refGridIndex];
+	assert(attachmentIndex < ge.attachmentEntries.size() && "Bad attachmentIndex!");
+	return ge.attachmentEntries[attachmentIndex].loaded;
+}
+
+bool GridReaderUGX::
+attachment(const char* name, size_t refGridIndex)
+{
+	if(refGridIndex >= m_entries.size()){
+		UG_LOG("GridReaderUGX::attachment: bad refGridIndex. Aborting.\n");
+		return false;
+	}
+
+	GridEntry& ge = m_entries[refGridIndex];
+	if(!ge.grid){
+		UG_LOG("GridReaderUGX::attachment: The grid has to be read before its attachments.\n");
 		return false;
+	}
 
-//	get the length of the file
-	streampos posStart = in.tellg();
-	in.seekg(0, ios_base::end);
-	streampos posEnd = in.tellg();
-	streamsize size = posEnd - posStart;
+	bool found = false;
+	for(size_t i = 0; i < ge.attachmentEntries.size(); ++i){
+		if(strcmp(get_attachment_name(refGridIndex, i), name) == 0){
+			if(!read_attachment_entry(*ge.grid, ge.attachmentEntries[i]))
+				return false;
+			found = true;
+		}
+	}
+	return found;
+}
+
+bool GridReaderUGX::
+read_attachment_entry(Grid& grid, AttachmentEntry& entry)
+{
+	if(entry.loaded)
+		return true;
 
-//	go back to the start of the file
-	in.seekg(posStart);
+	bool bSuccess = false;
+	switch(entry.elemType){
+		case VERTEX:	bSuccess = read_attachment<Vertex>(grid, entry.node); break;
+		case EDGE:		bSuccess = read_attachment<Edge>(grid, entry.node); break;
+		case FACE:		bSuccess = read_attachment<Face>(grid, entry.node); break;
+		case VOLUME:	bSuccess = read_attachment<Volume>(grid, entry.node); break;
+	}
+
+	entry.loaded = bSuccess;
+	return bSuccess;
+}
+
+bool GridReaderUGX::
+read_selected_attachments(size_t refGridIndex)
+{
+	GridEntry& ge = m_entries[refGridIndex];
+	for(size_t i = 0; i < ge.attachmentEntries.size(); ++i){
+		if(!m_loadAllAttachments){
+			const char* name = get_attachment_name(refGridIndex, i);
+			if(find(m_attachmentsToLoad.begin(), m_attachmentsToLoad.end(), name)
+				== m_attachmentsToLoad.end())
+			{
+				continue;
+			}
+		}
 
-//	read the whole file en-block and terminate it with 0
-	char* fileContent = m_doc.allocate_string(0, size + 1);
-	in.read(fileContent, size);
-	fileContent[size] = 0;
-	in.close();
+		if(!read_attachment_entry(*ge.grid, ge.attachmentEntries[i]))
+			return false;
+	}
+	return true;
+}
 
-//	parse the xml-data
-	m_doc.parse<0>(fileContent);
+bool GridReaderUGX::
+parse_file(const char* filename)
+{
+//	parse the markup. Large values (e.g. vertex coordinates) are not loaded
+//	but read from the file on demand through m_deferredValues.
+	if(!ParseUGXMarkup(m_doc, filename, m_deferredValues))
+		return false;
 
 //	notify derived classes that a new document has been parsed.
 	return new_document_parsed();
@@ -1360,6 +1457,21 @@ new_document_parsed()
 			curPHNode = curPHNode->next_sibling("projection_handler");
 		}
 
+	//	collect associated attachments. Their values are read on demand.
+		for(xml_node<>* attNode = curNode->first_node(); attNode;
+			attNode = attNode->next_sibling())
+		{
+			const char* name = attNode->name();
+			if(strcmp(name, "vertex_attachment") == 0)
+				gridEntry.attachmentEntries.push_back(AttachmentEntry(attNode, VERTEX));
+			else if(strcmp(name, "edge_attachment") == 0)
+				gridEntry.attachmentEntries.push_back(AttachmentEntry(attNode, EDGE));
+			else if(strcmp(name, "face_attachment") == 0)
+				gridEntry.attachmentEntries.push_back(AttachmentEntry(attNode, FACE));
+			else if(strcmp(name, "volume_attachment") == 0)
+				gridEntry.attachmentEntries.push_back(AttachmentEntry(attNode, VOLUME));
+		}
+
 		curNode = curNode->next_sibling("grid");
 	}
 
@@ -1371,9 +1483,9 @@ create_edges(std::vector<Edge*>& edgesOut,
 			Grid& grid, rapidxml::xml_node<>* node,
 			std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the edges
 	int i1, i2;
@@ -1407,9 +1519,9 @@ create_constraining_edges(std::vector<Edge*>& edgesOut,
 						  Grid& grid, rapidxml::xml_node<>* node,
 			 			  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the edges
 	int i1, i2;
@@ -1443,9 +1555,9 @@ create_constrained_edges(std::vector<Edge*>& edgesOut,
 						  Grid& grid, rapidxml::xml_node<>* node,
 			 			  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the edges
 	int i1, i2;
@@ -1489,9 +1601,9 @@ create_triangles(std::vector<Face*>& facesOut,
 				  Grid& grid, rapidxml::xml_node<>* node,
 				  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the triangles
 	int i1, i2, i3;
@@ -1526,9 +1638,9 @@ create_constraining_triangles(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the triangles
 	int i1, i2, i3;
@@ -1564,9 +1676,9 @@ create_constrained_triangles(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the triangles
 	int i1, i2, i3;
@@ -1611,9 +1723,9 @@ create_quadrilaterals(std::vector<Face*>& facesOut,
 					   Grid& grid, rapidxml::xml_node<>* node,
 					   std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the quadrilaterals
 	int i1, i2, i3, i4;
@@ -1650,9 +1762,9 @@ create_constraining_quadrilaterals(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the quadrilaterals
 	int i1, i2, i3, i4;
@@ -1691,9 +1803,9 @@ create_constrained_quadrilaterals(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the quadrilaterals
 	int i1, i2, i3, i4;
@@ -1742,9 +1854,9 @@ create_tetrahedrons(std::vector<Volume*>& volsOut,
 					 Grid& grid, rapidxml::xml_node<>* node,
 					 std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the tetrahedrons
 	int i1, i2, i3, i4;
@@ -1781,9 +1893,9 @@ create_hexahedrons(std::vector<Volume*>& volsOut,
 					Grid& grid, rapidxml::xml_node<>* node,
 					std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the hexahedrons
 	int i1, i2, i3, i4, i5, i6, i7, i8;
@@ -1824,9 +1936,9 @@ create_prisms(std::vector<Volume*>& volsOut,
 			  Grid& grid, rapidxml::xml_node<>* node,
 			  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the hexahedrons
 	int i1, i2, i3, i4, i5, i6;
@@ -1865,9 +1977,9 @@ create_pyramids(std::vector<Volume*>& volsOut,
 				Grid& grid, rapidxml::xml_node<>* node,
 				std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the hexahedrons
 	int i1, i2, i3, i4, i5;
@@ -1905,9 +2017,9 @@ create_octahedrons(std::vector<Volume*>& volsOut,
 					Grid& grid, rapidxml::xml_node<>* node,
 					std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(node, m_deferredValues);
 
 //	read the octahedrons
 	int i1, i2, i3, i4, i5, i6;
@@ -1950,28 +2062,11 @@ UGXFileInfo::UGXFileInfo() :
 bool UGXFileInfo::parse_file(const char* filename)
 {
 	PROFILE_FUNC_GROUP("UGXFileInfo");
-	ifstream in(filename, ios::binary);
-	if(!in)
-		return false;
-
-//	get the length of the file
-	streampos posStart = in.tellg();
-	in.seekg(0, ios_base::end);
-	streampos posEnd = in.tellg();
-	streamsize size = posEnd - posStart;
-
-//	go back to the start of the file
-	in.seekg(posStart);
-
-//	read the whole file en-block and terminate it with 0
+//	parse the markup only. Large values are read on demand.
 	rapidxml::xml_document<> doc;
-	char* fileContent = doc.allocate_string(0, size + 1);
-	in.read(fileContent, size);
-	fileContent[size] = 0;
-	in.close();
-
-//	parse the xml-data
-	doc.parse<0>(fileContent);
+	UGXDeferredValues deferred;
+	if(!ParseUGXMarkup(doc, filename, deferred))
+		return false;
 
 	xml_node<>* curNode = doc.first_node("grid");
 	while(curNode){
@@ -2005,7 +2100,7 @@ bool UGXFileInfo::parse_file(const char* filename)
 		{
 			// create a bounding box around the vertices contained in this xml node
 			AABox<vector3> newBox;
-			bool validBox = calculate_vertex_node_bbox(vrtNode, newBox);
+			bool validBox = calculate_vertex_node_bbox(vrtNode, deferred, newBox);
 		    if (validBox)
 		    	box = AABox<vector3>(box, newBox);
 
@@ -2181,7 +2276,9 @@ UGXFileInfo::subset_info(size_t gridInd, size_t shInd, size_t subsetInd) const
 }
 
 bool
-UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vector3>& bb) const
+UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode,
+										const UGXDeferredValues& deferred,
+										AABox<vector3>& bb) const
 {
 	size_t numSrcCoords = 0;
 	rapidxml::xml_attribute<>* attrib = vrtNode->first_attribute("coords");
@@ -2196,9 +2293,9 @@ UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vec
 	if (numSrcCoords > 3)
 		return false;
 
-//	create a buffer with which we can access the data
-	std::string str(vrtNode->value(), vrtNode->value_size());
-	std::stringstream ss(str, std::ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(vrtNode, deferred);
 
 	AABox<vector3> box(vector3(0, 0, 0), vector3(0, 0, 0));
 	vector3 min(0, 0, 0);
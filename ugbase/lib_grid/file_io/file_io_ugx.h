@@ -39,7 +39,9 @@
 #include <iostream>
 #include <vector>
 #include <utility>
+#include <string>
 #include "common/parser/rapidxml/rapidxml.hpp"
+#include "file_io_ugx_stream.h"
 #include "lib_grid/grid/grid.h"
 #include "lib_grid/multi_grid.h"
 #include "lib_grid/tools/subset_handler_interface.h"
@@ -351,7 +353,36 @@ class GridReaderUGX
 
 	///	fills the given projection-handler
 		bool projection_handler(ProjectionHandler& phOut, size_t phIndex, size_t refGridIndex);
-		
+
+	///	restricts the attachments which are read by grid() to the given names
+	/**	By default all attachments are read together with the grid. If a list of
+	 * names is specified, only attachments with those names are read. Pass an
+	 * empty list to skip all attachments. Skipped attachments can be read later
+	 * on through attachment(). Since their values are not loaded from the file
+	 * during parsing, skipped attachments neither cost time nor memory.*/
+		void set_attachments_to_load(const std::vector<std::string>& names);
+
+	///	makes grid() read all attachments (default)
+		void load_all_attachments();
+
+	///	returns the number of attachments stored for the given grid
+	/**	Attachments of different element types are counted separately.*/
+		size_t num_attachments(size_t refGridIndex) const;
+
+	///	returns the name of the given attachment
+		const char* get_attachment_name(size_t refGridIndex, size_t attachmentIndex) const;
+
+	///	returns whether the given attachment has already been read
+		bool attachment_loaded(size_t refGridIndex, size_t attachmentIndex) const;
+
+	///	reads all attachments with the given name of a grid which was already read by grid()
+	/**	Attachments which have already been read are not read again.
+	 * Since the values are assigned in the order of the elements in the grid,
+	 * this has to be done before elements are added to or removed from the grid.
+	 * \return false if the grid contains no attachment of the given name or if
+	 *			the grid has not yet been read.*/
+		bool attachment(const char* name, size_t refGridIndex);
+
 	protected:
 		struct SubsetHandlerEntry
 		{
@@ -369,6 +400,16 @@ class GridReaderUGX
 			ISelector*				sel;
 		};
 
+		struct AttachmentEntry
+		{
+			AttachmentEntry(rapidxml::xml_node<>* n, int t) :
+				node(n), elemType(t), loaded(false) {}
+
+			rapidxml::xml_node<>* 	node;
+			int						elemType;
+			bool					loaded;
+		};
+
 		struct GridEntry
 		{
 			GridEntry(rapidxml::xml_node<>* n) : node(n), grid(NULL), mg(NULL)	{}
@@ -379,6 +420,7 @@ class GridReaderUGX
 			std::vector<SubsetHandlerEntry>	subsetHandlerEntries;
 			std::vector<SelectorEntry>		selectorEntries;
 			std::vector<rapidxml::xml_node<>*>	projectionHandlerEntries;
+			std::vector<AttachmentEntry>	attachmentEntries;
 			std::vector<Vertex*> 		vertices;
 			std::vector<Edge*> 			edges;
 			std::vector<Face*>				faces;
@@ -482,6 +524,12 @@ class GridReaderUGX
 		template <class TElem>
 		bool read_attachment(Grid& grid, rapidxml::xml_node<>* node);
 
+	///	reads the given attachment entry, if it wasn't already read
+		bool read_attachment_entry(Grid& grid, AttachmentEntry& entry);
+
+	///	reads the attachments of the given grid which are selected for loading
+		bool read_selected_attachments(size_t refGridIndex);
+
 		SPRefinementProjector
 		read_projector(rapidxml::xml_node<>* projNode);
 
@@ -489,8 +537,15 @@ class GridReaderUGX
 	///	the xml_document which stores the data
 		rapidxml::xml_document<> m_doc;
 
+	///	locations of values which were not loaded into m_doc during parsing
+		UGXDeferredValues m_deferredValues;
+
 	///	holds grids which already have been created
 		std::vector<GridEntry>	m_entries;
+
+	///	if false, only attachments in m_attachmentsToLoad are read by grid()
+		bool m_loadAllAttachments;
+		std::vector<std::string>	m_attachmentsToLoad;
 };
 
 
@@ -601,11 +656,14 @@ class UGXFileInfo{
 	/**
 	 *
 	 * @param[in] vrtNode	node in the xml file (containing vertex information)
+	 * @param[in] deferred	values of the document which were not loaded during parsing
 	 * @param[out] bb		output bounding box
 	 *
 	 * @return true iff at least one valid (coordinate dimension in {0,1,2,3}) vertex is contained
 	 */
-		bool calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vector3>& bb) const;
+		bool calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode,
+										const UGXDeferredValues& deferred,
+										AABox<vector3>& bb) const;
 };
 
 }//	end of namespace
@@ -404,6 +404,10 @@ grid(Grid& gridOut, size_t index,
 //	store the grid in the grid-vector and assign indices to the vertices
 	m_entries[index].grid = &grid;
 
+//	attachments have to be loaded anew into the new grid
+	for(size_t i = 0; i < m_entries[index].attachmentEntries.size(); ++i)
+		m_entries[index].attachmentEntries[i].loaded = false;
+
 //	get the grid-node and the vertex-vector
 	xml_node<>* gridNode = m_entries[index].node;
 	vector<Vertex*>& vertices = m_entries[index].vertices;
@@ -459,21 +463,17 @@ grid(Grid& gridOut, size_t index,
 		else if(strcmp(name, "octahedrons") == 0)
 			bSuccess = create_octahedrons(volumes, grid, curNode, vertices);
 
-		else if(strcmp(name, "vertex_attachment") == 0)
-			bSuccess = read_attachment<Vertex>(grid, curNode);
-		else if(strcmp(name, "edge_attachment") == 0)
-			bSuccess = read_attachment<Edge>(grid, curNode);
-		else if(strcmp(name, "face_attachment") == 0)
-			bSuccess = read_attachment<Face>(grid, curNode);
-		else if(strcmp(name, "volume_attachment") == 0)
-			bSuccess = read_attachment<Volume>(grid, curNode);
-
-
 		if(!bSuccess){
 			grid.set_options(gridopts);
 			return false;
 		}
 	}
+
+//	attachments are indexed in new_document_parsed. Read the selected ones.
+	if(!read_selected_attachments(index)){
+		grid.set_options(gridopts);
+		return false;
+	}
 	
 //	resolve constrained object relations
 	if(!constrainingObjsVRT.empty()){
@@ -700,9 +700,9 @@ create_vertices(std::vector<Vertex*>& vrtsOut, Grid& grid,
 	if(numSrcCoords < 1 || numDestCoords < 1)
 		return false;
 
-//	create a buffer with which we can access the data
-	string str(vrtNode->value(), vrtNode->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(vrtNode, m_deferredValues);
 
 //	if numDestCoords == numSrcCoords parsing will be faster
 	if(numSrcCoords == numDestCoords){
@@ -785,9 +785,9 @@ create_constrained_vertices(std::vector<Vertex*>& vrtsOut,
 	if(numSrcCoords < 1 || numDestCoords < 1)
 		return false;
 
-//	create a buffer with which we can access the data
-	string str(vrtNode->value(), vrtNode->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a reader with which we can access the data
+	UGXValueReader ss;
+	ss.init(vrtNode, m_deferredValues);
 
 //	we have to be careful with reading.
 //	if numDestCoords < numSrcCoords we'll ignore some coords,
@@ -894,7 +894,7 @@ read_attachment(Grid& grid, rapidxml::xml_node<>* node)
 				  GlobalAttachments::type_name(name)
 				  << ", but given type is: " << type);
 
-	string str(node->value(), node->value_size());
+	string str = UGXNodeValue(node, m_deferredValues);
 	stringstream ss(str, ios_base::in);
 	GlobalAttachments::read_attachment_values<TElem>(ss, grid, name);
 
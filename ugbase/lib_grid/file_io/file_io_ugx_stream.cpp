@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include "file_io_ugx_stream.h"
+#include "common/error.h"
+
+using namespace std;
+using namespace rapidxml;
+
+namespace ug
+{
+
+///	first character of the placeholders of deferred values
+static const char UGX_DEFERRED_MARKER = '\x01';
+
+///	appends the text of a node to the markup or a placeholder, if it was deferred
+/**	Deferred texts containing entities are loaded, since their entities have
+ * to be expanded by the xml parser.*/
+static void FlushText(string& markup, string& text, bool deferred, bool hasEntity,
+					  uint64 textStart, uint64 textEnd,
+					  UGXDeferredValues& deferredOut)
+{
+	if(deferred && hasEntity){
+		ifstream in(deferredOut.filename.c_str(), ios::binary);
+		in.seekg(textStart);
+		text.resize(textEnd - textStart);
+		in.read(&text[0], text.size());
+		UG_COND_THROW(!in, "Couldn't read from file " << deferredOut.filename);
+		markup.append(text);
+	}
+	else if(deferred){
+		char placeholder[32];
+		sprintf(placeholder, "%c%lu", UGX_DEFERRED_MARKER,
+				(unsigned long)deferredOut.ranges.size());
+		markup.append(placeholder);
+		deferredOut.ranges.push_back(make_pair(textStart, textEnd - textStart));
+	}
+	else
+		markup.append(text);
+	text.clear();
+}
+
+bool ParseUGXMarkup(xml_document<>& doc, const char* filename,
+					UGXDeferredValues& deferredOut, size_t maxValueSize)
+{
+	ifstream in(filename, ios::binary);
+	if(!in)
+		return false;
+
+	deferredOut.filename = filename;
+	deferredOut.ranges.clear();
+
+	string markup;
+	string text;
+	bool deferText = false;
+	bool hasEntity = false;
+	uint64 pos = 0;
+	uint64 textStart = 0;
+
+	streambuf* sb = in.rdbuf();
+	int c;
+	while((c = sb->sbumpc()) != EOF){
+		if(c != '<'){
+			if(c == '&')
+				hasEntity = true;
+			if(!deferText){
+				text.push_back((char)c);
+				if(text.size() > maxValueSize){
+					deferText = true;
+					text.clear();
+				}
+			}
+			++pos;
+			continue;
+		}
+
+		FlushText(markup, text, deferText, hasEntity, textStart, pos, deferredOut);
+		deferText = false;
+		hasEntity = false;
+
+	//	copy the markup up to its closing '>'. Comments and CDATA sections are
+	//	closed by '-->' and ']]>'. Quoted attribute values may contain '>'.
+		const size_t markupStart = markup.size();
+		markup.push_back('<');
+		++pos;
+		char quote = 0;
+		while((c = sb->sbumpc()) != EOF){
+			markup.push_back((char)c);
+			++pos;
+
+			const char* m = markup.c_str() + markupStart;
+			const size_t len = markup.size() - markupStart;
+			if(len >= 4 && strncmp(m, "<!--", 4) == 0){
+				if(len >= 7 && c == '>' && strncmp(m + len - 3, "-->", 3) == 0)
+					break;
+			}
+			else if(len >= 9 && strncmp(m, "<![CDATA[", 9) == 0){
+				if(len >= 12 && c == '>' && strncmp(m + len - 3, "]]>", 3) == 0)
+					break;
+			}
+			else if(quote){
+				if(c == quote)
+					quote = 0;
+			}
+			else if(c == '"' || c == '\''){
+				quote = (char)c;
+			}
+			else if(c == '>'
+					&& !(len < 9 && strncmp(m, "<![CDATA[", len) == 0)
+					&& !(len < 4 && strncmp(m, "<!--", len) == 0))
+			{
+				break;
+			}
+		}
+
+		textStart = pos;
+	}
+	FlushText(markup, text, deferText, hasEntity, textStart, pos, deferredOut);
+	in.close();
+
+//	the document parses the markup in place
+	char* content = doc.allocate_string(0, markup.size() + 1);
+	memcpy(content, markup.c_str(), markup.size());
+	content[markup.size()] = 0;
+	doc.parse<0>(content);
+	return true;
+}
+
+
+///	returns the index of the deferred value of the given node or -1
+static int DeferredValueIndex(xml_node<>* node, const UGXDeferredValues& deferred)
+{
+	if(node->value_size() < 2 || node->value()[0] != UGX_DEFERRED_MARKER)
+		return -1;
+
+	int index = atoi(node->value() + 1);
+	UG_COND_THROW(index < 0 || index >= (int)deferred.ranges.size(),
+				  "Bad deferred value index in node " << node->name());
+	return index;
+}
+
+string UGXNodeValue(xml_node<>* node, const UGXDeferredValues& deferred)
+{
+	int index = DeferredValueIndex(node, deferred);
+	if(index < 0)
+		return string(node->value(), node->value_size());
+
+	ifstream in(deferred.filename.c_str(), ios::binary);
+	UG_COND_THROW(!in, "Couldn't open file " << deferred.filename);
+
+	string str((size_t)deferred.ranges[index].second, ' ');
+	in.seekg(deferred.ranges[index].first);
+	if(!str.empty())
+		in.read(&str[0], str.size());
+	UG_COND_THROW(!in, "Couldn't read from file " << deferred.filename);
+	return str;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//	UGXValueReader
+///	buffered bytes are refilled, as soon as less than this number is available
+static const size_t UGX_MAX_TOKEN_LENGTH = 128;
+static const size_t UGX_READ_BLOCK_SIZE = 1 << 16;
+
+UGXValueReader::UGXValueReader() :
+	m_cur(NULL),
+	m_end(NULL),
+	m_numRemaining(0),
+	m_fail(false)
+{
+}
+
+void UGXValueReader::
+init(xml_node<>* node, const UGXDeferredValues& deferred)
+{
+	m_fail = false;
+	m_numRemaining = 0;
+	if(m_in.is_open())
+		m_in.close();
+
+	int index = DeferredValueIndex(node, deferred);
+	if(index < 0){
+		m_cur = node->value();
+		m_end = m_cur + node->value_size();
+		return;
+	}
+
+	m_in.clear();
+	m_in.open(deferred.filename.c_str(), ios::binary);
+	UG_COND_THROW(!m_in, "Couldn't open file " << deferred.filename);
+	m_in.seekg(deferred.ranges[index].first);
+	m_numRemaining = deferred.ranges[index].second;
+
+	m_buf.resize(UGX_READ_BLOCK_SIZE);
+	m_cur = m_end = &m_buf.front();
+	fill_buffer();
+}
+
+void UGXValueReader::
+fill_buffer()
+{
+	const size_t numAvailable = m_end - m_cur;
+	if(numAvailable >= UGX_MAX_TOKEN_LENGTH || m_numRemaining == 0)
+		return;
+
+	memmove(&m_buf.front(), m_cur, numAvailable);
+	size_t numRead = min<uint64>(m_buf.size() - numAvailable, m_numRemaining);
+	m_in.read(&m_buf.front() + numAvailable, numRead);
+	UG_COND_THROW(!m_in, "Couldn't read deferred value from file.");
+
+	m_numRemaining -= numRead;
+	m_cur = &m_buf.front();
+	m_end = m_cur + numAvailable + numRead;
+}
+
+bool UGXValueReader::
+skip_whitespace()
+{
+	while(1){
+		fill_buffer();
+		while(m_cur != m_end && isspace((unsigned char)*m_cur))
+			++m_cur;
+		if(m_cur != m_end){
+		//	skipping may have consumed most of the buffer. Make sure that the
+		//	whole next token is available to the caller.
+			fill_buffer();
+			return true;
+		}
+		if(m_numRemaining == 0)
+			return false;
+	}
+}
+
+bool UGXValueReader::
+eof()
+{
+	return m_fail || !skip_whitespace();
+}
+
+void UGXValueReader::
+set_failed()
+{
+//	as with streams, all further reads fail. Since the remaining input
+//	can't be interpreted anyway, it is skipped.
+	m_fail = true;
+	m_cur = m_end;
+	m_numRemaining = 0;
+}
+
+template <class T>
+void UGXValueReader::
+read_integer(T& valOut)
+{
+	if(m_fail || !skip_whitespace()){
+		set_failed();
+		return;
+	}
+
+	bool negative = false;
+	if(*m_cur == '-' || *m_cur == '+'){
+		negative = (*m_cur == '-');
+		++m_cur;
+	}
+
+	if(m_cur == m_end || !isdigit((unsigned char)*m_cur)){
+		set_failed();
+		return;
+	}
+
+//	the magnitude is accumulated unsigned. For signed types, the magnitude of
+//	the smallest value is one larger than that of the largest value.
+	const uint64 maxVal = (uint64)std::numeric_limits<T>::max();
+	uint64 maxMagnitude = maxVal;
+	if(negative){
+		if(std::numeric_limits<T>::is_signed)
+			maxMagnitude = maxVal + 1;
+		else
+			maxMagnitude = 0;
+	}
+
+	uint64 magnitude = 0;
+	while(m_cur != m_end && isdigit((unsigned char)*m_cur)){
+		const uint64 digit = (uint64)(*m_cur - '0');
+		UG_COND_THROW(digit > maxMagnitude
+					  || magnitude > (maxMagnitude - digit) / 10,
+					  "UGXValueReader: integer value out of range for the "
+					  "requested type.");
+		magnitude = 10 * magnitude + digit;
+		++m_cur;
+	}
+
+	if(negative && magnitude > 0)
+		valOut = (T)(-(T)(magnitude - 1) - 1);
+	else
+		valOut = (T)magnitude;
+}
+
+template void UGXValueReader::read_integer<int>(int&);
+template void UGXValueReader::read_integer<long>(long&);
+template void UGXValueReader::read_integer<unsigned int>(unsigned int&);
+template void UGXValueReader::read_integer<unsigned long>(unsigned long&);
+
+void UGXValueReader::
+read_floating(double& valOut)
+{
+	static const double pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+								   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+								   1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+								   1e22};
+
+	if(m_fail || !skip_whitespace()){
+		set_failed();
+		return;
+	}
+
+	const char* tokenBegin = m_cur;
+	bool negative = false;
+	if(*m_cur == '-' || *m_cur == '+'){
+		negative = (*m_cur == '-');
+		++m_cur;
+	}
+
+//	the mantissa is collected as an integer. If it has more than 19 digits,
+//	the remaining digits are only counted.
+	uint64 mantissa = 0;
+	int numDigits = 0;
+	int numMantissaDigits = 0;
+	int exponent = 0;
+	while(m_cur != m_end && isdigit((unsigned char)*m_cur)){
+		if(numMantissaDigits < 19){
+			mantissa = 10 * mantissa + (*m_cur - '0');
+			if(mantissa > 0)
+				++numMantissaDigits;
+		}
+		else
+			++exponent;
+		++numDigits;
+		++m_cur;
+	}
+
+	if(m_cur != m_end && *m_cur == '.'){
+		++m_cur;
+		while(m_cur != m_end && isdigit((unsigned char)*m_cur)){
+			if(numMantissaDigits < 19){
+				mantissa = 10 * mantissa + (*m_cur - '0');
+				if(mantissa > 0)
+					++numMantissaDigits;
+				--exponent;
+			}
+			++numDigits;
+			++m_cur;
+		}
+	}
+
+	if(numDigits == 0){
+	//	this may still be 'inf' or 'nan', which is handled below
+		m_cur = tokenBegin;
+	}
+	else if(m_cur != m_end && (*m_cur == 'e' || *m_cur == 'E')){
+		const char* expBegin = m_cur;
+		++m_cur;
+		bool negativeExp = false;
+		if(m_cur != m_end && (*m_cur == '-' || *m_cur == '+')){
+			negativeExp = (*m_cur == '-');
+			++m_cur;
+		}
+		if(m_cur == m_end || !isdigit((unsigned char)*m_cur))
+			m_cur = expBegin;	// not an exponent
+		else{
+			int e = 0;
+			while(m_cur != m_end && isdigit((unsigned char)*m_cur)){
+				if(e < 100000)
+					e = 10 * e + (*m_cur - '0');
+				++m_cur;
+			}
+			exponent += negativeExp ? -e : e;
+		}
+	}
+
+//	fast path: the mantissa and the power of 10 are exactly representable
+//	as doubles, so that the result is correctly rounded.
+	if(numDigits > 0 && mantissa <= (uint64(1) << 53)
+	   && exponent >= -22 && exponent <= 22)
+	{
+		double val = (double)mantissa;
+		if(exponent < 0)
+			val /= pow10[-exponent];
+		else
+			val *= pow10[exponent];
+		valOut = negative ? -val : val;
+		return;
+	}
+
+//	slow path through a stream with the classic locale
+	const char* tokenEnd = (numDigits > 0) ? m_cur : tokenBegin;
+	while(tokenEnd != m_end && !isspace((unsigned char)*tokenEnd))
+		++tokenEnd;
+
+	istringstream ss(string(tokenBegin, tokenEnd));
+	ss.imbue(locale::classic());
+	double val;
+	ss >> val;
+	if(ss.fail()){
+		set_failed();
+		return;
+	}
+	m_cur = tokenEnd;
+	valOut = val;
+}
+
+}//	end of namespace
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__FILE_IO_UGX_STREAM__
+#define __H__LIB_GRID__FILE_IO_UGX_STREAM__
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <utility>
+#include "common/types.h"
+#include "common/parser/rapidxml/rapidxml.hpp"
+
+namespace ug
+{
+
+///	Locations of the large node values of a ugx file, which were not loaded into memory
+/**	Those values are replaced by a placeholder in the parsed document and are
+ * read from the file on demand through UGXValueReader or UGXNodeValue.*/
+struct UGXDeferredValues
+{
+	std::string									filename;
+	std::vector<std::pair<uint64, uint64> >		ranges;	///< offset and size
+};
+
+///	Parses the markup of a ugx file without loading large node values.
+/**	The file is read sequentially. Text values larger than maxValueSize
+ * bytes are not copied to the document. Instead their location in the file is
+ * stored in deferredOut. Values which contain entities are always loaded, since
+ * those have to be expanded by the parser.
+ *
+ * The markup is stored in memory allocated by doc.
+ *
+ * \returns false if the file couldn't be opened.*/
+bool ParseUGXMarkup(rapidxml::xml_document<>& doc, const char* filename,
+					UGXDeferredValues& deferredOut,
+					size_t maxValueSize = 4096);
+
+///	returns the complete value of the given node (loads deferred values from the file)
+std::string UGXNodeValue(rapidxml::xml_node<>* node,
+						 const UGXDeferredValues& deferred);
+
+
+///	Reads whitespace separated numbers from the value of a ugx node
+/**	Deferred values are streamed from the file in blocks. Numbers are parsed
+ * without any locale dependency. The interface resembles the one of
+ * std::istream: If a read fails, fail() returns true and all further reads
+ * are ignored. Integers which don't fit into the requested type cause an
+ * exception.*/
+class UGXValueReader
+{
+	public:
+		UGXValueReader();
+
+		void init(rapidxml::xml_node<>* node, const UGXDeferredValues& deferred);
+
+	///	returns true if only whitespace remains
+		bool eof();
+		bool fail() const		{return m_fail;}
+
+		UGXValueReader& operator>>(int& valOut)				{read_integer(valOut); return *this;}
+		UGXValueReader& operator>>(long& valOut)			{read_integer(valOut); return *this;}
+		UGXValueReader& operator>>(unsigned int& valOut)	{read_integer(valOut); return *this;}
+		UGXValueReader& operator>>(unsigned long& valOut)	{read_integer(valOut); return *this;}
+		UGXValueReader& operator>>(double& valOut)			{read_floating(valOut); return *this;}
+		UGXValueReader& operator>>(float& valOut)
+		{
+			double d = 0;
+			read_floating(d);
+			if(!m_fail)
+				valOut = (float)d;
+			return *this;
+		}
+
+	private:
+		UGXValueReader(const UGXValueReader&);
+		UGXValueReader& operator=(const UGXValueReader&);
+
+	///	makes sure that either enough chars for a number are buffered or the input is exhausted
+		void fill_buffer();
+
+	///	returns false if the end of the input was reached
+		bool skip_whitespace();
+
+		void set_failed();
+
+		template <class T>
+		void read_integer(T& valOut);
+
+		void read_floating(double& valOut);
+
+	private:
+		const char*			m_cur;
+		const char*			m_end;
+		std::ifstream		m_in;
+		uint64				m_numRemaining;	///< bytes which still have to be read from m_in
+		std::vector<char>	m_buf;
+		bool				m_fail;
+};
+
+}//	end of namespace
+
+#endif
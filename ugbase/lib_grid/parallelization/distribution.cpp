@@ -30,6 +30,7 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <list>
 #include <sstream>
 #include "common/static_assert.h"
 #include "common/util/table.h"
@@ -1795,242 +1796,111 @@ static void SynchronizeAttachedGlobalAttachments (
 	UG_DLOG(LG_DIST, 1, "SynchronizeAttachedGlobalAttachments end\n");
 }
 
-
-////////////////////////////////////////////////////////////////////////////////
-bool DistributeGrid(MultiGrid& mg,
-					SubsetHandler& shPartition,
-					GridDataSerializationHandler& serializer,
-					bool createVerticalInterfaces,
-					const std::vector<int>* processMap,
-					const pcl::ProcessCommunicator& procComm)
+//	the magic numbers are used for debugging to make sure that the stream is read correctly
+static const int DIST_MAGIC_NUMBER_1 = 75234587;
+static const int DIST_MAGIC_NUMBER_2 = 560245;
+
+///	serializes the elements of the given partition and all associated data to 'out'
+static void SerializePartition(
+				BinaryBuffer& out,
+				MultiGrid& mg,
+				MGSelector& msel,
+				SubsetHandler& shPartition,
+				int partInd,
+				bool createVerticalInterfaces,
+				MultiElementAttachmentAccessor<AInt>& aaInt,
+				MultiElementAttachmentAccessor<AGeomObjID>& aaID,
+				GridDataSerializationHandler& distInfoSerializer,
+				GridDataSerializationHandler& serializer,
+				GridDataSerializationHandler& userDataSerializer)
 {
-	GDIST_PROFILE_FUNC();
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE(performRedistribution);
-	UG_STATIC_ASSERT(IS_DUMMY < 256, RedistributeGrid_IS_DUMMY_too_big);
-
-	UG_DLOG(LG_DIST, 3, "dist-start: DistributeGrid\n");
-	const char* errprefix = "ERROR in DistributeGrid: ";
-
-	if(!mg.is_parallel()){
-		UG_THROW(errprefix << "Can't distribute a serial grid! Compile ug with -DPARALLEL=ON");
-	}
-
-
-	UG_DLOG(LG_DIST, 2, "dist: Informing msg-hub that distribution starts\n");
-	GDIST_PROFILE(gdist_distStartsCallback);
-	GridDataSerializationHandler	userDataSerializer;
-//	add global attachments to the user-data-serializer
-	SynchronizeAttachedGlobalAttachments(mg, procComm);
-	AddGlobalAttachmentsToSerializer<Vertex>(userDataSerializer, mg);
-	AddGlobalAttachmentsToSerializer<Edge>(userDataSerializer, mg);
-	AddGlobalAttachmentsToSerializer<Face>(userDataSerializer, mg);
-	AddGlobalAttachmentsToSerializer<Volume>(userDataSerializer, mg);
-
-	SPMessageHub msgHub = mg.message_hub();
-	msgHub->post_message(GridMessage_Distribution(GMDT_DISTRIBUTION_STARTS, userDataSerializer));
-
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
-
-
-	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
-	GridLayoutMap& glm = distGridMgr.grid_layout_map();
-
-//	The selector will be of frequent use to speed up some algorithms
-	MGSelector msel(mg);
-
-	#ifdef LG_DISTRIBUTION_DEBUG
-		PerformValidityCheck(distGridMgr);
-	#endif
-
-//	Since we will change huge parts of the underlying grid and the grid-layout-map,
-//	we'll disable auto-insertion of elements in the distributed-grid-manager.
-//	This means we carefully have to take care of all interface changes.
-	distGridMgr.enable_interface_management(false);
-
-////////////////////////////////
-//	GLOBAL IDS
-//todo:	only create global ids if they aren't already present
-	GDIST_PROFILE(gdist_CreateGlobalIDs);
-	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Create global vertex ids\n");
-	CreateAndDistributeGlobalIDs<Vertex>(mg, glm);
-	CreateAndDistributeGlobalIDs<Edge>(mg, glm);
-	CreateAndDistributeGlobalIDs<Face>(mg, glm);
-	CreateAndDistributeGlobalIDs<Volume>(mg, glm);
-	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aGeomObjID);
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
-
-
-	#ifdef LG_DISTRIBUTION_DEBUG
-	{
-		UG_LOG("DEBUG: WRITING GLOBAL VERTEX IDS TO FILE\n");
-		stringstream ss;
-		ss << "global_ids_vrt_p" << pcl::ProcRank() << ".txt";
-		WriteDebugValuesToFile<Vertex>(ss.str().c_str(), mg, aGeomObjID, false);
-	}
-	{
-		UG_LOG("DEBUG: WRITING GLOBAL EDGE IDS TO FILE\n");
-		stringstream ss;
-		ss << "global_ids_edge_p" << pcl::ProcRank() << ".txt";
-		WriteDebugValuesToFile<Edge>(ss.str().c_str(), mg, aGeomObjID, false);
-	}
-	{
-		UG_LOG("DEBUG: WRITING GLOBAL FACE IDS TO FILE\n");
-		stringstream ss;
-		ss << "global_ids_face_p" << pcl::ProcRank() << ".txt";
-		WriteDebugValuesToFile<Face>(ss.str().c_str(), mg, aGeomObjID, false);
-	}
-	#endif
-
-////////////////////////////////
-//	FILL THE DISTRIBUTION INFOS (INVOLVES COMMUNICATION...)
-	GDIST_PROFILE(gdist_FillDistInfos);
-	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Fill distribution infos\n");
-	vector<bool> partitionIsEmpty;
-	DistInfoSupplier distInfos(mg);
-	FillDistInfos(mg, shPartition, msel, distInfos, processMap, procComm,
-				  createVerticalInterfaces, partitionIsEmpty);
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
-
-//	DEBUG: output distInfos...
-	#ifdef LG_DISTRIBUTION_DEBUG
-	{
-		SaveDistInfosToFile(mg, distInfos, "dist_infos_before_distribution");
-	}
-	#endif
-
-////////////////////////////////
-//	COMMUNICATE INVOLVED PROCESSES
-	GDIST_PROFILE(gdist_CommunicateInvolvedProcs);
-	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: CommunicateInvolvedProcesses\n");
+//	write a magic number for debugging purposes
+	out.write((char*)&DIST_MAGIC_NUMBER_1, sizeof(int));
+
+//	select the elements of the current partition
+	msel.clear();
+	SelectElementsForTargetPartition(msel, shPartition, partInd,
+								 false, createVerticalInterfaces);
+	//AdjustGhostSelection(msel, ISelector::DESELECTED);
+
+	SerializeMultiGridElements(mg, msel.get_grid_objects(), aaInt, out, &aaID);
+
+//	serialize associated data
+	distInfoSerializer.write_infos(out);
+	distInfoSerializer.serialize(out, msel.get_grid_objects());
+	serializer.write_infos(out);
+	serializer.serialize(out, msel.get_grid_objects());
+	userDataSerializer.write_infos(out);
+	userDataSerializer.serialize(out, msel.get_grid_objects());
+
+//	write a magic number for debugging purposes
+	out.write((char*)&DIST_MAGIC_NUMBER_2, sizeof(int));
+}
 
-//	each process has to know with which other processes it
-//	has to communicate.
-	vector<int> sendToRanks, recvFromRanks, sendPartitionInds;
+///	deserializes a partition which was serialized through SerializePartition
+static void DeserializePartition(
+				BinaryBuffer& in,
+				MultiGrid& mg,
+				MultiElementAttachmentAccessor<AGeomObjID>& aaID,
+				GridDataSerializationHandler& distInfoSerializer,
+				GridDataSerializationHandler& serializer,
+				GridDataSerializationHandler& userDataSerializer)
+{
+	vector<Vertex*>	vrts;
+	vector<Edge*> edges;
+	vector<Face*> faces;
+	vector<Volume*> vols;
 
-	if(processMap && (shPartition.num_subsets() > (int)processMap->size())){
-		UG_THROW("process-map is too small for the given number of partitions!");
+//	read the magic number and make sure that it matches our magicNumber
+	int tmp = 0;
+	in.read((char*)&tmp, sizeof(int));
+	if(tmp != DIST_MAGIC_NUMBER_1){
+		UG_THROW("ERROR in RedistributeGrid: "
+				 "Magic number mismatch before deserialization.\n");
 	}
 
-//	for each subset which is not emtpy we'll have to send data to
-//	the associated process.
-	for(int si = 0; si < shPartition.num_subsets(); ++si){
-	//	instead of simply querying shPartition.empty(si), we'll check partitionIsEmpty[si],
-	//	since this array tells whether data is actually sent to a partition.
-	//	E.g. vmasters which are contained in shPartition are not necessarily sent
-	//	to the associated target process...
-		if(!partitionIsEmpty[si]){
-			int toProc = si;
-		//	if a process map exists, we'll use the associated process
-			if(processMap)
-				toProc = processMap->at(si);
-
-			sendToRanks.push_back(toProc);
-			sendPartitionInds.push_back(si);
-		}
+	DeserializeMultiGridElements(mg, in, &vrts, &edges, &faces, &vols, &aaID);
+
+//	deserialize the associated data (global ids have already been deserialized)
+	distInfoSerializer.read_infos(in);
+	distInfoSerializer.deserialize(in, vrts.begin(), vrts.end());
+	distInfoSerializer.deserialize(in, edges.begin(), edges.end());
+	distInfoSerializer.deserialize(in, faces.begin(), faces.end());
+	distInfoSerializer.deserialize(in, vols.begin(), vols.end());
+
+	serializer.read_infos(in);
+	serializer.deserialize(in, vrts.begin(), vrts.end());
+	serializer.deserialize(in, edges.begin(), edges.end());
+	serializer.deserialize(in, faces.begin(), faces.end());
+	serializer.deserialize(in, vols.begin(), vols.end());
+
+	userDataSerializer.read_infos(in);
+	userDataSerializer.deserialize(in, vrts.begin(), vrts.end());
+	userDataSerializer.deserialize(in, edges.begin(), edges.end());
+	userDataSerializer.deserialize(in, faces.begin(), faces.end());
+	userDataSerializer.deserialize(in, vols.begin(), vols.end());
+
+//	read the magic number and make sure that it matches our magicNumber
+	tmp = 0;
+	in.read((char*)&tmp, sizeof(int));
+	if(tmp != DIST_MAGIC_NUMBER_2){
+		UG_THROW("ERROR in RedistributeGrid: "
+				 "Magic number mismatch after deserialization.\n");
 	}
-
-	pcl::CommunicateInvolvedProcesses(recvFromRanks, sendToRanks, procComm);
-
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
-
-
-////////////////////////////////
-//	SERIALIZE THE GRID, THE GLOBAL IDS AND THE DISTRIBUTION INFOS.
-	GDIST_PROFILE(gdist_Serialization);
-	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Serialization\n");
-	AInt aLocalInd("distribution-tmp-local-index");
-	mg.attach_to_all(aLocalInd);
-	MultiElementAttachmentAccessor<AInt> aaInt(mg, aLocalInd);
-
-//	outBufs will be used to serialize and distribute the grid.
-//	don't resize outBufs later on! Would be expensive!
-	std::vector<BinaryBuffer> outBufs(sendToRanks.size());
-
-//	the magic number is used for debugging to make sure that the stream is read correctly
-	int magicNumber1 = 75234587;
-	int magicNumber2 = 560245;
-
-	ADistInfo aDistInfo = distInfos.dist_info_attachment();
-
-	GridDataSerializationHandler distInfoSerializer;
-	distInfoSerializer.add(GeomObjAttachmentSerializer<Vertex, ADistInfo>::create(mg, aDistInfo));
-	distInfoSerializer.add(GeomObjAttachmentSerializer<Edge, ADistInfo>::create(mg, aDistInfo));
-	distInfoSerializer.add(GeomObjAttachmentSerializer<Face, ADistInfo>::create(mg, aDistInfo));
-	distInfoSerializer.add(GeomObjAttachmentSerializer<Volume, ADistInfo>::create(mg, aDistInfo));
-
-//	now perform the serialization
-	int localPartitionInd = -1;
-	for(size_t i_to = 0; i_to < sendPartitionInds.size(); ++i_to){
-		int partInd = sendPartitionInds[i_to];
-		bool localPartition = (sendToRanks[i_to] == pcl::ProcRank());
-		if(localPartition)
-			localPartitionInd = partInd;
-
-	//	don't serialize the local partition since we'll keep it here on the local
-	//	process anyways.
-		if(!localPartition){
-			BinaryBuffer& out = outBufs[i_to];
-
-		//	write a magic number for debugging purposes
-			out.write((char*)&magicNumber1, sizeof(int));
-
-		//	select the elements of the current partition
-			msel.clear();
-			SelectElementsForTargetPartition(msel, shPartition, partInd,
-										 localPartition, createVerticalInterfaces);
-			//AdjustGhostSelection(msel, ISelector::DESELECTED);
-
-			SerializeMultiGridElements(mg, msel.get_grid_objects(), aaInt, out, &aaID);
-
-
-		//	serialize associated data
-			distInfoSerializer.write_infos(out);
-			distInfoSerializer.serialize(out, msel.get_grid_objects());
-			serializer.write_infos(out);
-			serializer.serialize(out, msel.get_grid_objects());
-			userDataSerializer.write_infos(out);
-			userDataSerializer.serialize(out, msel.get_grid_objects());
-
-		//	write a magic number for debugging purposes
-			out.write((char*)&magicNumber2, sizeof(int));
-		}
-	}
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
-
-
-
-////////////////////////////////
-//	COMMUNICATE SERIALIZED DATA
-	GDIST_PROFILE(gdist_CommunicateSerializedData);
-	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Distribute data\n");
-//	now distribute the packs between involved processes
-	std::vector<BinaryBuffer> inBufs(recvFromRanks.size());
-
-	procComm.distribute_data(GetDataPtr(inBufs), GetDataPtr(recvFromRanks),
-							(int)recvFromRanks.size(),
-							GetDataPtr(outBufs), GetDataPtr(sendToRanks),
-							(int)sendToRanks.size());
-
-//	clear out-buffers, since they are no longer needed
-	for(size_t i = 0; i < outBufs.size(); ++i)
-		outBufs[i] = BinaryBuffer();
-
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
+}
 
 
-////////////////////////////////
-//	INTERMEDIATE CLEANUP
+///	removes all elements from the local grid which don't stay on the local process
+/**	Has to be called after all outgoing partitions have been serialized and
+ * before incoming partitions are deserialized.*/
+static void IntermediateCleanup(MultiGrid& mg, MGSelector& msel,
+								SubsetHandler& shPartition, int localPartitionInd,
+								bool createVerticalInterfaces, GridLayoutMap& glm)
+{
 	GDIST_PROFILE(gdist_IntermediateCleanup);
 	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Intermediate cleanup\n");
 
-	msgHub->post_message(GridMessage_Creation(GMCT_CREATION_STARTS));
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS));
 
 //	we have to remove all elements which won't stay on the local process.
 //	To do so, we'll first select all elements that stay, invert that selection
@@ -2197,9 +2067,350 @@ bool DistributeGrid(MultiGrid& mg,
 		glm.clear();
 		GDIST_PROFILE_END();
 	}
+	GDIST_PROFILE_END();
+}
+
+///	deserializes the received partitions and releases their buffers
+static void DeserializeReceivedPartitions(
+				std::list<std::vector<BinaryBuffer> >& inBufBlocks,
+				std::list<std::vector<int> >& recvRankBlocks,
+				size_t& numBufferedInBytes,
+				MultiGrid& mg,
+				MultiElementAttachmentAccessor<AGeomObjID>& aaID,
+				GridDataSerializationHandler& distInfoSerializer,
+				GridDataSerializationHandler& serializer,
+				GridDataSerializationHandler& userDataSerializer)
+{
+	GDIST_PROFILE(gdist_Deserialize);
+	std::list<std::vector<int> >::iterator rankIter = recvRankBlocks.begin();
+	for(std::list<std::vector<BinaryBuffer> >::iterator blockIter = inBufBlocks.begin();
+		blockIter != inBufBlocks.end(); ++blockIter, ++rankIter)
+	{
+		vector<BinaryBuffer>& inBufs = *blockIter;
+		vector<int>& roundRecvFromRanks = *rankIter;
+		for(size_t i = 0; i < inBufs.size(); ++i){
+		//	there is nothing to serialize from the local rank
+			if(roundRecvFromRanks[i] == pcl::ProcRank())
+				continue;
+
+			UG_DLOG(LG_DIST, 2, "Deserializing from rank " << roundRecvFromRanks[i] << "\n");
+			DeserializePartition(inBufs[i], mg, aaID, distInfoSerializer,
+								 serializer, userDataSerializer);
+			UG_DLOG(LG_DIST, 2, "Deserialization from rank " << roundRecvFromRanks[i] << " done\n");
+
+		//	clear the in-buffer, since it is no longer needed
+			numBufferedInBytes -= inBufs[i].write_pos();
+			inBufs[i] = BinaryBuffer();
+		}
+	}
+	inBufBlocks.clear();
+	recvRankBlocks.clear();
+	GDIST_PROFILE_END();
+}
+
+
+std::string DistributionStatistics::
+to_string() const
+{
+	stringstream ss;
+	ss << "rounds: " << numRounds
+	   << ", parts sent: " << numSentParts
+	   << ", parts received: " << numReceivedParts
+	   << ", bytes sent: " << bytesSent
+	   << ", bytes received: " << bytesReceived
+	   << ", max buffered bytes: " << maxBufferedBytes;
+	return ss.str();
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+bool DistributeGrid(MultiGrid& mg,
+					SubsetHandler& shPartition,
+					GridDataSerializationHandler& serializer,
+					bool createVerticalInterfaces,
+					const std::vector<int>* processMap,
+					const pcl::ProcessCommunicator& procComm,
+					size_t maxBufferSize,
+					DistributionStatistics* statsOut)
+{
+	GDIST_PROFILE_FUNC();
+	PCL_DEBUG_BARRIER(procComm);
+	GDIST_PROFILE(performRedistribution);
+	UG_STATIC_ASSERT(IS_DUMMY < 256, RedistributeGrid_IS_DUMMY_too_big);
+
+	UG_DLOG(LG_DIST, 3, "dist-start: DistributeGrid\n");
+	const char* errprefix = "ERROR in DistributeGrid: ";
+
+	if(!mg.is_parallel()){
+		UG_THROW(errprefix << "Can't distribute a serial grid! Compile ug with -DPARALLEL=ON");
+	}
+
+
+	UG_DLOG(LG_DIST, 2, "dist: Informing msg-hub that distribution starts\n");
+	GDIST_PROFILE(gdist_distStartsCallback);
+	GridDataSerializationHandler	userDataSerializer;
+//	add global attachments to the user-data-serializer
+	SynchronizeAttachedGlobalAttachments(mg, procComm);
+	AddGlobalAttachmentsToSerializer<Vertex>(userDataSerializer, mg);
+	AddGlobalAttachmentsToSerializer<Edge>(userDataSerializer, mg);
+	AddGlobalAttachmentsToSerializer<Face>(userDataSerializer, mg);
+	AddGlobalAttachmentsToSerializer<Volume>(userDataSerializer, mg);
+
+	SPMessageHub msgHub = mg.message_hub();
+	msgHub->post_message(GridMessage_Distribution(GMDT_DISTRIBUTION_STARTS, userDataSerializer));
+
+	PCL_DEBUG_BARRIER(procComm);
+	GDIST_PROFILE_END();
+
+
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	GridLayoutMap& glm = distGridMgr.grid_layout_map();
+
+//	The selector will be of frequent use to speed up some algorithms
+	MGSelector msel(mg);
+
+	#ifdef LG_DISTRIBUTION_DEBUG
+		PerformValidityCheck(distGridMgr);
+	#endif
+
+//	Since we will change huge parts of the underlying grid and the grid-layout-map,
+//	we'll disable auto-insertion of elements in the distributed-grid-manager.
+//	This means we carefully have to take care of all interface changes.
+	distGridMgr.enable_interface_management(false);
+
+////////////////////////////////
+//	GLOBAL IDS
+//todo:	only create global ids if they aren't already present
+	GDIST_PROFILE(gdist_CreateGlobalIDs);
+	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Create global vertex ids\n");
+	CreateAndDistributeGlobalIDs<Vertex>(mg, glm);
+	CreateAndDistributeGlobalIDs<Edge>(mg, glm);
+	CreateAndDistributeGlobalIDs<Face>(mg, glm);
+	CreateAndDistributeGlobalIDs<Volume>(mg, glm);
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aGeomObjID);
+	PCL_DEBUG_BARRIER(procComm);
+	GDIST_PROFILE_END();
+
+
+	#ifdef LG_DISTRIBUTION_DEBUG
+	{
+		UG_LOG("DEBUG: WRITING GLOBAL VERTEX IDS TO FILE\n");
+		stringstream ss;
+		ss << "global_ids_vrt_p" << pcl::ProcRank() << ".txt";
+		WriteDebugValuesToFile<Vertex>(ss.str().c_str(), mg, aGeomObjID, false);
+	}
+	{
+		UG_LOG("DEBUG: WRITING GLOBAL EDGE IDS TO FILE\n");
+		stringstream ss;
+		ss << "global_ids_edge_p" << pcl::ProcRank() << ".txt";
+		WriteDebugValuesToFile<Edge>(ss.str().c_str(), mg, aGeomObjID, false);
+	}
+	{
+		UG_LOG("DEBUG: WRITING GLOBAL FACE IDS TO FILE\n");
+		stringstream ss;
+		ss << "global_ids_face_p" << pcl::ProcRank() << ".txt";
+		WriteDebugValuesToFile<Face>(ss.str().c_str(), mg, aGeomObjID, false);
+	}
+	#endif
+
+////////////////////////////////
+//	FILL THE DISTRIBUTION INFOS (INVOLVES COMMUNICATION...)
+	GDIST_PROFILE(gdist_FillDistInfos);
+	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Fill distribution infos\n");
+	vector<bool> partitionIsEmpty;
+	DistInfoSupplier distInfos(mg);
+	FillDistInfos(mg, shPartition, msel, distInfos, processMap, procComm,
+				  createVerticalInterfaces, partitionIsEmpty);
+	PCL_DEBUG_BARRIER(procComm);
+	GDIST_PROFILE_END();
+
+//	DEBUG: output distInfos...
+	#ifdef LG_DISTRIBUTION_DEBUG
+	{
+		SaveDistInfosToFile(mg, distInfos, "dist_infos_before_distribution");
+	}
+	#endif
+
+////////////////////////////////
+//	COMMUNICATE INVOLVED PROCESSES
+	GDIST_PROFILE(gdist_CommunicateInvolvedProcs);
+	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: CommunicateInvolvedProcesses\n");
+
+//	each process has to know with which other processes it
+//	has to communicate.
+	vector<int> sendToRanks, recvFromRanks, sendPartitionInds;
+
+	if(processMap && (shPartition.num_subsets() > (int)processMap->size())){
+		UG_THROW("process-map is too small for the given number of partitions!");
+	}
+
+//	for each subset which is not emtpy we'll have to send data to
+//	the associated process.
+	for(int si = 0; si < shPartition.num_subsets(); ++si){
+	//	instead of simply querying shPartition.empty(si), we'll check partitionIsEmpty[si],
+	//	since this array tells whether data is actually sent to a partition.
+	//	E.g. vmasters which are contained in shPartition are not necessarily sent
+	//	to the associated target process...
+		if(!partitionIsEmpty[si]){
+			int toProc = si;
+		//	if a process map exists, we'll use the associated process
+			if(processMap)
+				toProc = processMap->at(si);
+
+			sendToRanks.push_back(toProc);
+			sendPartitionInds.push_back(si);
+		}
+	}
+
+//	if data is sent in multiple rounds, involved processes are communicated per round.
+	if(maxBufferSize == 0)
+		pcl::CommunicateInvolvedProcesses(recvFromRanks, sendToRanks, procComm);
+
 	PCL_DEBUG_BARRIER(procComm);
 	GDIST_PROFILE_END();
 
+
+////////////////////////////////
+//	SERIALIZE THE GRID, THE GLOBAL IDS AND THE DISTRIBUTION INFOS
+//	AND COMMUNICATE SERIALIZED DATA
+	AInt aLocalInd("distribution-tmp-local-index");
+	mg.attach_to_all(aLocalInd);
+	MultiElementAttachmentAccessor<AInt> aaInt(mg, aLocalInd);
+
+	ADistInfo aDistInfo = distInfos.dist_info_attachment();
+
+	GridDataSerializationHandler distInfoSerializer;
+	distInfoSerializer.add(GeomObjAttachmentSerializer<Vertex, ADistInfo>::create(mg, aDistInfo));
+	distInfoSerializer.add(GeomObjAttachmentSerializer<Edge, ADistInfo>::create(mg, aDistInfo));
+	distInfoSerializer.add(GeomObjAttachmentSerializer<Face, ADistInfo>::create(mg, aDistInfo));
+	distInfoSerializer.add(GeomObjAttachmentSerializer<Volume, ADistInfo>::create(mg, aDistInfo));
+
+	int localPartitionInd = -1;
+	for(size_t i_to = 0; i_to < sendPartitionInds.size(); ++i_to){
+		if(sendToRanks[i_to] == pcl::ProcRank())
+			localPartitionInd = sendPartitionInds[i_to];
+	}
+
+//	outBufs will be used to serialize and distribute the grid.
+//	don't resize outBufs later on! Would be expensive!
+	std::vector<BinaryBuffer> outBufs(sendToRanks.size());
+
+//	received data is stored in one block of buffers per communication round.
+//	A list is used, since blocks thus don't have to be copied when new ones are added.
+	std::list<std::vector<BinaryBuffer> >	inBufBlocks;
+	std::list<std::vector<int> >			recvRankBlocks;
+
+	DistributionStatistics stats;
+	size_t numBufferedInBytes = 0;
+
+//	the local grid can only be cleared and receive data, once all outgoing
+//	partitions have been serialized.
+	bool localGridCleared = false;
+
+//	outgoing partitions are serialized and sent in rounds. Each round serializes
+//	partitions until maxBufferSize is reached. If maxBufferSize == 0, all
+//	partitions are sent in one round.
+	size_t roundBegin = 0;
+	while(1){
+		GDIST_PROFILE(gdist_Serialization);
+		UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Serialization\n");
+		size_t roundEnd = roundBegin;
+		size_t numBufferedOutBytes = 0;
+		while((roundEnd < sendToRanks.size())
+			  && ((maxBufferSize == 0) || (numBufferedOutBytes < maxBufferSize)))
+		{
+		//	don't serialize the local partition since we'll keep it here on the local
+		//	process anyways.
+			if(sendToRanks[roundEnd] != pcl::ProcRank()){
+				BinaryBuffer& out = outBufs[roundEnd];
+				SerializePartition(out, mg, msel, shPartition, sendPartitionInds[roundEnd],
+								   createVerticalInterfaces, aaInt, aaID,
+								   distInfoSerializer, serializer, userDataSerializer);
+				numBufferedOutBytes += out.write_pos();
+				++stats.numSentParts;
+			}
+			++roundEnd;
+		}
+		PCL_DEBUG_BARRIER(procComm);
+		GDIST_PROFILE_END();
+
+	////////////////////////////////
+	//	COMMUNICATE SERIALIZED DATA
+		GDIST_PROFILE(gdist_CommunicateSerializedData);
+		UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Distribute data\n");
+		vector<int> roundRecvFromRanks;
+		int* roundSendToRanks = GetDataPtr(sendToRanks) + roundBegin;
+		int numRoundSendTos = (int)(roundEnd - roundBegin);
+		if(maxBufferSize == 0)
+			roundRecvFromRanks = recvFromRanks;
+		else{
+			vector<int> tmpSendToRanks(roundSendToRanks, roundSendToRanks + numRoundSendTos);
+			pcl::CommunicateInvolvedProcesses(roundRecvFromRanks, tmpSendToRanks, procComm);
+		}
+
+		recvRankBlocks.push_back(roundRecvFromRanks);
+		inBufBlocks.push_back(vector<BinaryBuffer>());
+		vector<BinaryBuffer>& inBufs = inBufBlocks.back();
+		inBufs.resize(roundRecvFromRanks.size());
+
+	//	now distribute the packs between involved processes
+		procComm.distribute_data(GetDataPtr(inBufs), GetDataPtr(roundRecvFromRanks),
+								(int)roundRecvFromRanks.size(),
+								GetDataPtr(outBufs) + roundBegin, roundSendToRanks,
+								numRoundSendTos);
+
+		for(size_t i = 0; i < inBufs.size(); ++i){
+			if(roundRecvFromRanks[i] != pcl::ProcRank()){
+				numBufferedInBytes += inBufs[i].write_pos();
+				stats.bytesReceived += inBufs[i].write_pos();
+				++stats.numReceivedParts;
+			}
+		}
+
+		++stats.numRounds;
+		stats.bytesSent += numBufferedOutBytes;
+		stats.maxBufferedBytes = max(stats.maxBufferedBytes,
+									 numBufferedOutBytes + numBufferedInBytes);
+
+	//	clear out-buffers, since they are no longer needed
+		for(size_t i = roundBegin; i < roundEnd; ++i)
+			outBufs[i] = BinaryBuffer();
+
+		PCL_DEBUG_BARRIER(procComm);
+		GDIST_PROFILE_END();
+
+		roundBegin = roundEnd;
+
+	//	once all outgoing partitions are serialized, the local grid is no longer
+	//	needed for serialization. Received partitions of this and all following
+	//	rounds are thus deserialized and released directly.
+		if(maxBufferSize > 0 && roundBegin >= sendToRanks.size()){
+			if(!localGridCleared){
+				IntermediateCleanup(mg, msel, shPartition, localPartitionInd,
+									createVerticalInterfaces, glm);
+				distInfoSerializer.deserialization_starts();
+				serializer.deserialization_starts();
+				userDataSerializer.deserialization_starts();
+				localGridCleared = true;
+			}
+			DeserializeReceivedPartitions(inBufBlocks, recvRankBlocks, numBufferedInBytes,
+										  mg, aaID, distInfoSerializer, serializer,
+										  userDataSerializer);
+		}
+
+		if(maxBufferSize == 0)
+			break;
+
+	//	all processes have to take part in each round
+		int localDone = (roundBegin >= sendToRanks.size()) ? 1 : 0;
+		if(procComm.allreduce(localDone, PCL_RO_MIN) == 1)
+			break;
+	}
+
+	UG_DLOG(LG_DIST, 1, "dist-DistributeGrid: " << stats.to_string() << "\n");
+
+
+
 //	DEBUGGING...
 	// {
 	// 	static int counter = 0;
@@ -2212,71 +2423,21 @@ bool DistributeGrid(MultiGrid& mg,
 
 ////////////////////////////////
 //	DESERIALIZE INCOMING GRIDS
-	GDIST_PROFILE(gdist_Deserialize);
-	distInfoSerializer.deserialization_starts();
-	serializer.deserialization_starts();
-	userDataSerializer.deserialization_starts();
-
-	vector<Vertex*>	vrts;
-	vector<Edge*> edges;
-	vector<Face*> faces;
-	vector<Volume*> vols;
-
-	for(size_t i = 0; i < recvFromRanks.size(); ++i){
-	//	there is nothing to serialize from the local rank
-		if(recvFromRanks[i] == pcl::ProcRank())
-			continue;
-
-		BinaryBuffer& in = inBufs[i];
-
-		UG_DLOG(LG_DIST, 2, "Deserializing from rank " << recvFromRanks[i] << "\n");
-
-	//	read the magic number and make sure that it matches our magicNumber
-		int tmp = 0;
-		in.read((char*)&tmp, sizeof(int));
-		if(tmp != magicNumber1){
-			UG_THROW("ERROR in RedistributeGrid: "
-					 "Magic number mismatch before deserialization.\n");
-		}
-
-		DeserializeMultiGridElements(mg, in, &vrts, &edges, &faces, &vols, &aaID);
-
-	//	deserialize the associated data (global ids have already been deserialized)
-		distInfoSerializer.read_infos(in);
-		distInfoSerializer.deserialize(in, vrts.begin(), vrts.end());
-		distInfoSerializer.deserialize(in, edges.begin(), edges.end());
-		distInfoSerializer.deserialize(in, faces.begin(), faces.end());
-		distInfoSerializer.deserialize(in, vols.begin(), vols.end());
-
-		serializer.read_infos(in);
-		serializer.deserialize(in, vrts.begin(), vrts.end());
-		serializer.deserialize(in, edges.begin(), edges.end());
-		serializer.deserialize(in, faces.begin(), faces.end());
-		serializer.deserialize(in, vols.begin(), vols.end());
-
-		userDataSerializer.read_infos(in);
-		userDataSerializer.deserialize(in, vrts.begin(), vrts.end());
-		userDataSerializer.deserialize(in, edges.begin(), edges.end());
-		userDataSerializer.deserialize(in, faces.begin(), faces.end());
-		userDataSerializer.deserialize(in, vols.begin(), vols.end());
-
-	//	read the magic number and make sure that it matches our magicNumber
-		tmp = 0;
-		in.read((char*)&tmp, sizeof(int));
-		if(tmp != magicNumber2){
-			UG_THROW("ERROR in RedistributeGrid: "
-					 "Magic number mismatch after deserialization.\n");
-		}
-
-		UG_DLOG(LG_DIST, 2, "Deserialization from rank " << recvFromRanks[i] << " done\n");
+//	processes which only finished serialization in the last round clean up now.
+	if(!localGridCleared){
+		IntermediateCleanup(mg, msel, shPartition, localPartitionInd,
+							createVerticalInterfaces, glm);
+		distInfoSerializer.deserialization_starts();
+		serializer.deserialization_starts();
+		userDataSerializer.deserialization_starts();
+		localGridCleared = true;
 	}
 
-	//	clear in-buffers, since they are no longer needed
-	for(size_t i = 0; i < inBufs.size(); ++i)
-		inBufs[i] = BinaryBuffer();
+	DeserializeReceivedPartitions(inBufBlocks, recvRankBlocks, numBufferedInBytes,
+								  mg, aaID, distInfoSerializer, serializer,
+								  userDataSerializer);
 
 	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
 
 //	DEBUG: output distInfos...
 	#ifdef LG_DISTRIBUTION_DEBUG
@@ -2344,6 +2505,9 @@ bool DistributeGrid(MultiGrid& mg,
 	PCL_DEBUG_BARRIER(procComm);
 	GDIST_PROFILE_END();
 
+	if(statsOut)
+		*statsOut = stats;
+
 	UG_DLOG(LG_DIST, 3, "dist-stop: DistributeGrid\n");
 	return true;
 }
@@ -33,6 +33,7 @@
 #ifndef __H__UG__distribution__
 #define __H__UG__distribution__
 
+#include <string>
 #include <vector>
 #include "lib_grid/lg_base.h"
 #include "lib_grid/algorithms/serialization.h"
@@ -51,6 +52,22 @@ enum InterfaceStates{
 };
 
 
+///	Statistics on the data which was moved by the local process during DistributeGrid
+struct DistributionStatistics{
+	DistributionStatistics() :
+		numRounds(0), numSentParts(0), numReceivedParts(0),
+		bytesSent(0), bytesReceived(0), maxBufferedBytes(0)	{}
+
+	size_t	numRounds;			///< number of communication rounds
+	size_t	numSentParts;		///< number of partitions sent to other processes
+	size_t	numReceivedParts;	///< number of partitions received from other processes
+	size_t	bytesSent;			///< total number of serialized bytes sent
+	size_t	bytesReceived;		///< total number of serialized bytes received
+	size_t	maxBufferedBytes;	///< maximum number of bytes held in send and receive buffers
+
+	std::string to_string() const;
+};
+
 ///	distributes/redistributes parts of possibly distributed grids.
 /**	This method is still in development... Use with care!
  *
@@ -77,6 +94,24 @@ enum InterfaceStates{
  * 			shPartition.num_subsets(). All values in the array have to be
  * 			in the range [0, pcl:NumProcs()[.
  * 			The procMap associates a process rank with each subset index.
+ *
+ * \param	maxBufferSize is by default 0, which means that all outgoing partitions
+ * 			are serialized before any data is communicated. If a positive value
+ * 			is specified, outgoing partitions are serialized and sent in rounds.
+ * 			In each round only so many partitions are serialized until their
+ * 			accumulated size reaches maxBufferSize bytes (at least one partition is
+ * 			serialized per round). Send buffers are freed after each round.
+ * 			Received data can only be deserialized once all outgoing partitions
+ * 			of the local process have been serialized, since the local grid is
+ * 			required for serialization. From then on, the partitions received in
+ * 			each round are deserialized and their buffers are freed before the
+ * 			next round starts. Processes which receive much but send little
+ * 			(e.g. empty processes during an initial distribution) thus hold the
+ * 			received data of only one round at a time.
+ * 			maxBufferSize has to be either 0 on all processes or positive on all processes.
+ *
+ * \param	statsOut is by default NULL and thus ignored. If specified, statistics
+ * 			on the data moved by the local process are written to it.
  */
 bool DistributeGrid(MultiGrid& mg,
 					SubsetHandler& shPartition,
@@ -84,7 +119,9 @@ bool DistributeGrid(MultiGrid& mg,
 					bool createVerticalInterfaces,
 					const std::vector<int>* processMap = NULL,
 					const pcl::ProcessCommunicator& procComm =
-												pcl::ProcessCommunicator());
+												pcl::ProcessCommunicator(),
+					size_t maxBufferSize = 0,
+					DistributionStatistics* statsOut = NULL);
 
 }// end of namespace
 
@@ -254,7 +254,8 @@ LoadBalancer() :
 	m_mg(NULL),
 	m_balanceThreshold(0.9),
 	m_elementThreshold(1),
-	m_createVerticalInterfaces(true)
+	m_createVerticalInterfaces(true),
+	m_maxRedistBufferSize(0)
 {
 	m_processHierarchy = ProcessHierarchy::create();
 	m_balanceWeights = make_sp(new StdBalanceWeights());
@@ -288,13 +289,12 @@ set_balance_weights(SmartPtr<IBalanceWeights> balanceWeights)
 {
 	m_balanceWeights = balanceWeights;
 }
-//
-//template<int dim>
-//void LoadBalancer::
-//set_connection_weights(SmartPtr<ConnectionWeights<dim> > conWeights)
-//{
-//	m_connectionWeights = conWeights;
-//}
+
+void LoadBalancer::
+set_connection_weights(SmartPtr<IConnectionWeights> conWeights)
+{
+	m_connectionWeights = conWeights;
+}
 
 //template<int dim>
 //void LoadBalancer::
@@ -315,6 +315,24 @@ set_balance_threshold(number threshold)
 	m_balanceThreshold = threshold;
 }
 
+void LoadBalancer::
+set_max_redistribution_buffer_size(size_t maxBytes)
+{
+	m_maxRedistBufferSize = maxBytes;
+}
+
+const DistributionStatistics& LoadBalancer::
+last_redistribution_statistics() const
+{
+	return m_redistStats;
+}
+
+std::string LoadBalancer::
+last_redistribution_statistics_string() const
+{
+	return m_redistStats.to_string();
+}
+
 void LoadBalancer::
 set_element_threshold(size_t threshold)
 {
@@ -453,12 +471,20 @@ rebalance()
 				  "A Process-Hierarchy has to be specifed for rebalancing");
 
 	m_partitioner->set_next_process_hierarchy(m_processHierarchy);
-	//m_partitioner->set_communication_weights(m_communicationCostWeights);
 	m_partitioner->set_balance_weights(m_balanceWeights);
+	if(m_connectionWeights.valid()){
+		if(m_partitioner->supports_connection_weights())
+			m_partitioner->set_connection_weights(m_connectionWeights);
+		else{
+			UG_LOG("WARNING in LoadBalancer::rebalance: Connection weights are "
+				   "ignored, since they are not supported by the chosen partitioner.\n");
+		}
+	}
 
 //todo:	check imbalance and find base-level on which to partition!
 	m_balanceWeights->refresh_weights(0);
-	//m_connectionWeights->refresh_weights(0);
+	if(m_connectionWeights.valid())
+		m_connectionWeights->refresh_weights(0);
 
 //	distribution quality is only interesting if repartitioning is supported.
 //	If it is not we'll set it to -1, thus calling partition anyways
@@ -484,11 +510,18 @@ rebalance()
 			const std::vector<int>* procMap = m_partitioner->get_process_map();
 
 			UG_DLOG(LIB_GRID, 1, "LoadBalancer-rebalance: distributing...\n");
-			if(!DistributeGrid(*m_mg, sh, m_serializer, m_createVerticalInterfaces, procMap))
+			if(!DistributeGrid(*m_mg, sh, m_serializer, m_createVerticalInterfaces, procMap,
+							   pcl::ProcessCommunicator(), m_maxRedistBufferSize,
+							   &m_redistStats))
 			{
 				UG_THROW("DistributeGrid failed!");
 			}
 
+			if(m_partitioner->verbose()){
+				UG_LOG("Redistribution statistics (local): "
+					   << m_redistStats.to_string() << "\n");
+			}
+
 			UG_LOG("Redistribution done\n");
 			UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance\n");
 			return true;
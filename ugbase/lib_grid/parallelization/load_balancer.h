@@ -41,6 +41,7 @@
 
 #ifdef UG_PARALLEL
 	#include "pcl/pcl_process_communicator.h"
+	#include "distribution.h"
 #endif
 
 
@@ -152,6 +153,28 @@ class IBalanceWeights{
 typedef SmartPtr<IBalanceWeights>		SPBalanceWeights;
 
 
+///	Provides weights for the connections between neighbored elements
+/**	A connection between two neighbored elements is represented by the side
+ * through which they are connected. The weight of a connection reflects the
+ * cost of cutting it, e.g. the amount of data which has to be exchanged through
+ * the resulting interface. The higher the weight, the higher the likelyhood
+ * that the two elements will reside on the same process after redistribution.
+ *
+ * Connection weights thus correspond to the edge weights of the dual graph
+ * of a grid (cf. ParallelDualGraph).*/
+class IConnectionWeights{
+	public:
+		virtual ~IConnectionWeights()	{}
+		virtual void refresh_weights(int baseLevel)	{};
+
+		virtual number get_weight(Vertex*)	{return 1.;}
+		virtual number get_weight(Edge*) 	{return 1.;}
+		virtual number get_weight(Face*) 	{return 1.;}
+};
+
+typedef SmartPtr<IConnectionWeights>	SPConnectionWeights;
+
+
 ///	allows to post-process partitions
 /**	If supported by a partitioner, a post-processor is called for each partitioned level
  * to allow for the adjustment of partitions following some specific rules.
@@ -190,7 +213,10 @@ class IPartitioner{
 
 		virtual void set_next_process_hierarchy(SPProcessHierarchy procHierarchy) = 0;
 		virtual void set_balance_weights(SPBalanceWeights balanceWeights) = 0;
-//		virtual void set_connection_weights(SmartPtr<ConnectionWeights<dim> > conWeights) = 0;
+
+		virtual void set_connection_weights(SPConnectionWeights){
+			UG_THROW("Connection weights are currently not supported by the chosen partitioner.");
+		}
 
 		virtual void set_partition_post_processor(SPPartitionPostProcessor){
 			UG_THROW("Partition-Post-Processing is currently not supported by the chosen partitioner.");
@@ -200,7 +226,7 @@ class IPartitioner{
 		virtual ConstSPProcessHierarchy next_process_hierarchy() const = 0;
 
 		virtual bool supports_balance_weights() const = 0;
-//		virtual bool supports_connection_weights() const = 0;
+		virtual bool supports_connection_weights() const		{return false;}
 		virtual bool supports_repartitioning() const = 0;
 
 	/**	clustered siblings help to ensure that all vertices which are connected to
@@ -276,7 +302,7 @@ class LoadBalancer{
 	/**	The higher the weight, the higher the likelyhood that the two elements
 	 * will reside on the same process after redistribution.
 	 * \note connection weights are only used if the given partitioner supports them.*/
-//	 	virtual void set_connection_weights(SmartPtr<IConnectionWeights> conWeights);
+	 	virtual void set_connection_weights(SPConnectionWeights conWeights);
 
 //	///	Inserts a new distribution level on which the grid may be redistributed
 //	/** Use this method to map a region of levels to a subset of the active processes.
@@ -298,6 +324,20 @@ class LoadBalancer{
 	 * performed on that level. Default is 1.*/
 		virtual void set_element_threshold(size_t threshold);
 
+	///	Limits the size of the send buffers used during redistribution (in bytes)
+	/**	If a positive limit is specified, outgoing partitions are serialized and
+	 * sent in rounds so that the send buffers of each round don't exceed the
+	 * given limit (at least one partition is sent per round).
+	 * Default is 0, i.e. all partitions are sent at once.
+	 * \sa DistributeGrid*/
+		virtual void set_max_redistribution_buffer_size(size_t maxBytes);
+
+	///	returns statistics on the data moved by the local process during the last redistribution
+		const DistributionStatistics& last_redistribution_statistics() const;
+
+	///	returns a string containing statistics on the last redistribution
+		std::string last_redistribution_statistics_string() const;
+
 //	///	returns the quality of the current distribution
 //		virtual number distribution_quality();
 
@@ -365,10 +405,12 @@ class LoadBalancer{
 		SPProcessHierarchy	m_processHierarchy;
 		SPPartitioner		m_partitioner;
 		SPBalanceWeights	m_balanceWeights;
-//		SPConnectionWeights	m_connectionWeights;
+		SPConnectionWeights	m_connectionWeights;
 		GridDataSerializationHandler	m_serializer;
 		StringStreamTable	m_qualityRecords;
 		bool m_createVerticalInterfaces;
+		size_t m_maxRedistBufferSize;
+		DistributionStatistics	m_redistStats;
 };
 
 ///	\}
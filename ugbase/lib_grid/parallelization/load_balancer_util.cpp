@@ -126,4 +126,91 @@ CreateProcessHierarchy(size_t* numElemsOnLvl, size_t numLvls,
 	return procH;
 }
 
+
+SPProcessHierarchy
+CreateAgglomeratingProcessHierarchy(size_t* numElemsOnLvl, size_t numLvls,
+									size_t minNumElemsPerProc, size_t maxNumProcs,
+									int minDistLvl)
+{
+	SPProcessHierarchy procH = ProcessHierarchy::create();
+
+	if(minDistLvl < 0)
+		minDistLvl = 0;
+
+	if(minNumElemsPerProc < 1)
+		minNumElemsPerProc = 1;
+
+	if(((int)numLvls <= minDistLvl) || (maxNumProcs <= 1)){
+		procH->add_hierarchy_level(0, 1);
+		return procH;
+	}
+
+//	admissible numbers of active processes. Each entry is obtained by dividing
+//	the previous one by its smallest prime factor, so that all entries divide
+//	their predecessors.
+	std::vector<size_t> procCounts(1, maxNumProcs);
+	while(procCounts.back() > 1){
+		const size_t num = procCounts.back();
+		size_t factor = 2;
+		while(num % factor != 0)
+			++factor;
+		procCounts.push_back(num / factor);
+	}
+
+//	number of active processes per level, reduced from the finest level
+//	downwards as long as the elements per process fall below the threshold
+	std::vector<size_t> numActive(numLvls, 1);
+	size_t iCount = 0;
+	for(int lvl = (int)numLvls - 1; lvl >= minDistLvl; --lvl){
+		while((iCount + 1 < procCounts.size())
+			  && (numElemsOnLvl[lvl] < procCounts[iCount] * minNumElemsPerProc))
+		{
+			++iCount;
+		}
+		numActive[lvl] = procCounts[iCount];
+	}
+
+//	collect the redistributions from the finest level downwards, so that the
+//	finest level always runs on numActive[numLvls - 1] processes. Since
+//	redistributions may only be performed on every second level, a reduction
+//	which would be adjacent to the previous (finer) one is moved one level
+//	down. Below minDistLvl it is merged into the previous one instead.
+	std::vector<std::pair<int, size_t> > distLvls;	// level, number of processes
+	size_t curNumProcs = numActive[numLvls - 1];
+	int lastDistLvl = (int)numLvls + 1;
+	for(int lvl = (int)numLvls - 1; lvl >= minDistLvl; --lvl){
+		const size_t numBelow = (lvl > minDistLvl) ? numActive[lvl - 1] : 1;
+		if(numBelow >= curNumProcs)
+			continue;
+
+		if(lastDistLvl - lvl > 1){
+			distLvls.push_back(std::make_pair(lvl, curNumProcs));
+			lastDistLvl = lvl;
+			curNumProcs = numBelow;
+		}
+		else if(lvl == minDistLvl)
+			curNumProcs = numBelow;
+	}
+
+	if(distLvls.empty()){
+		procH->add_hierarchy_level(0, 1);
+		return procH;
+	}
+
+//	create the process hierarchy
+	curNumProcs = 1;
+	for(size_t i = distLvls.size(); i > 0; --i){
+		procH->add_hierarchy_level(distLvls[i-1].first,
+								   distLvls[i-1].second / curNumProcs);
+		curNumProcs = distLvls[i-1].second;
+	}
+
+	UG_ASSERT(curNumProcs == numActive[numLvls - 1],
+			  "The finest level has to be distributed to "
+			  << numActive[numLvls - 1] << " processes, but only "
+			  << curNumProcs << " are involved.");
+
+	return procH;
+}
+
 }// end of namespace
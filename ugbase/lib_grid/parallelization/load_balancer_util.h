@@ -46,26 +46,42 @@ CreateProcessHierarchy(size_t* numElemsOnLvl, size_t numLvls,
 					   size_t maxNumProcs, int minDistLvl,
 					   int maxLvlsWithoutRedist);
 
-//
-//template <int dim>
-//class StdConnectionWeights : public ConnectionWeights<dim>{
-//	public:
-//		typedef ConnectionWeights<dim>			base_class;
-//		typedef typename base_class::elem_type	elem_type;
-//
-//		StdConnectionWeights() : m_wgt(1.0)					{}
-//		StdConnectionWeights(number wgt) : m_wgt(wgt)		{}
-//		virtual ~StdConnectionWeights()						{}
-//
-//		virtual void set_weight(number wgt)					{m_wgt = wgt;}
-//
-//		virtual void set_grid(MultiGrid*, Attachment<MathVector<dim> >)	{}
-//		virtual void refresh_weights(int)					{}
-//		virtual number get_weight(elem_type*, elem_type*)	{return m_wgt;}
-//
-//	private:
-//		number m_wgt;
-//};
+///	Creates a process-hierarchy which agglomerates coarse levels onto fewer processes.
+/**	Starting with maxNumProcs processes on the finest level, the number of
+ * active processes is reduced level by level towards the coarse grid (halved,
+ * or more generally divided by its smallest prime factor) as long as each
+ * process would hold less than minNumElemsPerProc elements. Coarse grid levels
+ * thus only involve processes which hold a reasonable amount of work, and the
+ * multigrid transfers between levels on different numbers of processes are
+ * performed through the resulting vertical interfaces.
+ *
+ * As in CreateProcessHierarchy, redistributions are performed at most on
+ * every second level. The hierarchy is built from the finest level
+ * downwards: if two reductions would be performed on adjacent levels, the
+ * coarser one is moved one level down, so that the finest level always
+ * involves maxNumProcs processes (if it holds enough elements).*/
+SPProcessHierarchy
+CreateAgglomeratingProcessHierarchy(size_t* numElemsOnLvl, size_t numLvls,
+									size_t minNumElemsPerProc, size_t maxNumProcs,
+									int minDistLvl);
+
+///	Returns the same weight for all connections. The default weight is 1.
+class StdConnectionWeights : public IConnectionWeights{
+	public:
+		StdConnectionWeights() : m_wgt(1.0)					{}
+		StdConnectionWeights(number wgt) : m_wgt(wgt)		{}
+		virtual ~StdConnectionWeights()						{}
+
+		virtual void set_weight(number wgt)					{m_wgt = wgt;}
+		virtual void refresh_weights(int)					{}
+
+		virtual number get_weight(Vertex* e)	{return m_wgt;}
+		virtual number get_weight(Edge* e)		{return m_wgt;}
+		virtual number get_weight(Face* e)		{return m_wgt;}
+
+	private:
+		number m_wgt;
+};
 
 
 /**	If a level-factor > 0 is specified, then the get_weight method returns
@@ -139,6 +155,46 @@ class AnisotropicBalanceWeights : public IBalanceWeights{
 };
 
 
+///	The larger the connecting side, the higher the weight of a connection.
+/**	On anisotropic grids, elements are strongly coupled through their large
+ * sides. Weighting connections by the volume of the connecting side thus
+ * leads to partitions whose interfaces preferably consist of small sides.
+ * The weight of a connection through a side s is
+ * \code
+ * weightFactor * volume(s)
+ * \endcode
+ * In 1d, where sides are vertices, weightFactor is returned.*/
+template <int dim>
+class AnisotropicConnectionWeights : public IConnectionWeights{
+	public:
+		typedef Attachment<MathVector<dim> >	position_attachment_t;
+		AnisotropicConnectionWeights() : m_weightFactor(1)	{}
+		virtual ~AnisotropicConnectionWeights()	{}
+
+		virtual void set_weight_factor(number weightFactor)
+		{
+			m_weightFactor = weightFactor;
+		}
+
+		virtual number weight_factor() const	{return m_weightFactor;}
+
+		virtual void set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos)
+		{
+			m_aaPos.access(*mg, aPos);
+		}
+
+		virtual void refresh_weights(int baseLevel)	{}
+
+		virtual number get_weight(Vertex* e)	{return m_weightFactor;}
+		virtual number get_weight(Edge* e)		{return CalculateVolume(e, m_aaPos) * m_weightFactor;}
+		virtual number get_weight(Face* e)		{return CalculateVolume(e, m_aaPos) * m_weightFactor;}
+
+	private:
+		number m_weightFactor;
+		Grid::VertexAttachmentAccessor<position_attachment_t>	m_aaPos;
+};
+
+
 }// end of namespace
 
 #endif
@@ -35,88 +35,257 @@
 #include "lib_grid/algorithms/debug_util.h"
 #include "common/error.h"
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 namespace ug{
 
-template <class TLayout>
-class ComPol_BroadcastRefineMarks : public pcl::ICommunicationPolicy<TLayout>
+///	identifies a section of marks of a given element type in a message
+enum MarkSectionType{
+	MST_VERTEX = 0,
+	MST_EDGE = 1,
+	MST_FACE = 2,
+	MST_END = 255
+};
+
+template <class TElem> struct MarkSectionTraits;
+template <> struct MarkSectionTraits<Vertex>	{static byte type()	{return MST_VERTEX;}};
+template <> struct MarkSectionTraits<Edge>		{static byte type()	{return MST_EDGE;}};
+template <> struct MarkSectionTraits<Face>		{static byte type()	{return MST_FACE;}};
+
+
+template <class TElem>
+static void CollectNeighborProcs(std::set<int>& procsOut, GridLayoutMap& glm,
+								 int intfcType)
 {
-	public:
-		typedef TLayout								Layout;
-		typedef typename Layout::Type				GeomObj;
-		typedef typename Layout::Element			Element;
-		typedef typename Layout::Interface			Interface;
-		typedef typename Interface::const_iterator	InterfaceIter;
-
-		ComPol_BroadcastRefineMarks(IRefiner& ref, byte consideredMarks)
-			 :	m_ref(ref), m_consideredMarks(consideredMarks)
-		{}
-
-		virtual ~ComPol_BroadcastRefineMarks()	{}
-		virtual int
-		get_required_buffer_size(const Interface& interface)
-		{return interface.size() * sizeof(byte);}
-
-	///	writes writes the selection states of the interface entries
-		virtual bool
-		collect(ug::BinaryBuffer& buff, const Interface& interface)
-		{
-		//	write the entry indices of marked elements.
-			for(InterfaceIter iter = interface.begin();
-				iter != interface.end(); ++iter)
-			{
-				Element elem = interface.get_element(iter);
-				byte refMark = m_ref.get_mark(elem);
-				buff.write((char*)&refMark, sizeof(byte));
-			}
+	typedef typename GridLayoutMap::Types<TElem>::Layout	Layout;
+	if(!glm.has_layout<TElem>(intfcType))
+		return;
 
-			return true;
+	Layout& layout = glm.get_layout<TElem>(intfcType);
+	for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+		for(typename Layout::iterator iter = layout.begin(lvl);
+			iter != layout.end(lvl); ++iter)
+		{
+			if(!layout.interface(iter).empty())
+				procsOut.insert(layout.proc_id(iter));
 		}
+	}
+}
+
+
+///	writes index and mark of all interface entries which are contained in sortedElems
+/**	For each interface which contains such entries a section is written to the
+ * buffer associated with the interface's target process.*/
+template <class TElem>
+static size_t CollectMarks(std::map<int, BinaryBuffer>& bufs, GridLayoutMap& glm,
+						   int intfcType, const std::vector<TElem*>& sortedElems,
+						   IRefiner& ref, byte consideredMarks)
+{
+	typedef typename GridLayoutMap::Types<TElem>::Layout	Layout;
+	typedef typename Layout::Interface						Interface;
+
+	if(sortedElems.empty() || !glm.has_layout<TElem>(intfcType))
+		return 0;
 
-	///	reads marks from the given stream
-		virtual bool
-		extract(ug::BinaryBuffer& buff, const Interface& interface)
+	size_t numMarks = 0;
+	std::vector<std::pair<int, byte> >	entries;
+	const byte sectionType = MarkSectionTraits<TElem>::type();
+
+	Layout& layout = glm.get_layout<TElem>(intfcType);
+	for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+		for(typename Layout::iterator iter = layout.begin(lvl);
+			iter != layout.end(lvl); ++iter)
 		{
-			byte val;
-			for(InterfaceIter iter = interface.begin();
-				iter != interface.end(); ++iter)
+			Interface& intfc = layout.interface(iter);
+			entries.clear();
+			int counter = 0;
+			for(typename Interface::iterator eiter = intfc.begin();
+				eiter != intfc.end(); ++eiter, ++counter)
 			{
-				Element elem = interface.get_element(iter);
-				buff.read((char*)&val, sizeof(byte));
-
-				val &= m_consideredMarks;
-
-			//	check the current status and adjust the mark accordingly
-				byte curVal = m_ref.get_mark(elem);
-
-				if(val > curVal){
-					if(val & RM_COARSEN)
-						m_ref.mark(elem, RM_COARSEN);
-					if(val & RM_CLOSURE)
-						m_ref.mark(elem, RM_CLOSURE);
-					if(val & RM_ANISOTROPIC)
-						m_ref.mark(elem, RM_ANISOTROPIC);
-					if(val & RM_REFINE)
-						m_ref.mark(elem, RM_REFINE);
+				TElem* e = intfc.get_element(eiter);
+				if(std::binary_search(sortedElems.begin(), sortedElems.end(), e)){
+					byte mark = ref.get_mark(e) & consideredMarks;
+					if(mark)
+						entries.push_back(std::make_pair(counter, mark));
 				}
 			}
-			return true;
+
+			if(entries.empty())
+				continue;
+
+			BinaryBuffer& buf = bufs[layout.proc_id(iter)];
+			int ilvl = (int)lvl;
+			int numEntries = (int)entries.size();
+			buf.write((char*)&sectionType, sizeof(byte));
+			buf.write((char*)&ilvl, sizeof(int));
+			buf.write((char*)&numEntries, sizeof(int));
+			for(size_t i = 0; i < entries.size(); ++i){
+				buf.write((char*)&entries[i].first, sizeof(int));
+				buf.write((char*)&entries[i].second, sizeof(byte));
+			}
+			numMarks += entries.size();
 		}
+	}
+	return numMarks;
+}
 
-		IRefiner& m_ref;
-		byte m_consideredMarks;
-};
 
+///	reads a section written by CollectMarks and adjusts the marks of the associated elements
+/**	Elements whose marks were changed are appended to changedElemsOut.*/
+template <class TElem>
+static void ExtractMarks(BinaryBuffer& buf, GridLayoutMap& glm, int intfcType,
+						 int srcProc, IRefiner& ref, byte consideredMarks,
+						 std::vector<TElem*>& changedElemsOut)
+{
+	typedef typename GridLayoutMap::Types<TElem>::Layout	Layout;
+	typedef typename Layout::Interface						Interface;
+
+	int lvl, numEntries;
+	buf.read((char*)&lvl, sizeof(int));
+	buf.read((char*)&numEntries, sizeof(int));
+
+	UG_COND_THROW(!glm.has_layout<TElem>(intfcType)
+				  || !glm.get_layout<TElem>(intfcType).interface_exists(srcProc, lvl),
+				  "ParallelHNodeAdjuster: Received marks for a non-existing interface to process "
+				  << srcProc << " on level " << lvl);
+
+	Interface& intfc = glm.get_layout<TElem>(intfcType).interface(srcProc, lvl);
+
+//	indices are sorted in ascending order. We thus iterate over the interface only once.
+	typename Interface::iterator eiter = intfc.begin();
+	int counter = 0;
+	for(int i = 0; i < numEntries; ++i){
+		int index;
+		byte val;
+		buf.read((char*)&index, sizeof(int));
+		buf.read((char*)&val, sizeof(byte));
+
+		while(counter < index && eiter != intfc.end()){
+			++eiter;
+			++counter;
+		}
+
+		UG_COND_THROW(eiter == intfc.end(),
+					  "ParallelHNodeAdjuster: Received interface index out of range.");
+
+		TElem* e = intfc.get_element(eiter);
+		val &= consideredMarks;
+
+	//	check the current status and adjust the mark accordingly
+		byte curVal = ref.get_mark(e);
+
+		if(val > curVal){
+			if(val & RM_COARSEN)
+				ref.mark(e, RM_COARSEN);
+			if(val & RM_CLOSURE)
+				ref.mark(e, RM_CLOSURE);
+			if(val & RM_ANISOTROPIC)
+				ref.mark(e, RM_ANISOTROPIC);
+			if(val & RM_REFINE)
+				ref.mark(e, RM_REFINE);
+
+			if(ref.get_mark(e) != curVal)
+				changedElemsOut.push_back(e);
+		}
+	}
+}
 
 
-template <class TStdVector>
-static bool ContainsInterfaceElem(const TStdVector& elems,
+template <class TElem>
+static void SortAndRemoveDoubles(std::vector<TElem*>& elems)
+{
+	std::sort(elems.begin(), elems.end());
+	elems.erase(std::unique(elems.begin(), elems.end()), elems.end());
+}
+
+
+void ParallelHNodeAdjuster::
+exchange_marks(IRefiner& ref, GridLayoutMap& glm, int srcType, int dstType,
+			   std::vector<Vertex*>& vrts,
+			   std::vector<Edge*>& edges,
+			   std::vector<Face*>& faces)
+{
+	const byte consideredMarks = RM_REFINE | RM_ANISOTROPIC;
+	const byte endMarker = MST_END;
+
+//	all neighbors have to receive a message, even if no marks are sent to them
+	std::set<int> sendToProcs, recvFromProcs;
+	CollectNeighborProcs<Vertex>(sendToProcs, glm, srcType);
+	CollectNeighborProcs<Edge>(sendToProcs, glm, srcType);
+	CollectNeighborProcs<Face>(sendToProcs, glm, srcType);
+	CollectNeighborProcs<Vertex>(recvFromProcs, glm, dstType);
+	CollectNeighborProcs<Edge>(recvFromProcs, glm, dstType);
+	CollectNeighborProcs<Face>(recvFromProcs, glm, dstType);
+
+	std::map<int, BinaryBuffer> sendBufs, recvBufs;
+	m_numSentMarks += CollectMarks(sendBufs, glm, srcType, vrts, ref, consideredMarks);
+	m_numSentMarks += CollectMarks(sendBufs, glm, srcType, edges, ref, consideredMarks);
+	m_numSentMarks += CollectMarks(sendBufs, glm, srcType, faces, ref, consideredMarks);
+
+	for(std::set<int>::iterator iter = sendToProcs.begin();
+		iter != sendToProcs.end(); ++iter)
+	{
+		BinaryBuffer& buf = sendBufs[*iter];
+		buf.write((char*)&endMarker, sizeof(byte));
+		m_intfCom.send_raw(*iter, buf.buffer(), (int)buf.write_pos(), false);
+		++m_numMessages;
+	}
+
+	for(std::set<int>::iterator iter = recvFromProcs.begin();
+		iter != recvFromProcs.end(); ++iter)
+	{
+		m_intfCom.receive_raw(*iter, recvBufs[*iter]);
+	}
+
+	m_intfCom.communicate();
+
+	for(std::map<int, BinaryBuffer>::iterator iter = recvBufs.begin();
+		iter != recvBufs.end(); ++iter)
+	{
+		int srcProc = iter->first;
+		BinaryBuffer& buf = iter->second;
+		while(1){
+			byte sectionType = MST_END;
+			buf.read((char*)&sectionType, sizeof(byte));
+			if(sectionType == MST_END)
+				break;
+
+			switch(sectionType){
+				case MST_VERTEX:
+					ExtractMarks(buf, glm, dstType, srcProc, ref, consideredMarks, vrts);
+					break;
+				case MST_EDGE:
+					ExtractMarks(buf, glm, dstType, srcProc, ref, consideredMarks, edges);
+					break;
+				case MST_FACE:
+					ExtractMarks(buf, glm, dstType, srcProc, ref, consideredMarks, faces);
+					break;
+				default:
+					UG_THROW("ParallelHNodeAdjuster: Unknown section type in received marks: "
+							 << (int)sectionType);
+			}
+		}
+	}
+
+	SortAndRemoveDoubles(vrts);
+	SortAndRemoveDoubles(edges);
+	SortAndRemoveDoubles(faces);
+}
+
+
+template <class TElem>
+static void CollectInterfaceElems(std::vector<TElem*>& elemsOut,
+								  const std::vector<TElem*>& elems,
 								  DistributedGridManager& distGridMgr)
 {
+	elemsOut.clear();
 	for(size_t i = 0; i < elems.size(); ++i){
-		if(distGridMgr.is_interface_element(elems[i]))
-			return true;
+		if(distGridMgr.is_in_horizontal_interface(elems[i]))
+			elemsOut.push_back(elems[i]);
 	}
-	return false;
+	SortAndRemoveDoubles(elemsOut);
 }
 
 
@@ -143,56 +312,31 @@ ref_marks_changed(IRefiner& ref,
 	DistributedGridManager& distGridMgr = *grid.distributed_grid_manager();
 	GridLayoutMap& layoutMap = distGridMgr.grid_layout_map();
 
-//	check whether new interface elements have been selected
-	bool newInterfaceVrtsMarked = ContainsInterfaceElem(vrts, distGridMgr);
-	bool newInterfaceEdgeMarked = ContainsInterfaceElem(edges, distGridMgr);
-	bool newInterfaceFacesMarked = ContainsInterfaceElem(faces, distGridMgr);
-	bool newInterfaceVolsMarked = ContainsInterfaceElem(vols, distGridMgr);
-
-	bool newlyMarkedElems = newInterfaceVrtsMarked ||
-							newInterfaceEdgeMarked ||
-							newInterfaceFacesMarked ||
-							newInterfaceVolsMarked;
-
-	bool exchangeFlag = pcl::OneProcTrue(newlyMarkedElems);
-
-	if(exchangeFlag){
-		const byte consideredMarks = RM_REFINE | RM_ANISOTROPIC;
-		ComPol_BroadcastRefineMarks<VertexLayout> compolRefVRT(ref, consideredMarks);
-		ComPol_BroadcastRefineMarks<EdgeLayout> compolRefEDGE(ref, consideredMarks);
-		ComPol_BroadcastRefineMarks<FaceLayout> compolRefFACE(ref, consideredMarks);
-
-	//	send data SLAVE -> MASTER
-		m_intfComVRT.exchange_data(layoutMap, INT_H_SLAVE, INT_H_MASTER,
-									compolRefVRT);
-
-		m_intfComEDGE.exchange_data(layoutMap, INT_H_SLAVE, INT_H_MASTER,
-									compolRefEDGE);
-
-		m_intfComFACE.exchange_data(layoutMap, INT_H_SLAVE, INT_H_MASTER,
-									compolRefFACE);
-
-		m_intfComVRT.communicate();
-		m_intfComEDGE.communicate();
-		m_intfComFACE.communicate();
-
-	//	and now MASTER -> SLAVE (the selection has been adjusted on the fly)
-		m_intfComVRT.exchange_data(layoutMap, INT_H_MASTER, INT_H_SLAVE,
-									compolRefVRT);
-
-		m_intfComEDGE.exchange_data(layoutMap, INT_H_MASTER, INT_H_SLAVE,
-									compolRefEDGE);
-
-		m_intfComFACE.exchange_data(layoutMap, INT_H_MASTER, INT_H_SLAVE,
-									compolRefFACE);
-
-		m_intfComVRT.communicate();
-		m_intfComEDGE.communicate();
-		m_intfComFACE.communicate();
-
-		UG_DLOG(LIB_GRID, 1, "refMarkAdjuster-stop (force continue): ParallelHNodeAdjuster::ref_marks_changed\n");
-	}
-
-	UG_DLOG(LIB_GRID, 1, "refMarkAdjuster-stop: ParallelHNodeAdjuster::ref_marks_changed\n");
+//	only newly marked interface elements have to be communicated. Note that
+//	volumes never reside in horizontal interfaces.
+//	No global check whether marks have to be exchanged at all is performed here,
+//	since the refiner anyways decides globally whether another adjustment round
+//	is required. Neighbors which have nothing to report send empty messages.
+	std::vector<Vertex*>	intfcVrts;
+	std::vector<Edge*>		intfcEdges;
+	std::vector<Face*>		intfcFaces;
+	CollectInterfaceElems(intfcVrts, vrts, distGridMgr);
+	CollectInterfaceElems(intfcEdges, edges, distGridMgr);
+	CollectInterfaceElems(intfcFaces, faces, distGridMgr);
+
+//	send data SLAVE -> MASTER
+	exchange_marks(ref, layoutMap, INT_H_SLAVE, INT_H_MASTER,
+				   intfcVrts, intfcEdges, intfcFaces);
+
+//	and now MASTER -> SLAVE. Elements whose marks were adjusted during the
+//	first exchange have been added to the intfcXXX vectors.
+	exchange_marks(ref, layoutMap, INT_H_MASTER, INT_H_SLAVE,
+				   intfcVrts, intfcEdges, intfcFaces);
+
+	++m_numRounds;
+
+	UG_DLOG(LIB_GRID, 1, "refMarkAdjuster-stop: ParallelHNodeAdjuster::ref_marks_changed"
+			<< " (rounds: " << m_numRounds << ", messages: " << m_numMessages
+			<< ", sent marks: " << m_numSentMarks << ")\n");
 }
 }// end of namespace
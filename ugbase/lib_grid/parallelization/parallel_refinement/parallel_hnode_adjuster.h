@@ -44,11 +44,21 @@ class ParallelHNodeAdjuster;
 typedef SmartPtr<ParallelHNodeAdjuster> SPParallelHNodeAdjuster;
 
 ///	Makes sure that that marks are propagated over process interfaces
+/**	Only marks of interface elements which were newly marked since the last
+ * call are communicated. Marks of vertices, edges and faces are packed into
+ * a single message per neighbor process, so that each call performs exactly
+ * one exchange from slaves to masters and one from masters to slaves.
+ *
+ * The adjuster counts the number of calls (rounds), the number of sent messages
+ * and the number of sent marks. Use reset_statistics to reset those counters.*/
 class ParallelHNodeAdjuster : public IRefMarkAdjuster
 {
 	public:
 		static SPParallelHNodeAdjuster create()		{return SPParallelHNodeAdjuster(new ParallelHNodeAdjuster);}
 
+		ParallelHNodeAdjuster() :
+			m_numRounds(0), m_numMessages(0), m_numSentMarks(0)	{}
+
 		virtual ~ParallelHNodeAdjuster()	{}
 
 		virtual void ref_marks_changed(IRefiner& ref,
@@ -57,11 +67,26 @@ class ParallelHNodeAdjuster : public IRefMarkAdjuster
 										const std::vector<Face*>& faces,
 										const std::vector<Volume*>& vols);
 
+		size_t num_rounds() const		{return m_numRounds;}
+		size_t num_messages() const		{return m_numMessages;}
+		size_t num_sent_marks() const	{return m_numSentMarks;}
+		void reset_statistics()			{m_numRounds = m_numMessages = m_numSentMarks = 0;}
+
 	private:
-		pcl::ProcessCommunicator m_procCom;
-		pcl::InterfaceCommunicator<VertexLayout> m_intfComVRT;
-		pcl::InterfaceCommunicator<EdgeLayout> m_intfComEDGE;
-		pcl::InterfaceCommunicator<FaceLayout> m_intfComFACE;
+	///	sends marks of elements in the given vectors from srcType to dstType interfaces
+	/**	Elements whose marks changed during extraction are appended to the given
+	 * vectors. All vectors have to be sorted.*/
+		void exchange_marks(IRefiner& ref, GridLayoutMap& glm,
+							int srcType, int dstType,
+							std::vector<Vertex*>& vrts,
+							std::vector<Edge*>& edges,
+							std::vector<Face*>& faces);
+
+		pcl::InterfaceCommunicator<VertexLayout> m_intfCom;
+
+		size_t	m_numRounds;
+		size_t	m_numMessages;
+		size_t	m_numSentMarks;
 };
 
 }// end of namespace
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include "partition_quality_metrics.h"
+#include "distributed_grid.h"
+#include "parallelization_util.h"
+#include "common/util/table.h"
+
+using namespace std;
+
+namespace ug{
+
+PartitionQualityMetrics::
+PartitionQualityMetrics() :
+	m_numLevels(0),
+	m_numProcs(0)
+{
+}
+
+void PartitionQualityMetrics::
+update(MultiGrid& mg)
+{
+	GDIST_PROFILE_FUNC();
+
+	pcl::ProcessCommunicator com;
+	m_numProcs = com.size();
+
+	int highestElem = VERTEX;
+	if(mg.num<Volume>() > 0)		highestElem = VOLUME;
+	else if(mg.num<Face>() > 0)		highestElem = FACE;
+	else if(mg.num<Edge>() > 0)		highestElem = EDGE;
+	highestElem = com.allreduce(highestElem, PCL_RO_MAX);
+
+	m_numLevels = com.allreduce(mg.num_levels(), PCL_RO_MAX);
+	m_local.assign(m_numLevels * NUM_METRICS, 0);
+
+	switch(highestElem){
+		case EDGE:		collect_local_values<Edge>(mg); break;
+		case FACE:		collect_local_values<Face>(mg); break;
+		case VOLUME:	collect_local_values<Volume>(mg); break;
+		default:		break;
+	}
+
+	com.allreduce(m_local, m_min, PCL_RO_MIN);
+	com.allreduce(m_local, m_max, PCL_RO_MAX);
+	com.allreduce(m_local, m_total, PCL_RO_SUM);
+
+	if(com.is_local())
+		m_procValues = m_local;
+	else
+		com.gatherv(m_procValues, m_local, 0);
+}
+
+template <class TElem>
+void PartitionQualityMetrics::
+collect_local_values(MultiGrid& mg)
+{
+	typedef typename TElem::side	side_t;
+	typedef typename Grid::traits<TElem>::iterator	ElemIter;
+	typedef typename Grid::traits<side_t>::iterator	SideIter;
+	typedef Grid::traits<Vertex>::iterator			VrtIter;
+	typedef GridLayoutMap::Types<Vertex>::Layout::LevelLayout	VrtLayout;
+
+	DistributedGridManager* pdgm = mg.distributed_grid_manager();
+
+	for(size_t lvl = 0; lvl < mg.num_levels(); ++lvl){
+		number numElems = 0;
+		for(ElemIter iter = mg.begin<TElem>(lvl); iter != mg.end<TElem>(lvl); ++iter){
+			if(!(pdgm && pdgm->is_ghost(*iter)))
+				++numElems;
+		}
+		m_local[index(ELEMENTS, lvl)] = numElems;
+
+		if(!pdgm)
+			continue;
+
+		number numIntfcVrts = 0;
+		for(VrtIter iter = mg.begin<Vertex>(lvl); iter != mg.end<Vertex>(lvl); ++iter){
+			if(pdgm->is_in_horizontal_interface(*iter))
+				++numIntfcVrts;
+		}
+		m_local[index(INTERFACE_VERTICES, lvl)] = numIntfcVrts;
+
+		number numIntfcSides = 0;
+		for(SideIter iter = mg.begin<side_t>(lvl); iter != mg.end<side_t>(lvl); ++iter){
+			if(pdgm->is_in_horizontal_interface(*iter))
+				++numIntfcSides;
+		}
+		m_local[index(INTERFACE_SIDES, lvl)] = numIntfcSides;
+
+	//	neighbors and communication volume are derived from vertex interfaces
+		GridLayoutMap& glm = pdgm->grid_layout_map();
+		set<int> nbrProcs;
+		number commVolume = 0;
+		const InterfaceNodeTypes intfcTypes[] = {INT_H_MASTER, INT_H_SLAVE};
+		for(size_t i = 0; i < 2; ++i){
+			if(!glm.has_layout<Vertex>(intfcTypes[i]))
+				continue;
+			VrtLayout& layout = glm.get_layout<Vertex>(intfcTypes[i]).layout_on_level(lvl);
+			for(VrtLayout::iterator iter = layout.begin(); iter != layout.end(); ++iter){
+				if(layout.interface(iter).empty())
+					continue;
+				nbrProcs.insert(layout.proc_id(iter));
+				commVolume += layout.interface(iter).size();
+			}
+		}
+		m_local[index(NEIGHBORS, lvl)] = nbrProcs.size();
+		m_local[index(COMM_VOLUME, lvl)] = commVolume;
+	}
+}
+
+number PartitionQualityMetrics::
+avg_value(int metric, int lvl) const
+{
+	if(m_numProcs == 0)
+		return 0;
+	return total_value(metric, lvl) / (number)m_numProcs;
+}
+
+number PartitionQualityMetrics::
+imbalance(int lvl) const
+{
+	number avg = avg_value(ELEMENTS, lvl);
+	if(avg <= 0)
+		return 1;
+	return max_value(ELEMENTS, lvl) / avg;
+}
+
+number PartitionQualityMetrics::
+proc_value(int proc, int metric, int lvl) const
+{
+	return m_procValues.at(proc * m_numLevels * NUM_METRICS + index(metric, lvl));
+}
+
+const char* PartitionQualityMetrics::
+metric_name(int metric)
+{
+	switch(metric){
+		case ELEMENTS:				return "elements";
+		case INTERFACE_VERTICES:	return "interface_vertices";
+		case INTERFACE_SIDES:		return "interface_sides";
+		case NEIGHBORS:				return "neighbors";
+		case COMM_VOLUME:			return "comm_volume";
+		default:					return "unknown";
+	}
+}
+
+std::string PartitionQualityMetrics::
+to_string() const
+{
+	StringStreamTable t;
+	t(0, 0) << "lvl";
+	t(0, 1) << "elems (min / max / total)";
+	t(0, 2) << "imbalance";
+	t(0, 3) << "intfc-sides (total)";
+	t(0, 4) << "nbrs (max)";
+	t(0, 5) << "comm-volume (max / total)";
+
+	for(size_t lvl = 0; lvl < m_numLevels; ++lvl){
+		int r = (int)lvl + 1;
+		t(r, 0) << lvl;
+		t(r, 1) << min_value(ELEMENTS, lvl) << " / " << max_value(ELEMENTS, lvl)
+				<< " / " << total_value(ELEMENTS, lvl);
+		t(r, 2) << imbalance(lvl);
+		t(r, 3) << total_value(INTERFACE_SIDES, lvl);
+		t(r, 4) << max_value(NEIGHBORS, lvl);
+		t(r, 5) << max_value(COMM_VOLUME, lvl) << " / " << total_value(COMM_VOLUME, lvl);
+	}
+
+	return t.to_string();
+}
+
+void PartitionQualityMetrics::
+write_csv(const char* filename) const
+{
+	if(pcl::ProcRank() != 0)
+		return;
+
+	ofstream out(filename);
+	UG_COND_THROW(!out, "PartitionQualityMetrics::write_csv: Couldn't open file "
+				  << filename << " for writing.");
+
+	out << "level,proc";
+	for(int m = 0; m < NUM_METRICS; ++m)
+		out << "," << metric_name(m);
+	out << "\n";
+
+	for(size_t lvl = 0; lvl < m_numLevels; ++lvl){
+		for(size_t p = 0; p < m_numProcs; ++p){
+			out << lvl << "," << p;
+			for(int m = 0; m < NUM_METRICS; ++m)
+				out << "," << proc_value(p, m, lvl);
+			out << "\n";
+		}
+	}
+}
+
+void PartitionQualityMetrics::
+write_json(const char* filename) const
+{
+	if(pcl::ProcRank() != 0)
+		return;
+
+	ofstream out(filename);
+	UG_COND_THROW(!out, "PartitionQualityMetrics::write_json: Couldn't open file "
+				  << filename << " for writing.");
+
+	out << "{\n";
+	out << "  \"num_procs\": " << m_numProcs << ",\n";
+	out << "  \"levels\": [";
+	for(size_t lvl = 0; lvl < m_numLevels; ++lvl){
+		if(lvl > 0)
+			out << ",";
+		out << "\n    {\n";
+		out << "      \"level\": " << lvl << ",\n";
+		out << "      \"imbalance\": " << imbalance(lvl);
+		for(int m = 0; m < NUM_METRICS; ++m){
+			out << ",\n      \"" << metric_name(m) << "\": {"
+				<< "\"min\": " << min_value(m, lvl)
+				<< ", \"max\": " << max_value(m, lvl)
+				<< ", \"total\": " << total_value(m, lvl)
+				<< ", \"procs\": [";
+			for(size_t p = 0; p < m_numProcs; ++p){
+				if(p > 0)
+					out << ", ";
+				out << proc_value(p, m, lvl);
+			}
+			out << "]}";
+		}
+		out << "\n    }";
+	}
+	out << "\n  ]\n}\n";
+}
+
+}//	end of namespace
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__partition_quality_metrics__
+#define __H__UG__partition_quality_metrics__
+
+#include <string>
+#include <vector>
+#include "lib_grid/multi_grid.h"
+#include "pcl/pcl_process_communicator.h"
+
+namespace ug{
+
+/// \addtogroup lib_grid_parallelization_distribution
+///	\{
+
+///	Computes metrics which describe the quality of the current distribution of a grid
+/**	For each level of a distributed multigrid the following values are
+ * computed on each process:
+ *	- elements:				number of non-ghost elements of highest dimension
+ *	- interface_vertices:	number of vertices in horizontal interfaces
+ *	- interface_sides:		number of sides of elements of highest dimension
+ *							in horizontal interfaces (i.e. cut sides)
+ *	- neighbors:			number of processes to which horizontal
+ *							vertex-interfaces exist
+ *	- comm_volume:			sum of the sizes of all horizontal vertex-interfaces.
+ *							This is the number of values each process sends and
+ *							receives during a typical vertex-based exchange (e.g.
+ *							the conversion of an additive to a consistent vector
+ *							with one unknown per vertex).
+ *
+ * Minimum, maximum and total values of those metrics are available on all
+ * processes. The values of each individual process are gathered on process 0,
+ * which can write them to a csv- or json-file.
+ *
+ * \note	update has to be called on all processes.*/
+class PartitionQualityMetrics{
+	public:
+		enum Metric{
+			ELEMENTS = 0,
+			INTERFACE_VERTICES,
+			INTERFACE_SIDES,
+			NEIGHBORS,
+			COMM_VOLUME,
+			NUM_METRICS
+		};
+
+		PartitionQualityMetrics();
+
+	///	computes the metrics for all levels of the given grid. Call on all processes.
+		void update(MultiGrid& mg);
+
+		size_t num_levels() const		{return m_numLevels;}
+		size_t num_procs() const		{return m_numProcs;}
+
+	///	global values of the given metric on the given level. Valid on all processes.
+	/**	\{ */
+		number min_value(int metric, int lvl) const		{return m_min.at(index(metric, lvl));}
+		number max_value(int metric, int lvl) const		{return m_max.at(index(metric, lvl));}
+		number total_value(int metric, int lvl) const	{return m_total.at(index(metric, lvl));}
+		number avg_value(int metric, int lvl) const;
+	/**	\} */
+
+	///	value of the given metric of the local process on the given level.
+		number local_value(int metric, int lvl) const	{return m_local.at(index(metric, lvl));}
+
+	///	maximum number of elements on a process divided by the average number.
+	/**	1 denotes a perfect balance. Returns 1 if the level contains no elements.*/
+		number imbalance(int lvl) const;
+
+	///	returns the name of the given metric as it is used in csv- and json-files
+		static const char* metric_name(int metric);
+
+	///	returns a table which summarizes the metrics of all levels
+		std::string to_string() const;
+
+	///	writes the values of each process and level to a csv-file. Only process 0 writes.
+		void write_csv(const char* filename) const;
+
+	///	writes global and per-process values of each level to a json-file. Only process 0 writes.
+		void write_json(const char* filename) const;
+
+	private:
+		size_t index(int metric, int lvl) const		{return lvl * NUM_METRICS + metric;}
+
+		template <class TElem>
+		void collect_local_values(MultiGrid& mg);
+
+	///	value of the given metric for the given process. Only valid on process 0.
+		number proc_value(int proc, int metric, int lvl) const;
+
+		size_t				m_numLevels;
+		size_t				m_numProcs;
+		std::vector<number>	m_local;
+		std::vector<number>	m_min;
+		std::vector<number>	m_max;
+		std::vector<number>	m_total;
+	///	values of all processes, only filled on process 0.
+		std::vector<number>	m_procValues;
+};
+
+///	\}
+
+}//	end of namespace
+
+#endif
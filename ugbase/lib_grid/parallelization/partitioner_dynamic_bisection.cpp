@@ -129,12 +129,13 @@ set_balance_weights(SPBalanceWeights balanceWeights)
 {
 	m_balanceWeights = balanceWeights;
 }
-//
-//template <class TElem, int dim>
-//void Partitioner_DynamicBisection<TElem, dim>::
-//set_connection_weights(SmartPtr<ConnectionWeights<dim> >)
-//{
-//}
+
+template <class TElem, int dim>
+void Partitioner_DynamicBisection<TElem, dim>::
+set_connection_weights(SPConnectionWeights conWeights)
+{
+	m_connectionWeights = conWeights;
+}
 
 template <class TElem, int dim>
 void Partitioner_DynamicBisection<TElem, dim>::
@@ -170,7 +171,7 @@ template <class TElem, int dim>
 bool Partitioner_DynamicBisection<TElem, dim>::
 supports_connection_weights() const
 {
-	return false;
+	return true;
 }
 
 template <class TElem, int dim>
@@ -663,19 +664,18 @@ bisect_elements(vector<TreeNode>& childNodesOut, vector<TreeNode>& parentNodes,
 			else
 				tn.splitAxis = get_next_split_axis(tn.splitAxis);
 
-			tn.minSplitValue = tn.boxMin[tn.splitAxis];
-			tn.maxSplitValue = tn.boxMax[tn.splitAxis];
-		//	this is an initial guess
-			tn.splitValue = (1. - 2. * tn.ratioLeft) * tn.minSplitValue
-							+ 2. * tn.ratioLeft * tn.center[tn.splitAxis];
-
 //			UG_LOG("node " << iNode << ":\n");
 //			UG_LOG("  center: " << tn.center << ", boxMin: " << tn.boxMin << ", boxMax: " << tn.boxMax << endl);
-//			UG_LOG("  splitAxis: " << tn.splitAxis << ", splitValue: " << tn.splitValue << endl);
+//			UG_LOG("  splitAxis: " << tn.splitAxis << endl);
 		}
 	}
 
-	improve_split_values(parentNodes, m_splitImproveIterations, aWeight, com);
+	if((cutRecursion == 0) && m_connectionWeights.valid() && (m_numSplitAxisEnabled > 1))
+		select_split_axes_by_connection_weights(parentNodes, aWeight, com);
+	else{
+		init_split_values(parentNodes);
+		improve_split_values(parentNodes, m_splitImproveIterations, aWeight, com);
+	}
 
 
 	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
@@ -1232,6 +1232,135 @@ improve_split_values(vector<TreeNode>& treeNodes,
 }
 
 
+template <class TElem, int dim>
+void Partitioner_DynamicBisection<TElem, dim>::
+init_split_values(vector<TreeNode>& treeNodes)
+{
+	for(size_t iNode = 0; iNode < treeNodes.size(); ++iNode){
+		TreeNode& tn = treeNodes[iNode];
+		if(tn.bisectionComplete)
+			continue;
+
+		tn.minSplitValue = tn.boxMin[tn.splitAxis];
+		tn.maxSplitValue = tn.boxMax[tn.splitAxis];
+	//	this is an initial guess
+		tn.splitValue = (1. - 2. * tn.ratioLeft) * tn.minSplitValue
+						+ 2. * tn.ratioLeft * tn.center[tn.splitAxis];
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_DynamicBisection<TElem, dim>::
+select_split_axes_by_connection_weights(vector<TreeNode>& treeNodes,
+										ANumber aWeight,
+										pcl::ProcessCommunicator& com)
+{
+	GDIST_PROFILE_FUNC();
+
+	const size_t numNodes = treeNodes.size();
+	vector<double> bestCutWeights(numNodes, numeric_limits<double>::max());
+	vector<int> bestAxis(numNodes, -1);
+	vector<number> bestSplitValues(numNodes, 0);
+	vector<double> cutWeights;
+
+	for(int axis = 0; axis < dim; ++axis){
+		if(!m_splitAxisEnabled[axis])
+			continue;
+
+		for(size_t iNode = 0; iNode < numNodes; ++iNode){
+			if(!treeNodes[iNode].bisectionComplete)
+				treeNodes[iNode].splitAxis = axis;
+		}
+
+		init_split_values(treeNodes);
+		improve_split_values(treeNodes, m_splitImproveIterations, aWeight, com);
+		calculate_cut_weights(cutWeights, treeNodes, com);
+
+		for(size_t iNode = 0; iNode < numNodes; ++iNode){
+			if(treeNodes[iNode].bisectionComplete)
+				continue;
+			if(cutWeights[iNode] < bestCutWeights[iNode]){
+				bestCutWeights[iNode] = cutWeights[iNode];
+				bestAxis[iNode] = axis;
+				bestSplitValues[iNode] = treeNodes[iNode].splitValue;
+			}
+		}
+	}
+
+	for(size_t iNode = 0; iNode < numNodes; ++iNode){
+		TreeNode& tn = treeNodes[iNode];
+		if(tn.bisectionComplete || (bestAxis[iNode] == -1))
+			continue;
+		tn.splitAxis = bestAxis[iNode];
+		tn.splitValue = bestSplitValues[iNode];
+		tn.minSplitValue = tn.boxMin[tn.splitAxis];
+		tn.maxSplitValue = tn.boxMax[tn.splitAxis];
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_DynamicBisection<TElem, dim>::
+calculate_cut_weights(vector<double>& cutWeightsOut, vector<TreeNode>& treeNodes,
+					  pcl::ProcessCommunicator& com)
+{
+	GDIST_PROFILE_FUNC();
+	UG_COND_THROW(m_connectionWeights.invalid(),
+				  "calculate_cut_weights requires valid connection weights.");
+
+	MultiGrid& mg = *m_mg;
+	IConnectionWeights& cw = *m_connectionWeights;
+
+//	we'll store the tree-node index of each element, to make sure that only
+//	connections to elements in the same tree-node are considered.
+	AInt aNodeInd;
+	mg.attach_to_dv<elem_t>(aNodeInd, -1);
+	Grid::AttachmentAccessor<elem_t, AInt> aaNodeInd(mg, aNodeInd);
+
+	for(size_t iNode = 0; iNode < treeNodes.size(); ++iNode){
+		ElemList& elems = treeNodes[iNode].elems;
+		for(size_t i = elems.first(); i != s_invalidIndex; i = elems.next(i))
+			aaNodeInd[elems.elem(i)] = (int)iNode;
+	}
+
+	vector<double> cutWeights(treeNodes.size(), 0);
+	typename Grid::traits<side_t>::secure_container	sides;
+	typename Grid::traits<elem_t>::secure_container	nbrs;
+
+	for(size_t iNode = 0; iNode < treeNodes.size(); ++iNode){
+		TreeNode& tn = treeNodes[iNode];
+		if(tn.bisectionComplete)
+			continue;
+
+		ElemList& elems = tn.elems;
+		for(size_t i = elems.first(); i != s_invalidIndex; i = elems.next(i)){
+			elem_t* e = elems.elem(i);
+			bool left = CalculateCenter(e, m_aaPos)[tn.splitAxis] < tn.splitValue;
+
+			mg.associated_elements(sides, e);
+			for(size_t i_side = 0; i_side < sides.size(); ++i_side){
+				side_t* s = sides[i_side];
+				mg.associated_elements(nbrs, s);
+				for(size_t i_nbr = 0; i_nbr < nbrs.size(); ++i_nbr){
+					elem_t* nbr = nbrs[i_nbr];
+					if((nbr == e) || (aaNodeInd[nbr] != (int)iNode))
+						continue;
+					bool nbrLeft = CalculateCenter(nbr, m_aaPos)[tn.splitAxis] < tn.splitValue;
+				//	each cut connection is visited from both of its elements
+					if(left != nbrLeft)
+						cutWeights[iNode] += 0.5 * cw.get_weight(s);
+				}
+			}
+		}
+	}
+
+	mg.detach_from<elem_t>(aNodeInd);
+
+	com.allreduce(cutWeights, cutWeightsOut, PCL_RO_SUM);
+}
+
+
 template class Partitioner_DynamicBisection<Edge, 1>;
 template class Partitioner_DynamicBisection<Edge, 2>;
 template class Partitioner_DynamicBisection<Face, 2>;
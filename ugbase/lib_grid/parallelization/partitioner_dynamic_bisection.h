@@ -95,7 +95,13 @@ class Partitioner_DynamicBisection : public IPartitioner{
 		
 		virtual void set_next_process_hierarchy(SPProcessHierarchy procHierarchy);
 		virtual void set_balance_weights(SPBalanceWeights balanceWeights);
-//		virtual void set_connection_weights(SmartPtr<ConnectionWeights<dim> >);
+
+	///	if connection weights are set, the split axis with the lowest cut-weight is chosen.
+	/**	For each tree-node a balanced split is computed for every enabled
+	 * split axis. The axis for which the sum of the weights of the cut
+	 * connections is the smallest is then used. Note that this requires
+	 * additional global communication.*/
+		virtual void set_connection_weights(SPConnectionWeights conWeights);
 		virtual void set_partition_post_processor(SPPartitionPostProcessor ppp);
 
 		virtual ConstSPProcessHierarchy current_process_hierarchy() const;
@@ -247,6 +253,20 @@ class Partitioner_DynamicBisection : public IPartitioner{
 		void improve_split_values(std::vector<TreeNode>& treeNodes,
 								  size_t maxIterations, ANumber aWeight,
 								  pcl::ProcessCommunicator& com);
+
+	///	sets initial split-values for the current split-axis of all incomplete tree-nodes
+		void init_split_values(std::vector<TreeNode>& treeNodes);
+
+	///	chooses the split-axis of each tree-node such that the weight of cut connections is minimal
+		void select_split_axes_by_connection_weights(std::vector<TreeNode>& treeNodes,
+													 ANumber aWeight,
+													 pcl::ProcessCommunicator& com);
+
+	///	sums the connection weights of all connections which are cut by the current split-values.
+	/**	Only elements of the same tree-node are considered as neighbors.*/
+		void calculate_cut_weights(std::vector<double>& cutWeightsOut,
+								   std::vector<TreeNode>& treeNodes,
+								   pcl::ProcessCommunicator& com);
 	
 
 		MultiGrid*								m_mg;
@@ -259,6 +279,7 @@ class Partitioner_DynamicBisection : public IPartitioner{
 		std::vector<Entry>						m_entries;
 
 		SPBalanceWeights						m_balanceWeights;
+		SPConnectionWeights						m_connectionWeights;
 		SPPartitionPostProcessor				m_partitionPostProcessor;
 
 		bool	m_staticPartitioning;
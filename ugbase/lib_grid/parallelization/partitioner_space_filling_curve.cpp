@@ -0,0 +1,713 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <limits>
+#include "partitioner_space_filling_curve.h"
+#include "distributed_grid.h"
+#include "lib_grid/parallelization/util/compol_copy_attachment.h"
+#include "lib_grid/parallelization/util/compol_subset.h"
+#include "lib_grid/parallelization/parallelization_util.h"
+#include "lib_grid/algorithms/attachment_util.h"
+#include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
+
+using namespace std;
+
+namespace ug{
+
+template <class TElem, int dim>
+Partitioner_SpaceFillingCurve<TElem, dim>::
+Partitioner_SpaceFillingCurve() :
+	m_mg(NULL),
+	m_hilbertCurveEnabled(true),
+	m_numBuckets(64),
+	m_tolerance(0.99)
+{
+	m_processHierarchy = SPProcessHierarchy(new ProcessHierarchy);
+	m_processHierarchy->add_hierarchy_level(0, 1);
+
+	m_balanceWeights = make_sp(new IBalanceWeights());
+}
+
+template <class TElem, int dim>
+Partitioner_SpaceFillingCurve<TElem, dim>::
+~Partitioner_SpaceFillingCurve()
+{
+}
+
+////////////////////////////////
+//	SETTERS AND GETTERS
+////////////////////////////////
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos)
+{
+	m_mg = mg;
+	if(m_sh.valid())
+		m_sh->assign_grid(m_mg);
+	m_aPos = aPos;
+	m_aaPos.access(*m_mg, m_aPos);
+}
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+set_subset_handler(SmartPtr<SubsetHandler> sh)
+{
+	m_sh = sh;
+	if(m_mg)
+		m_sh->assign_grid(m_mg);
+}
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+set_num_histogram_buckets(size_t num)
+{
+	UG_COND_THROW(num < 2, "Partitioner_SpaceFillingCurve: At least 2 histogram "
+				  "buckets are required.");
+	m_numBuckets = num;
+}
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+set_next_process_hierarchy(SPProcessHierarchy procHierarchy)
+{
+	m_nextProcessHierarchy = procHierarchy;
+}
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+set_balance_weights(SPBalanceWeights balanceWeights)
+{
+	m_balanceWeights = balanceWeights;
+}
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+set_partition_post_processor(SPPartitionPostProcessor ppp)
+{
+	m_partitionPostProcessor = ppp;
+}
+
+template <class TElem, int dim>
+ConstSPProcessHierarchy Partitioner_SpaceFillingCurve<TElem, dim>::
+current_process_hierarchy() const
+{
+	return m_processHierarchy;
+}
+
+template <class TElem, int dim>
+ConstSPProcessHierarchy Partitioner_SpaceFillingCurve<TElem, dim>::
+next_process_hierarchy() const
+{
+	return m_nextProcessHierarchy;
+}
+
+template <class TElem, int dim>
+SubsetHandler& Partitioner_SpaceFillingCurve<TElem, dim>::
+get_partitions()
+{
+	if(m_sh.invalid()){
+		if(m_mg)
+			m_sh = make_sp(new SubsetHandler(*m_mg));
+		else
+			m_sh = make_sp(new SubsetHandler());
+	}
+	return *m_sh;
+}
+
+template <class TElem, int dim>
+const std::vector<int>* Partitioner_SpaceFillingCurve<TElem, dim>::
+get_process_map() const
+{
+	return NULL;
+}
+
+
+////////////////////////////////
+//	PARTITIONING
+////////////////////////////////
+template <class TElem, int dim>
+bool Partitioner_SpaceFillingCurve<TElem, dim>::
+partition(size_t baseLvl, size_t elementThreshold)
+{
+	GDIST_PROFILE_FUNC();
+
+	UG_COND_THROW(m_mg == NULL,
+			"No grid was specified for Partitioner_SpaceFillingCurve. "
+			"partitioning can't be executed without a specified grid.");
+
+	if(m_balanceWeights.invalid())
+		m_balanceWeights = make_sp(new IBalanceWeights());
+
+	MultiGrid& mg = *m_mg;
+	if(m_sh.invalid())
+		m_sh = make_sp(new SubsetHandler(mg));
+	SubsetHandler& sh = *m_sh;
+	sh.clear();
+
+	ANumber aWeight;
+	mg.attach_to<elem_t>(aWeight);
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->init_post_processing(m_mg, m_sh.get());
+
+//	assign all elements below baseLvl to the local process
+	for(int i = 0; i < (int)baseLvl; ++i)
+		sh.assign_subset(mg.begin<elem_t>(i), mg.end<elem_t>(i), 0);
+
+	const ProcessHierarchy* procH;
+	if(m_nextProcessHierarchy.valid())
+		procH = m_nextProcessHierarchy.get();
+	else
+		procH = m_processHierarchy.get();
+
+	m_problemsOccurred = false;
+
+//	iterate over all hierarchy levels and perform rebalancing for all
+//	hierarchy-sections which contain levels higher than baseLvl
+	for(size_t hlevel = 0; hlevel < procH->num_hierarchy_levels(); ++ hlevel)
+	{
+		int numProcs = procH->num_global_procs_involved(hlevel);
+
+		int minLvl = procH->grid_base_level(hlevel);
+		int maxLvl = (int)mg.top_level();
+
+		if(m_balanceWeights->has_level_offsets()){
+			if(mg.top_level() < procH->grid_base_level(hlevel)){
+			//	see Partitioner_DynamicBisection::partition for a detailed
+			//	explanation of this case.
+				if((hlevel == 0) ||
+					((int)procH->num_global_procs_involved(hlevel - 1) != numProcs))
+				{
+					UG_LOG("Partitioner_SpaceFillingCurve: Ignoring hierarchy level "
+						<< hlevel << " since it doesn't contain any elements yet\n");
+					m_problemsOccurred = true;
+				}
+				continue;
+			}
+		}
+
+		if(hlevel + 1 < procH->num_hierarchy_levels()){
+			maxLvl = min<int>(maxLvl,
+						(int)procH->grid_base_level(hlevel + 1) - 1);
+		}
+
+		if(minLvl < (int)baseLvl)
+			minLvl = (int)baseLvl;
+
+		if(maxLvl < minLvl)
+			continue;
+
+		if(numProcs <= 1){
+			for(int i = minLvl; i <= maxLvl; ++i)
+				sh.assign_subset(mg.begin<elem_t>(i), mg.end<elem_t>(i), 0);
+			continue;
+		}
+
+	//	if clustered siblings are enabled, we'll perform partitioning on the level
+	//	below minLvl (if such a level exists). However, only the partition-map
+	//	of minLvl and levels above will be adjusted.
+		int partitionLvl = minLvl;
+		pcl::ProcessCommunicator com = procH->global_proc_com(hlevel);
+
+		if((minLvl > 0) && base_class::clustered_siblings_enabled()){
+			partitionLvl = minLvl - 1;
+			size_t partitionHLvl = m_processHierarchy->hierarchy_level_from_grid_level(partitionLvl);
+			com = m_processHierarchy->global_proc_com(partitionHLvl);
+		}
+
+		perform_partitioning(numProcs, minLvl, maxLvl, partitionLvl, aWeight, com);
+
+		for(int i = minLvl; i < maxLvl; ++i){
+			copy_partitions_to_children(sh, i);
+		}
+	}
+
+	if(m_nextProcessHierarchy.valid()){
+		*m_processHierarchy = *m_nextProcessHierarchy;
+		m_nextProcessHierarchy = SPProcessHierarchy(NULL);
+	}
+
+	mg.detach_from<elem_t>(aWeight);
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->partitioning_done();
+
+	m_entries.clear();
+	m_prefixWeights.clear();
+
+	PCL_DEBUG_BARRIER_ALL();
+	return true;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+perform_partitioning(int numTargetProcs, int minLvl, int maxLvl, int partitionLvl,
+					 ANumber aWeight, pcl::ProcessCommunicator com)
+{
+	GDIST_PROFILE_FUNC();
+
+	typedef typename MultiGrid::traits<elem_t>::iterator iter_t;
+
+	MultiGrid&		mg	= *m_mg;
+	SubsetHandler&	sh	= *m_sh;
+	DistributedGridManager* pdgm = mg.distributed_grid_manager();
+
+	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+
+	vector<int> origSubsetIndices;
+	if(partitionLvl < minLvl){
+		origSubsetIndices.reserve(mg.num<elem_t>(partitionLvl));
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter)
+		{
+			origSubsetIndices.push_back(sh.get_subset_index(*eiter));
+		}
+	}
+
+//	invalidate target partitions of all elements in partitionLvl
+	sh.assign_subset(mg.begin<elem_t>(partitionLvl),
+					 mg.end<elem_t>(partitionLvl), -1);
+
+	gather_weights(partitionLvl, minLvl, maxLvl, aWeight);
+
+//	collect all elements on partitionLvl which carry weight
+	m_entries.clear();
+	m_entries.reserve(mg.num<elem_t>(partitionLvl));
+	for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+		eiter != mg.end<elem_t>(partitionLvl); ++eiter)
+	{
+		elem_t* elem = *eiter;
+		if((aaWeight[elem] > 0) && ((!pdgm) || (!pdgm->is_ghost(elem)))){
+			Entry entry;
+			entry.key = 0;
+			entry.weight = aaWeight[elem];
+			entry.elem = elem;
+			m_entries.push_back(entry);
+		}
+	}
+
+	if(!com.empty()){
+		calculate_keys(com);
+
+		vector<key_t> splitters;
+		find_splitters(splitters, numTargetProcs, com);
+
+	//	the curve-segment in which an element lies defines its target process
+		for(size_t i = 0; i < m_entries.size(); ++i){
+			int p = (int)(upper_bound(splitters.begin(), splitters.end(),
+									  m_entries[i].key)
+						  - splitters.begin());
+			sh.assign_subset(m_entries[i].elem, p);
+		}
+	}
+
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->post_process(partitionLvl);
+
+	if(partitionLvl < minLvl){
+		UG_ASSERT(partitionLvl == minLvl - 1,
+				  "partitionLvl and minLvl should be neighbors");
+
+	//	copy subset indices from partition-level to minLvl
+		copy_partitions_to_children(sh, partitionLvl);
+
+	//	reset partitions in the specified partition-level
+		size_t counter = 0;
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter, ++counter)
+		{
+			sh.assign_subset(*eiter, origSubsetIndices[counter]);
+		}
+	}
+	else if(pdgm){
+	//	copy subset indices from vertical slaves to vertical masters,
+	//	since partitioning was only performed on vslaves
+		GridLayoutMap& glm = pdgm->grid_layout_map();
+		ComPol_Subset<layout_t>	compolSHCopy(sh, true);
+
+		if(glm.has_layout<elem_t>(INT_V_SLAVE))
+			m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(partitionLvl),
+								 compolSHCopy);
+		if(glm.has_layout<elem_t>(INT_V_MASTER))
+			m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(partitionLvl),
+									compolSHCopy);
+		m_intfcCom.communicate();
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+gather_weights(int partitionLvl, int minLvl, int maxLvl, ANumber aWeight)
+{
+	GDIST_PROFILE_FUNC();
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+
+	IBalanceWeights& bw = *m_balanceWeights;
+	MultiGrid& mg = *m_mg;
+	DistributedGridManager* pdgm = mg.distributed_grid_manager();
+	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+	ComPol_CopyAttachment<layout_t, ANumber> compolCopy(mg, aWeight);
+
+	const bool levelOffsets = bw.has_level_offsets();
+
+	for(int lvl = maxLvl; lvl >= partitionLvl; --lvl){
+	//	copy accumulated weights from v-slaves to v-masters on the level above
+		if((lvl < maxLvl) && pdgm){
+			GridLayoutMap& glm = pdgm->grid_layout_map();
+			if(glm.has_layout<elem_t>(INT_V_SLAVE))
+				m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl + 1),
+									 compolCopy);
+			if(glm.has_layout<elem_t>(INT_V_MASTER))
+				m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl + 1),
+										compolCopy);
+			m_intfcCom.communicate();
+		}
+
+		for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+		{
+			elem_t* e = *iter;
+			size_t numChildren = mg.num_children<elem_t>(e);
+			number w = 0;
+			if((lvl >= minLvl) && ((!pdgm) || (!pdgm->is_ghost(e)))){
+				if(levelOffsets && (numChildren == 0) && bw.consider_in_level_above(e))
+					w = bw.get_refined_weight(e);
+				else
+					w = bw.get_weight(e);
+			}
+
+			if(lvl < maxLvl){
+				for(size_t i = 0; i < numChildren; ++i)
+					w += aaWeight[mg.get_child<elem_t>(e, i)];
+			}
+			aaWeight[e] = w;
+		}
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+calculate_keys(pcl::ProcessCommunicator& com)
+{
+	GDIST_PROFILE_FUNC();
+
+//	calculate the global bounding box of all element centers
+	vector<vector_t> centers(m_entries.size());
+	vector<double> boxMin(dim, numeric_limits<double>::max());
+	vector<double> boxMax(dim, -numeric_limits<double>::max());
+
+	for(size_t i = 0; i < m_entries.size(); ++i){
+		centers[i] = CalculateCenter(m_entries[i].elem, m_aaPos);
+		for(int d = 0; d < dim; ++d){
+			boxMin[d] = min<double>(boxMin[d], centers[i][d]);
+			boxMax[d] = max<double>(boxMax[d], centers[i][d]);
+		}
+	}
+
+	vector<double> gBoxMin, gBoxMax;
+	com.allreduce(boxMin, gBoxMin, PCL_RO_MIN);
+	com.allreduce(boxMax, gBoxMax, PCL_RO_MAX);
+
+//	we have to make sure that the quantized coordinates can be represented
+//	exactly by a double and that the resulting key fits into 63 bits.
+	const int bitsPerDim = min<int>(63 / dim, 52);
+	const key_t maxCoord = (key_t(1) << bitsPerDim) - 1;
+
+	double scale[dim];
+	for(int d = 0; d < dim; ++d){
+		double extension = gBoxMax[d] - gBoxMin[d];
+		if(extension > 0)
+			scale[d] = (double)maxCoord / extension;
+		else
+			scale[d] = 0;
+	}
+
+	key_t coords[dim];
+	for(size_t i = 0; i < m_entries.size(); ++i){
+		for(int d = 0; d < dim; ++d){
+			double c = (centers[i][d] - gBoxMin[d]) * scale[d];
+			if(c <= 0)
+				coords[d] = 0;
+			else if(c >= (double)maxCoord)
+				coords[d] = maxCoord;
+			else
+				coords[d] = (key_t)c;
+		}
+
+		if(m_hilbertCurveEnabled)
+			m_entries[i].key = hilbert_key(coords, bitsPerDim);
+		else
+			m_entries[i].key = morton_key(coords, bitsPerDim);
+	}
+
+	sort(m_entries.begin(), m_entries.end());
+
+	m_prefixWeights.resize(m_entries.size() + 1);
+	m_prefixWeights[0] = 0;
+	for(size_t i = 0; i < m_entries.size(); ++i)
+		m_prefixWeights[i + 1] = m_prefixWeights[i] + m_entries[i].weight;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+find_splitters(vector<key_t>& splittersOut, int numTargetProcs,
+			   pcl::ProcessCommunicator& com)
+{
+	GDIST_PROFILE_FUNC();
+
+	const int numSplitters = numTargetProcs - 1;
+	splittersOut.assign(max<int>(numSplitters, 0), 0);
+	if(numSplitters <= 0)
+		return;
+
+	const number totalWeight = com.allreduce(m_prefixWeights.back(), PCL_RO_SUM);
+	if(totalWeight <= 0)
+		return;
+
+	const number partitionWeight = totalWeight / (number)numTargetProcs;
+	const number tolerance = (1. - m_tolerance) * partitionWeight;
+	const int keyBits = min<int>(63 / dim, 52) * dim;
+	const size_t numBuckets = m_numBuckets;
+
+//	each splitter is searched in the key-interval [lo, hi). The global weight
+//	of all elements with a key smaller than lo is stored in weightBelowLo.
+	vector<key_t> lo(numSplitters, 0);
+	vector<key_t> hi(numSplitters, key_t(1) << keyBits);
+	vector<key_t> step(numSplitters, 0);
+	vector<number> weightBelowLo(numSplitters, 0);
+	vector<bool> done(numSplitters, false);
+	int numDone = 0;
+
+	vector<double> hist, gHist;
+	while(numDone < numSplitters){
+		hist.assign(numSplitters * numBuckets, 0);
+
+	//	local weighted histograms of the unresolved key intervals
+		for(int i = 0; i < numSplitters; ++i){
+			if(done[i])
+				continue;
+
+			key_t width = hi[i] - lo[i];
+			step[i] = width / numBuckets;
+			if(width % numBuckets)
+				++step[i];
+
+			number wBase = weight_below(lo[i]);
+			for(size_t b = 0; b < numBuckets; ++b){
+				key_t bucketEnd = lo[i] + (b + 1) * step[i];
+				if(bucketEnd >= hi[i]){
+					hist[i * numBuckets + b] = weight_below(hi[i]) - wBase;
+					break;
+				}
+				hist[i * numBuckets + b] = weight_below(bucketEnd) - wBase;
+			}
+		}
+
+		com.allreduce(hist, gHist, PCL_RO_SUM);
+
+	//	the histograms contain accumulated weights. Find the bucket which
+	//	contains the target weight of each splitter and narrow the interval.
+	//	Since all processes work on the same global data, they all take
+	//	the same decisions.
+		for(int i = 0; i < numSplitters; ++i){
+			if(done[i])
+				continue;
+
+			const number target = (number)(i + 1) * partitionWeight;
+			number wLeft = weightBelowLo[i];
+			size_t b = 0;
+			for(; b < numBuckets; ++b){
+				key_t bucketEnd = lo[i] + (b + 1) * step[i];
+				if((weightBelowLo[i] + gHist[i * numBuckets + b] >= target)
+					|| (bucketEnd >= hi[i]))
+				{
+					break;
+				}
+				wLeft = weightBelowLo[i] + gHist[i * numBuckets + b];
+			}
+			if(b == numBuckets)
+				--b;
+
+			key_t newLo = lo[i] + b * step[i];
+			key_t newHi = min<key_t>(hi[i], newLo + step[i]);
+			number wRight = weightBelowLo[i] + gHist[i * numBuckets + b];
+
+			if(target - wLeft <= tolerance){
+				splittersOut[i] = newLo;
+				done[i] = true;
+			}
+			else if(wRight - target <= tolerance){
+				splittersOut[i] = newHi;
+				done[i] = true;
+			}
+			else if(step[i] <= 1){
+			//	all elements in this bucket share the same key and can't be
+			//	separated. Choose the nearer bound.
+				if(target - wLeft < wRight - target)
+					splittersOut[i] = newLo;
+				else
+					splittersOut[i] = newHi;
+				done[i] = true;
+			}
+			else{
+				lo[i] = newLo;
+				hi[i] = newHi;
+				weightBelowLo[i] = wLeft;
+			}
+
+			if(done[i])
+				++numDone;
+		}
+	}
+
+//	splitters should already be sorted. This only guards against round-off
+	sort(splittersOut.begin(), splittersOut.end());
+}
+
+
+template <class TElem, int dim>
+number Partitioner_SpaceFillingCurve<TElem, dim>::
+weight_below(key_t key) const
+{
+	size_t lower = 0;
+	size_t upper = m_entries.size();
+	while(lower < upper){
+		size_t center = (lower + upper) / 2;
+		if(m_entries[center].key < key)
+			lower = center + 1;
+		else
+			upper = center;
+	}
+	return m_prefixWeights[lower];
+}
+
+
+template <class TElem, int dim>
+typename Partitioner_SpaceFillingCurve<TElem, dim>::key_t
+Partitioner_SpaceFillingCurve<TElem, dim>::
+hilbert_key(key_t* x, int bitsPerDim) const
+{
+//	transforms the coordinates to the transposed hilbert index, cf.
+//	J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004)
+	const key_t m = key_t(1) << (bitsPerDim - 1);
+
+//	inverse undo
+	for(key_t q = m; q > 1; q >>= 1){
+		key_t p = q - 1;
+		for(int i = 0; i < dim; ++i){
+			if(x[i] & q)
+				x[0] ^= p;
+			else{
+				key_t t = (x[0] ^ x[i]) & p;
+				x[0] ^= t;
+				x[i] ^= t;
+			}
+		}
+	}
+
+//	gray encode
+	for(int i = 1; i < dim; ++i)
+		x[i] ^= x[i - 1];
+
+	key_t t = 0;
+	for(key_t q = m; q > 1; q >>= 1){
+		if(x[dim - 1] & q)
+			t ^= q - 1;
+	}
+
+	for(int i = 0; i < dim; ++i)
+		x[i] ^= t;
+
+//	the hilbert index is obtained by interleaving the bits of the transposed index
+	return morton_key(x, bitsPerDim);
+}
+
+
+template <class TElem, int dim>
+typename Partitioner_SpaceFillingCurve<TElem, dim>::key_t
+Partitioner_SpaceFillingCurve<TElem, dim>::
+morton_key(key_t* x, int bitsPerDim) const
+{
+	key_t key = 0;
+	for(int b = bitsPerDim - 1; b >= 0; --b){
+		for(int i = 0; i < dim; ++i)
+			key = (key << 1) | ((x[i] >> b) & 1);
+	}
+	return key;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SpaceFillingCurve<TElem, dim>::
+copy_partitions_to_children(ISubsetHandler& partitionSH, int lvl)
+{
+	GDIST_PROFILE_FUNC();
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+	MultiGrid& mg = *m_mg;
+
+//	assign partitions to all children in this hierarchy level
+	for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+	{
+		size_t numChildren = mg.num_children<elem_t>(*iter);
+		int si = partitionSH.get_subset_index(*iter);
+		for(size_t i = 0; i < numChildren; ++i)
+			partitionSH.assign_subset(mg.get_child<elem_t>(*iter, i), si);
+	}
+
+	if(mg.is_parallel()){
+		GridLayoutMap& glm = mg.distributed_grid_manager()->grid_layout_map();
+	//	communicate partitions from v-masters to v-slaves, since v-slaves
+	//	havn't got no parents on their procs.
+		ComPol_Subset<layout_t>	compolSHCopy(partitionSH, true);
+		if(glm.has_layout<elem_t>(INT_V_MASTER)){
+			m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl+1),
+								 compolSHCopy);
+		}
+		if(glm.has_layout<elem_t>(INT_V_SLAVE)){
+			m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl+1),
+									compolSHCopy);
+		}
+		m_intfcCom.communicate();
+	}
+}
+
+
+template class Partitioner_SpaceFillingCurve<Edge, 1>;
+template class Partitioner_SpaceFillingCurve<Edge, 2>;
+template class Partitioner_SpaceFillingCurve<Face, 2>;
+template class Partitioner_SpaceFillingCurve<Edge, 3>;
+template class Partitioner_SpaceFillingCurve<Face, 3>;
+template class Partitioner_SpaceFillingCurve<Volume, 3>;
+
+}// end of namespace
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__partitioner_space_filling_curve__
+#define __H__UG__partitioner_space_filling_curve__
+
+#include <vector>
+#include "parallel_grid_layout.h"
+#include "load_balancer.h"
+#include "pcl/pcl_interface_communicator.h"
+
+namespace ug{
+
+/// \addtogroup lib_grid_parallelization_distribution
+///	\{
+
+///	Parallel partitioner based on a space filling curve through the element centers
+/**	Elements are ordered along a Hilbert- (default) or Morton-curve through
+ * their centers. The curve is then cut into consecutive segments of equal
+ * weight, where the weight of an element is the sum of the balance weights
+ * of all of its descendants on the levels which are partitioned.
+ *
+ * Instead of sorting all elements globally, the splitting keys are located
+ * through a few rounds of weighted key-histograms, each of which costs one
+ * allreduce on the involved processes. Together with the local sort this
+ * leads to an almost linear runtime, which makes the partitioner well suited
+ * for frequent repartitioning of adaptive grids.
+ *
+ * The partitioner can be used inside a LoadBalancer or separately. It can
+ * operate on serial and parallel multigrids and respects the
+ * ProcessHierarchy specified through set_next_process_hierarchy.
+ */
+template <class TElem, int dim>
+class Partitioner_SpaceFillingCurve : public IPartitioner{
+	public:
+		typedef IPartitioner	 						base_class;
+		typedef TElem									elem_t;
+		typedef MathVector<dim>							vector_t;
+		typedef Attachment<vector_t>					apos_t;
+		typedef Grid::VertexAttachmentAccessor<apos_t>	aapos_t;
+		typedef typename GridLayoutMap::Types<elem_t>::Layout::LevelLayout	layout_t;
+		typedef uint64								key_t;
+
+		Partitioner_SpaceFillingCurve();
+		virtual ~Partitioner_SpaceFillingCurve();
+
+		void set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos);
+
+	///	allows to optionally specify a subset-handler on which the balancer shall operate
+		void set_subset_handler(SmartPtr<SubsetHandler> sh);
+
+	///	if enabled, a Hilbert curve is used, otherwise a Morton (z-order) curve.
+	/**	Hilbert curves lead to more compact partitions and are enabled by default.*/
+		void enable_hilbert_curve(bool enable)	{m_hilbertCurveEnabled = enable;}
+		bool hilbert_curve_enabled() const		{return m_hilbertCurveEnabled;}
+
+	///	the number of buckets per splitter used in each histogram round.
+	/**	Larger values reduce the number of global reductions but increase
+	 * the size of the reduced buffers. 64 by default.*/
+		void set_num_histogram_buckets(size_t num);
+		size_t num_histogram_buckets() const		{return m_numBuckets;}
+
+	///	sets the tolerance threshold. 1: no tolerance, 0: full tolerance.
+	/**	Histogram refinement stops as soon as the weight of each partition
+	 * deviates by less than (1 - tol) from the optimal partition weight.
+	 * The tolerance is defaulted to 0.99*/
+		void set_tolerance(number tol)	{m_tolerance = tol;}
+
+		virtual void set_next_process_hierarchy(SPProcessHierarchy procHierarchy);
+		virtual void set_balance_weights(SPBalanceWeights balanceWeights);
+		virtual void set_partition_post_processor(SPPartitionPostProcessor ppp);
+
+		virtual ConstSPProcessHierarchy current_process_hierarchy() const;
+		virtual ConstSPProcessHierarchy next_process_hierarchy() const;
+
+		virtual bool supports_balance_weights() const		{return true;}
+		virtual bool supports_repartitioning() const		{return true;}
+
+		virtual bool partition(size_t baseLvl, size_t elementThreshold);
+
+		virtual SubsetHandler& get_partitions();
+		virtual const std::vector<int>* get_process_map() const;
+
+	private:
+		struct Entry{
+			key_t	key;
+			number	weight;
+			elem_t*	elem;
+			bool operator<(const Entry& e) const	{return key < e.key;}
+		};
+
+		void perform_partitioning(int numTargetProcs, int minLvl, int maxLvl,
+								  int partitionLvl, ANumber aWeight,
+								  pcl::ProcessCommunicator com);
+
+	///	accumulates the weights of all elements in [minLvl, maxLvl] in their ancestors on partitionLvl
+		void gather_weights(int partitionLvl, int minLvl, int maxLvl, ANumber aWeight);
+
+	///	calculates keys of all entries in m_entries and sorts them
+		void calculate_keys(pcl::ProcessCommunicator& com);
+
+	///	computes numTargetProcs - 1 splitting keys using weighted histograms
+		void find_splitters(std::vector<key_t>& splittersOut, int numTargetProcs,
+							pcl::ProcessCommunicator& com);
+
+	///	sum of the weights of all local entries whose key is smaller than the given key
+		number weight_below(key_t key) const;
+
+		key_t hilbert_key(key_t* coords, int bitsPerDim) const;
+		key_t morton_key(key_t* coords, int bitsPerDim) const;
+
+		void copy_partitions_to_children(ISubsetHandler& partitionSH, int lvl);
+
+		MultiGrid*								m_mg;
+		apos_t									m_aPos;
+		aapos_t									m_aaPos;
+		SmartPtr<SubsetHandler>					m_sh;
+		SPProcessHierarchy						m_processHierarchy;
+		SPProcessHierarchy						m_nextProcessHierarchy;
+		pcl::InterfaceCommunicator<layout_t>	m_intfcCom;
+
+		SPBalanceWeights						m_balanceWeights;
+		SPPartitionPostProcessor				m_partitionPostProcessor;
+
+	///	local elements sorted by their key, together with their weights
+		std::vector<Entry>						m_entries;
+	///	m_prefixWeights[i] holds the sum of weights of m_entries[0, ..., i-1]
+		std::vector<number>						m_prefixWeights;
+
+		bool	m_hilbertCurveEnabled;
+		size_t	m_numBuckets;
+		number	m_tolerance;
+};
+
+///	\}
+
+}// end of namespace
+
+#endif
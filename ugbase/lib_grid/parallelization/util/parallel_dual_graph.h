@@ -38,6 +38,7 @@
 #include "pcl/pcl_process_communicator.h"
 #include "../distributed_grid.h"
 #include "../parallelization_util.h"
+#include "../load_balancer.h"
 
 namespace ug
 {
@@ -101,6 +102,19 @@ class ParallelDualGraph{
 		void generate_graph(int level, pcl::ProcessCommunicator procCom =
 											pcl::ProcessCommunicator(pcl::PCD_WORLD));
 
+	///	generates integral weights for each entry in the adjacency map.
+	/**	The weight of the i-th entry of the adjacency map is obtained from the
+	 * connecting object returned by get_connection(i). Weights are multiplied
+	 * by the given scale and rounded to the nearest integer. Since graph
+	 * partitioners like Parmetis require positive weights, the resulting
+	 * weights are at least 1.
+	 *
+	 * \note	this method only works while the underlying grid has not been
+	 *			changed since the last call to generate_graph.*/
+		void generate_connection_weights(std::vector<TIndexType>& weightsOut,
+										 IConnectionWeights& conWeights,
+										 number scale = 1);
+
 	///	returns a process communicator which only contains processes which contain an element.
 	/**	\note	the parallel-offset-map is built with respect to this process-communicator.
 	 * \note	this process communicator does not necessarily resemble the communicator
@@ -125,6 +125,24 @@ was_considered(TGeomBaseObj* o)
 	UG_ASSERT(m_pMG, "A MultiGrid has to be set!");
 	return m_aaElemIndex[o] != -1;
 }
+template <class TGeomBaseObj, class TIndexType, class TConnectingObj>
+void ParallelDualGraph<TGeomBaseObj, TIndexType, TConnectingObj>::
+generate_connection_weights(std::vector<TIndexType>& weightsOut,
+							IConnectionWeights& conWeights, number scale)
+{
+	UG_ASSERT(m_connections.size() == m_adjacencyMap.size(),
+			  "Call generate graph before calling this method!");
+
+	weightsOut.resize(m_connections.size());
+	for(size_t i = 0; i < m_connections.size(); ++i){
+		number w = scale * conWeights.get_weight(m_connections[i]) + 0.5;
+		if(w < 1)
+			weightsOut[i] = 1;
+		else
+			weightsOut[i] = static_cast<TIndexType>(w);
+	}
+}
+
 
 template <class TGeomBaseObj, class TIndexType, class TConnectingObj>
 void ParallelDualGraph<TGeomBaseObj, TIndexType, TConnectingObj>::
@@ -31,10 +31,15 @@
  */
 
 #include "pcl_process_communicator.h"
+#include "pcl_util.h"
 #include "common/util/binary_buffer.h"
 #include "common/log.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 #include <mpi.h>
 
 namespace pcl{
@@ -135,4 +140,194 @@ void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename,
 	//	UG_LOG("File read.\n");
 }
 
+void WriteConcatenatedParallelFile(const char* data, size_t size, std::string strFilename,
+								   int numAggregators, pcl::ProcessCommunicator pc)
+{
+	MPI_Comm comm = pc.get_mpi_communicator();
+	int rank, numProcs;
+	MPI_Comm_rank(comm, &rank);
+	MPI_Comm_size(comm, &numProcs);
+
+	if(numAggregators <= 0 || numAggregators > numProcs)
+		numAggregators = numProcs;
+
+	const int groupSize = (numProcs + numAggregators - 1) / numAggregators;
+	const bool bAggregator = (rank % groupSize == 0);
+
+//	gather the data of each group on its aggregator (in the order of the ranks)
+	std::vector<char> groupData;
+	const char* writeData = data;
+	long long writeSize = (long long)size;
+
+	const size_t maxSize = (size_t)std::numeric_limits<int>::max();
+	bool bSizeOk = (size <= maxSize);
+
+	MPI_Comm groupComm = MPI_COMM_NULL;
+	int mySize = (int)std::min(size, maxSize);
+	std::vector<int> sizes, displs;
+	if(groupSize > 1)
+	{
+		MPI_Comm_split(comm, rank / groupSize, rank, &groupComm);
+		int groupProcs;
+		MPI_Comm_size(groupComm, &groupProcs);
+
+		sizes.resize(groupProcs, 0);
+		displs.resize(groupProcs, 0);
+		MPI_Gather(&mySize, 1, MPI_INT, &sizes[0], 1, MPI_INT, 0, groupComm);
+
+		if(bAggregator){
+			size_t totalSize = 0;
+			for(int i = 0; i < groupProcs; ++i){
+				displs[i] = (int)std::min(totalSize, maxSize);
+				totalSize += sizes[i];
+			}
+			if(totalSize > maxSize)
+				bSizeOk = false;
+			else{
+				groupData.resize(std::max<size_t>(totalSize, 1));
+				writeSize = (long long)totalSize;
+			}
+		}
+	}
+
+//	all processes have to agree on the sizes before data is communicated,
+//	so that no process is left waiting in a collective call
+	if(!pcl::AllProcsTrue(bSizeOk, pc)){
+		if(groupComm != MPI_COMM_NULL)
+			MPI_Comm_free(&groupComm);
+		UG_THROW("WriteConcatenatedParallelFile: the data of a process or an "
+				 "aggregator group exceeds 2GB. Please use more aggregators.");
+	}
+
+	if(groupSize > 1)
+	{
+		MPI_Gatherv(const_cast<char*>(data), mySize, MPI_BYTE,
+					groupData.empty() ? NULL : &groupData.front(), &sizes[0], &displs[0], MPI_BYTE,
+					0, groupComm);
+		MPI_Comm_free(&groupComm);
+
+		if(bAggregator)
+			writeData = &groupData.front();
+	}
+
+//	the aggregators write their data at consecutive offsets
+	MPI_Comm aggComm;
+	MPI_Comm_split(comm, bAggregator ? 0 : MPI_UNDEFINED, rank, &aggComm);
+
+	if(!bAggregator)
+		return;
+
+	long long offset = 0;
+	MPI_Scan(&writeSize, &offset, 1, MPI_LONG_LONG, MPI_SUM, aggComm);
+	offset -= writeSize;
+
+	MPI_File fh;
+	if(MPI_File_open(aggComm, const_cast<char*>(strFilename.c_str()),
+					 MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh)
+		!= MPI_SUCCESS)
+	{
+		MPI_Comm_free(&aggComm);
+		UG_THROW("WriteConcatenatedParallelFile: could not open " << strFilename);
+	}
+
+//	remove old contents of an existing file
+	bool bWriteOk = (MPI_File_set_size(fh, 0) == MPI_SUCCESS);
+
+//	write in chunks, since MPI counts are ints
+	const long long maxChunk = 1 << 30;
+	MPI_Status status;
+	for(long long written = 0; bWriteOk && written < writeSize; written += maxChunk){
+		int chunk = (int)std::min(maxChunk, writeSize - written);
+		if(MPI_File_write_at(fh, (MPI_Offset)(offset + written),
+							 const_cast<char*>(writeData + written), chunk,
+							 MPI_BYTE, &status) != MPI_SUCCESS)
+		{
+			bWriteOk = false;
+			break;
+		}
+		int count = 0;
+		MPI_Get_count(&status, MPI_BYTE, &count);
+		if(count != chunk)
+			bWriteOk = false;
+	}
+
+//	the aggregators decide together, since closing the file is collective
+	int localOk = bWriteOk ? 1 : 0, globalOk = 0;
+	MPI_Allreduce(&localOk, &globalOk, 1, MPI_INT, MPI_MIN, aggComm);
+
+	MPI_File_close(&fh);
+	MPI_Comm_free(&aggComm);
+
+	UG_COND_THROW(!globalOk, "WriteConcatenatedParallelFile: could not write "
+				  "all data to " << strFilename);
+}
+
+void ReadParallelFileExtents(std::vector<char>& dataOut, std::string strFilename,
+							 const std::vector<std::pair<size_t, size_t> >& extents,
+							 pcl::ProcessCommunicator pc)
+{
+	MPI_Comm comm = pc.get_mpi_communicator();
+
+//	the extents define the file view of this core
+	std::vector<int> blockLens;
+	std::vector<MPI_Aint> displs;
+	size_t totalSize = 0;
+	bool bSorted = true;
+	for(size_t i = 0; i < extents.size(); ++i){
+		if(extents[i].second == 0)
+			continue;
+		if(!displs.empty() && (size_t)displs.back() + blockLens.back() > extents[i].first)
+			bSorted = false;
+		blockLens.push_back((int)std::min<size_t>(extents[i].second,
+												  std::numeric_limits<int>::max()));
+		displs.push_back((MPI_Aint)extents[i].first);
+		totalSize += extents[i].second;
+	}
+
+//	check on all cores before the collective calls, so that no core is left waiting
+	const bool bSizeOk = totalSize <= (size_t)std::numeric_limits<int>::max();
+	if(!AllProcsTrue(bSorted && bSizeOk, pc)){
+		UG_COND_THROW(!bSorted, "ReadParallelFileExtents: extents have to be sorted "
+					  "and must not overlap.");
+		UG_COND_THROW(!bSizeOk, "ReadParallelFileExtents: more than 2GB per core "
+					  "are not supported.");
+		UG_THROW("ReadParallelFileExtents: invalid extents on another core.");
+	}
+
+	dataOut.resize(totalSize);
+
+	MPI_File fh;
+	if(MPI_File_open(comm, const_cast<char*>(strFilename.c_str()), MPI_MODE_RDONLY,
+					 MPI_INFO_NULL, &fh) != MPI_SUCCESS)
+		UG_THROW("ReadParallelFileExtents: could not open " << strFilename);
+
+	MPI_Datatype fileType = MPI_BYTE;
+	if(!blockLens.empty()){
+		MPI_Type_create_hindexed((int)blockLens.size(), &blockLens.front(),
+								 &displs.front(), MPI_BYTE, &fileType);
+		MPI_Type_commit(&fileType);
+	}
+
+	MPI_File_set_view(fh, 0, MPI_BYTE, fileType, const_cast<char*>("native"), MPI_INFO_NULL);
+
+	MPI_Status status;
+	int err = MPI_File_read_all(fh, dataOut.empty() ? NULL : &dataOut.front(),
+								(int)totalSize, MPI_BYTE, &status);
+	int numRead = 0;
+	if(err == MPI_SUCCESS)
+		MPI_Get_count(&status, MPI_BYTE, &numRead);
+
+	if(fileType != MPI_BYTE)
+		MPI_Type_free(&fileType);
+	MPI_File_close(&fh);
+
+	const bool bSuccess = (err == MPI_SUCCESS && numRead == (int)totalSize);
+	if(!AllProcsTrue(bSuccess, pc)){
+		UG_COND_THROW(!bSuccess, "ReadParallelFileExtents: could only read "
+					  << numRead << " of " << totalSize << " bytes from " << strFilename);
+		UG_THROW("ReadParallelFileExtents: reading " << strFilename
+				 << " failed on another core.");
+	}
+}
+
 }
@@ -35,6 +35,9 @@
 
 #include "pcl_process_communicator.h"
 #include "common/util/binary_buffer.h"
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace pcl{
 
@@ -89,5 +92,45 @@ void WriteCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename
  */
 void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
 
+
+/**
+ * This function writes the data of all participating cores into one file. The file
+ * contains the plain concatenation of the data, ordered by the rank of the cores in pc
+ * (no header is written, in contrast to WriteCombinedParallelFile). An existing file
+ * is overwritten.
+ *
+ * To reduce the number of cores accessing the file system, the cores are split into
+ * numAggregators groups of consecutive ranks. Each group gathers its data on its first
+ * core (the aggregator), and only the aggregators write to the file through MPI-IO.
+ *
+ * @param data				the data of this core
+ * @param size				the size of the data of this core in bytes
+ * @param strFilename		the filename
+ * @param numAggregators	number of cores which access the file. If <= 0 or larger
+ * 							than pc.size(), each core writes its own data.
+ * @param pc				a processes communicator (default pcl::World)
+ */
+void WriteConcatenatedParallelFile(const char* data, size_t size, std::string strFilename,
+								   int numAggregators = 0,
+								   pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
+
+
+/**
+ * This function reads parts of a file collectively. Each core may read a different
+ * list of extents (offset, size in bytes), e.g. only the chunks of a file written by
+ * WriteConcatenatedParallelFile which it needs. The extents of a core have to be sorted
+ * by their offsets and must not overlap. Extents of different cores may overlap.
+ * Cores which don't need any data have to call the function nevertheless, with an
+ * empty list of extents.
+ *
+ * @param dataOut		the concatenated contents of the extents of this core
+ * @param strFilename	the filename
+ * @param extents		pairs (offset, size) of the extents of this core
+ * @param pc			a processes communicator (default pcl::World)
+ */
+void ReadParallelFileExtents(std::vector<char>& dataOut, std::string strFilename,
+							 const std::vector<std::pair<size_t, size_t> >& extents,
+							 pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
+
 }
 #endif /* PARALLEL_ARCHIVE_H_ */